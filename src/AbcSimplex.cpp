@@ -5773,10 +5773,14 @@ void AbcSimplex::checkDjs(int) const
 #else
 #define ABC_NUMBER_USEFUL_NORMAL ABC_NUMBER_USEFUL - 1
 #endif
+#if ABC_DEBUG
+// shared by all models so only when debugging one at a time
 static double *elAddress[ABC_NUMBER_USEFUL_NORMAL];
+#endif
 // For debug - prints summary of arrays which are out of kilter
 void AbcSimplex::checkArrays(int ignoreEmpty) const
 {
+#if ABC_DEBUG
   if (!numberIterations_ || !elAddress[0]) {
     for (int i = 0; i < ABC_NUMBER_USEFUL_NORMAL; i++)
       elAddress[i] = usefulArray_[i].denseVector();
@@ -5789,6 +5793,7 @@ void AbcSimplex::checkArrays(int ignoreEmpty) const
     for (int i = 0; i < ABC_NUMBER_USEFUL_NORMAL; i++)
       assert(elAddress[i] == usefulArray_[i].denseVector());
   }
+#endif
   for (int i = 0; i < ABC_NUMBER_USEFUL_NORMAL; i++) {
     int check = 1 << i;
     if (usefulArray_[i].getNumElements()) {
@@ -201,6 +201,7 @@ void AbcSimplexFactorization::forceOtherFactorization(int which)
 #endif
 }
 #ifdef CLP_FACTORIZATION_NEW_TIMING
+#ifdef CLP_USEFUL_PRINTOUT
 static bool readTwiddle = false;
 static double weightIncU = 1.0;
 static double weightR = 2.0;
@@ -211,6 +212,17 @@ static double weightNrows = 10.0;
 static double increaseNeeded = 1.1;
 static double constWeightIterate = 1.0;
 static double weightNrowsIterate = 3.0;
+#else
+#define weightIncU 1.0
+#define weightR 2.0
+#define weightRest 1.0
+#define weightFactL 30.0
+#define weightFactDense 0.1
+#define weightNrows 10.0
+#define increaseNeeded 1.1
+#define constWeightIterate 1.0
+#define weightNrowsIterate 3.0
+#endif
 bool AbcSimplexFactorization::timeToRefactorize() const
 {
   bool reFactor = (coinAbcFactorization_->pivots() * 3 > coinAbcFactorization_->maximumPivots() * 2 && coinAbcFactorization_->numberElementsR() * 3 > (coinAbcFactorization_->numberElementsL() + coinAbcFactorization_->numberElementsU()) * 2 + 1000 && !coinAbcFactorization_->numberDense());
@@ -224,6 +236,7 @@ bool AbcSimplexFactorization::timeToRefactorize() const
       totalInR_ = 0.0;
       totalInIncreasingU_ = 0.0;
       shortestAverage_ = COIN_DBL_MAX;
+#ifdef CLP_USEFUL_PRINTOUT
       if (!readTwiddle) {
         readTwiddle = true;
         char *environ = getenv("CLP_TWIDDLE");
@@ -238,6 +251,7 @@ bool AbcSimplexFactorization::timeToRefactorize() const
           weightFactDense, weightNrows, increaseNeeded,
           constWeightIterate, weightNrowsIterate);
       }
+#endif
     }
     lastNumberPivots_ = numberPivots;
     int numberDense = coinAbcFactorization_->numberDense();
@@ -33,7 +33,7 @@ static char coin_prompt[] = "Coin:";
 #else
 static char coin_prompt[] = "Clp:";
 #endif
-#ifdef CLP_CILK
+#if defined(CLP_CILK) || defined(CLP_THREAD_POOL)
 #ifndef CBC_THREAD
 #define CBC_THREAD
 #endif
@@ -1614,7 +1614,7 @@ with quadratic objectives.");
       "This will read an MPS format basis file from the given file name.  It will use the default\
  directory given by 'directory'.  A name of '$' will use the previous value for the name.  This\
  is initialized to '', i.e. it must be set.  If you have libz then it can read compressed\
- files 'xxxxxxxx.gz' or xxxxxxxx.bz2.");
+ files 'xxxxxxxx.gz' or xxxxxxxx.bz2.  Binary snapshots written with outputFormat 5 or 6 are also read.");
     parameters.push_back(p);
   }
   {
@@ -1713,9 +1713,12 @@ have more rounds of cuts - see passC!uts and passT!ree.");
 #else
     p.append("Pardiso_dummy");
 #endif
+    p.append("super!nodal");
     p.setLonghelp(
       "For a barrier code to be effective it needs a good Cholesky ordering and factorization.  \
 The native ordering and factorization is not state of the art, although acceptable.  \
+supernodal uses the native ordering with a supernodal factorization which \
+works on dense blocks and can use several threads.  \
 You may want to link in one from another source.  See Makefile.locations for some \
 possibilities.");
 
@@ -1852,11 +1855,13 @@ Cbc/examples/driver4.cpp.");
     p.append("off");
     p.append("maybe");
     p.append("presolve");
+    p.append("push");
     p.setLonghelp(
       "Interior point algorithms do not obtain a basic solution.\
  This option will crossover to a basic solution suitable for ranging or branch and cut.  With the current state \
 of the solver for quadratic programs it may be a good idea to switch off crossover for this case (and maybe \
-presolve as well) - the option 'maybe' does this.");
+presolve as well) - the option 'maybe' does this.  The option 'push' first pushes superbasic variables to bounds \
+and takes out of the basis columns barrier says are nonbasic, in batches of independent pivots.");
     parameters.push_back(p);
   }
 #endif
@@ -2369,10 +2374,21 @@ of dual information to use.  After that it goes back to powers of 2 so -\n\
     p.append("dense");
     p.append("simple");
     p.append("osl");
+#ifndef ABC_INHERIT
+    p.append("parallel");
+#endif
     p.setLonghelp(
 #ifndef ABC_INHERIT
       "The default is to use the normal CoinFactorization, but \
-other choices are a dense one, OSL's, or one designed for small problems."
+other choices are a dense one, OSL's, or one designed for small problems. \
+Parallel uses the thread pool for the dense part of the basis left after \
+singletons are taken out and does that factorization with normal code if that \
+part is large.  Hyper-sparse solves (work depends on size of result) are only \
+in parallel so are not used unless it is chosen.  Parallel is not a general \
+sparse factorization - the part left after singletons is factorized as a \
+dense matrix (no Markowitz ordering, so no control of fill) and only up to \
+5000 rows, and updates are product form.  It is only likely to help when \
+bases are nearly triangular with a small dense kernel."
 #else
       "Normally the default is to use the normal CoinFactorization, but \
 other choices are a dense one, OSL's, or one designed for small problems. \
@@ -3161,6 +3177,20 @@ Setting this option to on keeps original names in variables which still exist in
       CLP_PARAM_ACTION_OUTDUPROWS, 7, 0);
     parameters.push_back(p);
   }
+#endif
+#ifdef COIN_HAS_CLP
+  {
+    CbcOrClpParam p("order!ing", "Ordering for native Cholesky in barrier",
+      "amd", CLP_PARAM_STR_ORDERING, 7, 1);
+    p.append("nested!Dissection");
+    p.append("choose");
+    p.setLonghelp(
+      "The native and supernodal Cholesky factorizations normally use an approximate \
+minimum degree ordering.  nested!Dissection uses nested dissection instead which \
+can give less fill on large problems with a grid like structure.  choose does both \
+and keeps nested dissection only if its predicted factor is at least 10% smaller.");
+    parameters.push_back(p);
+  }
 #endif
   {
     CbcOrClpParam p("output!Format", "Which output format to use",
@@ -3171,7 +3201,8 @@ Setting this option to on keeps original names in variables which still exist in
  to save with absolute accuracy using a coded version of the IEEE value. A value of 2 is normal.\
  otherwise odd values gives one value per line, even two.  Values 1,2 give normal format, 3,4\
  gives greater precision, while 5,6 give IEEE values.  When used for exporting a basis 1 does not save \
-values, 2 saves values, 3 with greater accuracy and 4 in IEEE.");
+values, 2 saves values, 3 with greater accuracy and 4 in IEEE, while 5 writes a binary snapshot \
+of status and 6 a binary snapshot with primal and dual values (read back by basisIn).");
     parameters.push_back(p);
   }
 #ifdef COIN_HAS_CLP
@@ -4164,7 +4195,9 @@ It is possible you can get same effect by using example driver4.cpp.");
       "off", CLP_PARAM_STR_VECTOR, 7, 0);
     p.append("on");
     p.setLonghelp(
-      "If this is on ClpPackedMatrix uses extra column copy in odd format.");
+      "If this is on ClpPackedMatrix uses extra column copy in odd format.  \
+Pricing on that copy uses avx2 or avx512 instructions if the cpu has them \
+(checked at run time).");
     parameters.push_back(p);
 #else
     CbcOrClpParam p("vector", "Try and use vector instructions in simplex",
@@ -184,6 +184,7 @@ enum CbcOrClpParameterType
   CLP_PARAM_STR_TIME_MODE,
   CLP_PARAM_STR_ABCWANTED,
   CLP_PARAM_STR_BUFFER_MODE,
+  CLP_PARAM_STR_ORDERING,
 
   CBC_PARAM_STR_NODESTRATEGY = 301,
   CBC_PARAM_STR_BRANCHSTRATEGY,
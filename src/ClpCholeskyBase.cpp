@@ -70,6 +70,11 @@ ClpCholeskyBase::ClpCholeskyBase(int denseThreshold)
   , denseColumn_(NULL)
   , dense_(NULL)
   , denseThreshold_(denseThreshold)
+  , orderingType_(0)
+  , numberSubtrees_(0)
+  , subtrees_(NULL)
+  , structureHash_(0)
+  , numberReused_(0)
 {
   memset(integerParameters_, 0, 64 * sizeof(int));
   memset(doubleParameters_, 0, 64 * sizeof(double));
@@ -116,6 +121,11 @@ ClpCholeskyBase::ClpCholeskyBase(const ClpCholeskyBase &rhs)
   denseColumn_ = NULL;
   dense_ = NULL;
   denseThreshold_ = rhs.denseThreshold_;
+  orderingType_ = rhs.orderingType_;
+  numberSubtrees_ = rhs.numberSubtrees_;
+  subtrees_ = ClpCopyOfArray(rhs.subtrees_, 2 * numberSubtrees_);
+  structureHash_ = rhs.structureHash_;
+  numberReused_ = rhs.numberReused_;
 }
 
 //-------------------------------------------------------------------
@@ -139,6 +149,7 @@ ClpCholeskyBase::~ClpCholeskyBase()
   delete[] whichDense_;
   delete[] denseColumn_;
   delete dense_;
+  delete[] subtrees_;
 }
 
 //----------------------------------------------------------------
@@ -199,6 +210,12 @@ ClpCholeskyBase::operator=(const ClpCholeskyBase &rhs)
     denseColumn_ = NULL;
     dense_ = NULL;
     denseThreshold_ = rhs.denseThreshold_;
+    orderingType_ = rhs.orderingType_;
+    numberSubtrees_ = rhs.numberSubtrees_;
+    delete[] subtrees_;
+    subtrees_ = ClpCopyOfArray(rhs.subtrees_, 2 * numberSubtrees_);
+    structureHash_ = rhs.structureHash_;
+    numberReused_ = rhs.numberReused_;
   }
   return *this;
 }
@@ -640,6 +657,11 @@ int ClpCholeskyBase::order(ClpInterior *model)
     numberRowsDropped_ = 0;
     memset(rowsDropped_, 0, numberRows_);
     //rowCopy_ = model->clpMatrix()->reverseOrderedCopy();
+    delete[] subtrees_;
+    subtrees_ = NULL;
+    numberSubtrees_ = 0;
+    if (!doKKT_ && orderingType_)
+      return orderND();
     // approximate minimum degree
     return orderAMD();
   }
@@ -780,6 +802,107 @@ int ClpCholeskyBase::order(ClpInterior *model)
   }
   return 0;
 }
+// Adds four bytes of value to FNV-1a hash
+static inline void structureHashAdd(unsigned int &hash, int value)
+{
+  unsigned int bytes = static_cast< unsigned int >(value);
+  for (int iByte = 0; iByte < 4; iByte++) {
+    hash ^= (bytes & 255);
+    hash *= 16777619u;
+    bytes >>= 8;
+  }
+}
+/* Structural hash of dimensions and element positions of
+   matrix of model.  Never returns 0 */
+unsigned int ClpCholeskyBase::computeStructureHash(ClpInterior *model)
+{
+  return computeStructureHash(model->clpMatrix(), model->numberRows(),
+    model->numberColumns());
+}
+/* Structural hash of dimensions and element positions of
+   matrix (may be NULL).  Never returns 0 */
+unsigned int ClpCholeskyBase::computeStructureHash(const ClpMatrixBase *matrix,
+  int numberRows, int numberColumns)
+{
+  unsigned int hash = 2166136261u;
+  structureHashAdd(hash, numberRows);
+  structureHashAdd(hash, numberColumns);
+  if (matrix) {
+    const CoinBigIndex *columnStart = matrix->getVectorStarts();
+    const int *columnLength = matrix->getVectorLengths();
+    const int *row = matrix->getIndices();
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+      CoinBigIndex start = columnStart[iColumn];
+      CoinBigIndex end = start + columnLength[iColumn];
+      structureHashAdd(hash, columnLength[iColumn]);
+      for (CoinBigIndex j = start; j < end; j++)
+        structureHashAdd(hash, row[j]);
+    }
+  }
+  if (!hash)
+    hash = 1;
+  return hash;
+}
+/* Sees if ordering and symbolic factorization can be used again.
+   Returns 0 if kept, 1 if order and symbolic needed */
+int ClpCholeskyBase::reuseSymbolic(ClpInterior *model)
+{
+  // base (AMD or nested dissection), dense and supernodal only
+  if ((type_ != 0 && type_ != 11 && type_ != 18) || doKKT_)
+    return 1;
+  if (!structureHash_ || !model_ || !rowCopy_ || !sparseFactor_ || !rowsDropped_)
+    return 1;
+  if (model->numberRows() != numberRows_ || model->numberRows() != rowCopy_->getNumRows()
+    || model->numberColumns() != rowCopy_->getNumCols())
+    return 1;
+  // quick check - then check exactly
+  if (computeStructureHash(model) != structureHash_)
+    return 1;
+  ClpMatrixBase *rowCopy = model->clpMatrix()->reverseOrderedCopy();
+  if (!rowCopy)
+    return 1;
+  bool same = rowCopy->getNumElements() == rowCopy_->getNumElements();
+  if (same) {
+    const CoinBigIndex *rowStart = rowCopy_->getVectorStarts();
+    const int *rowLength = rowCopy_->getVectorLengths();
+    const int *column = rowCopy_->getIndices();
+    const CoinBigIndex *rowStartNew = rowCopy->getVectorStarts();
+    const int *rowLengthNew = rowCopy->getVectorLengths();
+    const int *columnNew = rowCopy->getIndices();
+    for (int iRow = 0; iRow < numberRows_; iRow++) {
+      int length = rowLength[iRow];
+      if (length != rowLengthNew[iRow]) {
+        same = false;
+        break;
+      }
+      const int *columnThis = column + rowStart[iRow];
+      const int *columnThisNew = columnNew + rowStartNew[iRow];
+      for (int j = 0; j < length; j++) {
+        if (columnThis[j] != columnThisNew[j]) {
+          same = false;
+          break;
+        }
+      }
+      if (!same)
+        break;
+    }
+  }
+  if (!same) {
+    delete rowCopy;
+    return 1;
+  }
+  // same pattern - keep ordering and symbolic, take new elements
+  delete rowCopy_;
+  rowCopy_ = rowCopy;
+  model_ = model;
+  resetRowsDropped();
+  status_ = 0;
+  numberReused_++;
+  if (model_->messageHandler()->logLevel() > 1)
+    std::cout << "Reusing ordering and symbolic factorization - "
+              << sizeFactor_ << " elements in factor" << std::endl;
+  return 0;
+}
 #if BASE_ORDER == 1
 /* Orders rows and saves pointer to matrix.and model */
 int ClpCholeskyBase::orderAMD()
@@ -1957,6 +2080,397 @@ int ClpCholeskyBase::orderAMD()
   choleskyStart_ = NULL;
   return returnCode;
 }
+// Size of part below which nested dissection uses AMD
+#define ND_LEAF_SIZE 128
+/* Breadth first search from root within part (inPart[i]==tag).
+   level must be -1 for vertices of part.  Vertices reached go in queue.
+   Returns number of levels */
+static int ndLevels(int root, int tag, const int *start, const int *adjacency,
+  const int *inPart, int *level, int *queue, int &numberReached)
+{
+  int nQueue = 1;
+  queue[0] = root;
+  level[root] = 0;
+  for (int k = 0; k < nQueue; k++) {
+    int iRow = queue[k];
+    int nextLevel = level[iRow] + 1;
+    for (int j = start[iRow]; j < start[iRow + 1]; j++) {
+      int jRow = adjacency[j];
+      if (inPart[jRow] == tag && level[jRow] < 0) {
+        level[jRow] = nextLevel;
+        queue[nQueue++] = jRow;
+      }
+    }
+  }
+  numberReached = nQueue;
+  return level[queue[nQueue - 1]] + 1;
+}
+/* Orders a part in place using AMD on its subgraph.
+   local is work array */
+static void ndOrderLeaf(int *list, int number, int tag, const int *start,
+  const int *adjacency, const int *inPart, int *local, int speed)
+{
+  if (number < NORDTHRESH)
+    return;
+  int numberElements = 0;
+  for (int k = 0; k < number; k++) {
+    int iRow = list[k];
+    local[iRow] = k;
+    for (int j = start[iRow]; j < start[iRow + 1]; j++) {
+      if (inPart[adjacency[j]] == tag)
+        numberElements++;
+    }
+  }
+  int space = numberElements + 4 * number + 10000;
+  int *temp = new int[space];
+  int *tempStart = new int[number + 1];
+  int *use = new int[9 * number];
+  int *dgree = use;
+  int *varbl = dgree + number;
+  int *snxt = varbl + number;
+  int *head = snxt + number;
+  int *lsize = head + number;
+  int *flag = lsize + number;
+  int *erscore = flag + number;
+  int *perm = erscore + number;
+  int *invp = perm + number;
+  numberElements = 0;
+  for (int k = 0; k < number; k++) {
+    int iRow = list[k];
+    tempStart[k] = numberElements + OFFSET;
+    for (int j = start[iRow]; j < start[iRow + 1]; j++) {
+      int jRow = adjacency[j];
+      if (inPart[jRow] == tag)
+        temp[numberElements++] = local[jRow] + OFFSET;
+    }
+  }
+  tempStart[number] = numberElements + OFFSET;
+  for (int i = 0; i < number; i++) {
+    dgree[i] = tempStart[i + 1] - tempStart[i];
+    snxt[i] = 0;
+    perm[i] = 0;
+    invp[i] = 0;
+    head[i] = 0;
+    flag[i] = 1;
+    varbl[i] = 1;
+    lsize[i] = dgree[i];
+  }
+  if (speed < 3) {
+    for (int i = 0; i < number; i++)
+      erscore[i] = dgree[i];
+  } else {
+    erscore = dgree;
+  }
+  myamlf(number, tempStart, temp, dgree, varbl, snxt, perm, invp,
+    head, lsize, flag, erscore, numberElements + OFFSET, space, speed);
+  for (int k = 0; k < number; k++)
+    invp[k] = list[perm[k] - 1];
+  CoinMemcpyN(invp, number, list);
+  delete[] use;
+  delete[] tempStart;
+  delete[] temp;
+}
+/* Nested dissection of graph (no diagonal) by level structure
+   separators.  permute gets new to old.  subtrees gets first and last+1
+   of parts which were not split further (these are independent).
+   Returns number of such parts */
+static int ndOrder(int n, const int *start, const int *adjacency, int speed,
+  int *permute, int *subtrees)
+{
+  int *inPart = new int[6 * n + 2];
+  int *level = inPart + n;
+  int *queue = level + n;
+  int *count = queue + n;
+  int *stack = count + n;
+  for (int i = 0; i < n; i++) {
+    inPart[i] = -1;
+    permute[i] = i;
+  }
+  int numberSubtrees = 0;
+  int nStack = 0;
+  stack[nStack++] = 0;
+  stack[nStack++] = n;
+  int tag = 0;
+  while (nStack) {
+    int last = stack[--nStack];
+    int first = stack[--nStack];
+    int *list = permute + first;
+    int number = last - first;
+    tag++;
+    for (int k = 0; k < number; k++) {
+      int iRow = list[k];
+      inPart[iRow] = tag;
+      level[iRow] = -1;
+    }
+    bool leaf = (number <= ND_LEAF_SIZE);
+    if (!leaf) {
+      // find components
+      int numberComponents = 0;
+      int nQueue = 0;
+      for (int k = 0; k < number; k++) {
+        int iRow = list[k];
+        if (level[iRow] < 0) {
+          int numberReached;
+          ndLevels(iRow, tag, start, adjacency, inPart, level,
+            queue + nQueue, numberReached);
+          count[numberComponents++] = numberReached;
+          nQueue += numberReached;
+        }
+      }
+      if (numberComponents > 1) {
+        // components are independent - group small ones together
+        CoinMemcpyN(queue, number, list);
+        int nGroup = 0;
+        int put = first;
+        int groupSize = 0;
+        for (int i = 0; i < numberComponents; i++) {
+          int size = count[i];
+          if (groupSize && groupSize + size > ND_LEAF_SIZE) {
+            queue[nGroup++] = put;
+            groupSize = 0;
+          }
+          put += size;
+          groupSize += size;
+        }
+        queue[nGroup++] = put;
+        // so first group is done first
+        for (int i = nGroup - 1; i >= 0; i--) {
+          stack[nStack++] = i ? queue[i - 1] : first;
+          stack[nStack++] = queue[i];
+        }
+        continue;
+      }
+      // pseudo-peripheral root - start from minimum degree
+      int root = list[0];
+      for (int k = 1; k < number; k++) {
+        int iRow = list[k];
+        if (start[iRow + 1] - start[iRow] < start[root + 1] - start[root])
+          root = iRow;
+      }
+      int numberReached;
+      for (int k = 0; k < number; k++)
+        level[list[k]] = -1;
+      int numberLevels = ndLevels(root, tag, start, adjacency, inPart, level,
+        queue, numberReached);
+      for (int pass = 0; pass < 4; pass++) {
+        // minimum degree in last level
+        int best = queue[number - 1];
+        for (int k = number - 2; k >= 0; k--) {
+          int iRow = queue[k];
+          if (level[iRow] < numberLevels - 1)
+            break;
+          if (start[iRow + 1] - start[iRow] < start[best + 1] - start[best])
+            best = iRow;
+        }
+        for (int k = 0; k < number; k++)
+          level[list[k]] = -1;
+        int numberLevels2 = ndLevels(best, tag, start, adjacency, inPart, level,
+          queue, numberReached);
+        if (numberLevels2 > numberLevels) {
+          root = best;
+          numberLevels = numberLevels2;
+        } else {
+          if (numberLevels2 < numberLevels) {
+            // go back
+            for (int k = 0; k < number; k++)
+              level[list[k]] = -1;
+            ndLevels(root, tag, start, adjacency, inPart, level,
+              queue, numberReached);
+          }
+          break;
+        }
+      }
+      // choose smallest reasonably balanced level as separator
+      for (int i = 0; i < numberLevels; i++)
+        count[i] = 0;
+      for (int k = 0; k < number; k++)
+        count[level[list[k]]]++;
+      int minimumSide = number / 5;
+      int bestLevel = -1;
+      int bestSize = COIN_INT_MAX;
+      int bestImbalance = COIN_INT_MAX;
+      int below = count[0];
+      for (int i = 1; i < numberLevels - 1; i++) {
+        int above = number - below - count[i];
+        if (below >= minimumSide && above >= minimumSide) {
+          int imbalance = CoinAbs(above - below);
+          if (count[i] < bestSize || (count[i] == bestSize && imbalance < bestImbalance)) {
+            bestLevel = i;
+            bestSize = count[i];
+            bestImbalance = imbalance;
+          }
+        }
+        below += count[i];
+      }
+      if (bestLevel < 0) {
+        leaf = true;
+      } else {
+        // 0 first part, 1 separator, 2 second part
+        int nBelow = 0;
+        for (int k = 0; k < number; k++) {
+          int iRow = list[k];
+          int iLevel = level[iRow];
+          if (iLevel < bestLevel) {
+            level[iRow] = 0;
+            nBelow++;
+          } else if (iLevel > bestLevel) {
+            level[iRow] = 2;
+          } else {
+            level[iRow] = 1;
+          }
+        }
+        // move separator vertices not touching other part - smaller side first
+        int side = (2 * nBelow < number - bestSize) ? 0 : 2;
+        for (int pass = 0; pass < 2; pass++) {
+          int other = 2 - side;
+          for (int k = 0; k < number; k++) {
+            int iRow = list[k];
+            if (level[iRow] == 1) {
+              bool touches = false;
+              for (int j = start[iRow]; j < start[iRow + 1]; j++) {
+                int jRow = adjacency[j];
+                if (inPart[jRow] == tag && level[jRow] == other) {
+                  touches = true;
+                  break;
+                }
+              }
+              if (!touches)
+                level[iRow] = side;
+            }
+          }
+          side = other;
+        }
+        int nPart[3] = { 0, 0, 0 };
+        for (int k = 0; k < number; k++)
+          nPart[level[list[k]]]++;
+        int put[3];
+        put[0] = 0;
+        put[2] = nPart[0];
+        put[1] = nPart[0] + nPart[2];
+        for (int k = 0; k < number; k++) {
+          int iRow = list[k];
+          queue[put[level[iRow]]++] = iRow;
+        }
+        CoinMemcpyN(queue, number, list);
+        // separator goes last
+        stack[nStack++] = first + nPart[0];
+        stack[nStack++] = first + nPart[0] + nPart[2];
+        stack[nStack++] = first;
+        stack[nStack++] = first + nPart[0];
+      }
+    }
+    if (leaf) {
+      ndOrderLeaf(list, number, tag, start, adjacency, inPart, count, speed);
+      subtrees[2 * numberSubtrees] = first;
+      subtrees[2 * numberSubtrees + 1] = last;
+      numberSubtrees++;
+    }
+  }
+  delete[] inPart;
+  return numberSubtrees;
+}
+/* Predicted number of elements in factor (including diagonal) for
+   ordering permute.  Walks row subtrees of elimination tree */
+static double ndFactorSize(int n, const int *start, const int *adjacency,
+  const int *permute, int *work)
+{
+  int *permuteInverse = work;
+  int *parent = work + n;
+  int *mark = parent + n;
+  for (int i = 0; i < n; i++)
+    permuteInverse[permute[i]] = i;
+  double size = n;
+  for (int k = 0; k < n; k++) {
+    int iRow = permute[k];
+    parent[k] = -1;
+    mark[k] = k;
+    for (int j = start[iRow]; j < start[iRow + 1]; j++) {
+      int i = permuteInverse[adjacency[j]];
+      if (i < k) {
+        for (; mark[i] != k; i = parent[i]) {
+          mark[i] = k;
+          size++;
+          if (parent[i] < 0)
+            parent[i] = k;
+        }
+      }
+    }
+  }
+  return size;
+}
+// Nested dissection ordering (may keep AMD if orderingType_ 2)
+int ClpCholeskyBase::orderND()
+{
+  // full graph without diagonal
+  int *graphStart = new int[numberRows_ + 1];
+  int *count = new int[numberRows_];
+  CoinZeroN(count, numberRows_);
+  for (int iRow = 0; iRow < numberRows_; iRow++) {
+    count[iRow] += static_cast< int >(choleskyStart_[iRow + 1] - choleskyStart_[iRow] - 1);
+    for (CoinBigIndex j = choleskyStart_[iRow] + 1; j < choleskyStart_[iRow + 1]; j++) {
+      int jRow = choleskyRow_[j];
+      count[jRow]++;
+    }
+  }
+  int numberElements = 0;
+  for (int iRow = 0; iRow < numberRows_; iRow++) {
+    graphStart[iRow] = numberElements;
+    numberElements += count[iRow];
+    count[iRow] = graphStart[iRow];
+  }
+  graphStart[numberRows_] = numberElements;
+  int *graph = new int[numberElements];
+  for (int iRow = 0; iRow < numberRows_; iRow++) {
+    assert(choleskyRow_[choleskyStart_[iRow]] == iRow);
+    for (CoinBigIndex j = choleskyStart_[iRow] + 1; j < choleskyStart_[iRow + 1]; j++) {
+      int jRow = choleskyRow_[j];
+      graph[count[iRow]++] = jRow;
+      graph[count[jRow]++] = iRow;
+    }
+  }
+  delete[] count;
+  int speed = integerParameters_[0];
+  if (speed < 1 || speed > 2)
+    speed = 3;
+  int *ndPermute = new int[numberRows_];
+  int *subtrees = new int[2 * numberRows_];
+  int numberSubtrees = ndOrder(numberRows_, graphStart, graph, speed,
+    ndPermute, subtrees);
+  int returnCode = 0;
+  bool useND = true;
+  if (orderingType_ == 2) {
+    // AMD as well and keep smaller
+    returnCode = orderAMD();
+    int *work = new int[3 * numberRows_];
+    double sizeND = ndFactorSize(numberRows_, graphStart, graph, ndPermute, work);
+    double sizeAMD = ndFactorSize(numberRows_, graphStart, graph, permute_, work);
+    delete[] work;
+    // AMD unless clearly better
+    useND = sizeND < 0.9 * sizeAMD;
+    if (model_->messageHandler()->logLevel() > 1)
+      std::cout << "Predicted Cholesky size " << sizeAMD << " with AMD, "
+                << sizeND << " with nested dissection" << std::endl;
+  } else {
+    permuteInverse_ = new int[numberRows_];
+    permute_ = new int[numberRows_];
+    delete[] choleskyRow_;
+    choleskyRow_ = NULL;
+    delete[] choleskyStart_;
+    choleskyStart_ = NULL;
+  }
+  if (useND) {
+    CoinMemcpyN(ndPermute, numberRows_, permute_);
+    for (int iRow = 0; iRow < numberRows_; iRow++)
+      permuteInverse_[permute_[iRow]] = iRow;
+    numberSubtrees_ = numberSubtrees;
+    subtrees_ = ClpCopyOfArray(subtrees, 2 * numberSubtrees);
+  }
+  delete[] subtrees;
+  delete[] ndPermute;
+  delete[] graph;
+  delete[] graphStart;
+  return returnCode;
+}
 /* Does Symbolic factorization given permutation.
    This is called immediately after order.  If user provides this then
    user must provide factorize and solve.  Otherwise the default factorization is used
@@ -2717,6 +3231,86 @@ void ClpCholeskyBase::symbolic2(const int *Astart, const int *Arow)
   //clique_[iRow]=0;
 }
 /* Factorize - filling in rowsDropped and returning number dropped */
+typedef struct {
+  ClpCholeskyBase *factor;
+  const CoinWorkDouble *diagonal;
+  longDouble *work;
+  int firstRow;
+  int lastRow;
+  CoinWorkDouble largest;
+} clpAssembleInfo;
+static void assembleBit(clpAssembleInfo &info)
+{
+  info.largest = info.factor->assembleRows(info.firstRow, info.lastRow,
+    info.diagonal, info.work);
+}
+/* Puts A*D*A' for rows firstRow to lastRow-1 of factor into sparseFactor_
+   and diagonal_.  work must be zero and is left zero.
+   Returns largest absolute value */
+CoinWorkDouble ClpCholeskyBase::assembleRows(int firstRow, int lastRow,
+  const CoinWorkDouble *diagonal, longDouble *work)
+{
+  const CoinBigIndex *columnStart = model_->clpMatrix()->getVectorStarts();
+  const int *columnLength = model_->clpMatrix()->getVectorLengths();
+  const int *row = model_->clpMatrix()->getIndices();
+  const double *element = model_->clpMatrix()->getElements();
+  const CoinBigIndex *rowStart = rowCopy_->getVectorStarts();
+  const int *rowLength = rowCopy_->getVectorLengths();
+  const int *column = rowCopy_->getIndices();
+  const double *elementByRow = rowCopy_->getElements();
+  int numberColumns = model_->clpMatrix()->getNumCols();
+  const CoinWorkDouble *diagonalSlack = diagonal + numberColumns;
+  CoinWorkDouble delta2 = model_->delta(); // add delta*delta to diagonal
+  delta2 *= delta2;
+  CoinWorkDouble largest2 = 0.0;
+  for (int iRow = firstRow; iRow < lastRow; iRow++) {
+    longDouble *put = sparseFactor_ + choleskyStart_[iRow];
+    int *which = choleskyRow_ + indexStart_[iRow];
+    int iOriginalRow = permute_[iRow];
+    int number = choleskyStart_[iRow + 1] - choleskyStart_[iRow];
+    if (!rowLength[iOriginalRow])
+      rowsDropped_[iOriginalRow] = 1;
+    if (!rowsDropped_[iOriginalRow]) {
+      CoinBigIndex startRow = rowStart[iOriginalRow];
+      CoinBigIndex endRow = rowStart[iOriginalRow] + rowLength[iOriginalRow];
+      work[iRow] = diagonalSlack[iOriginalRow] + delta2;
+      for (CoinBigIndex k = startRow; k < endRow; k++) {
+        int iColumn = column[k];
+        if (!whichDense_ || !whichDense_[iColumn]) {
+          CoinBigIndex start = columnStart[iColumn];
+          CoinBigIndex end = columnStart[iColumn] + columnLength[iColumn];
+          CoinWorkDouble multiplier = diagonal[iColumn] * elementByRow[k];
+          for (CoinBigIndex j = start; j < end; j++) {
+            int jRow = row[j];
+            int jNewRow = permuteInverse_[jRow];
+            if (jNewRow >= iRow && !rowsDropped_[jRow]) {
+              CoinWorkDouble value = element[j] * multiplier;
+              work[jNewRow] += value;
+            }
+          }
+        }
+      }
+      diagonal_[iRow] = work[iRow];
+      largest2 = CoinMax(largest2, CoinAbs(work[iRow]));
+      work[iRow] = 0.0;
+      int j;
+      for (j = 0; j < number; j++) {
+        int jRow = which[j];
+        put[j] = work[jRow];
+        largest2 = CoinMax(largest2, CoinAbs(work[jRow]));
+        work[jRow] = 0.0;
+      }
+    } else {
+      // dropped
+      diagonal_[iRow] = 1.0;
+      int j;
+      for (j = 1; j < number; j++) {
+        put[j] = 0.0;
+      }
+    }
+  }
+  return largest2;
+}
 int ClpCholeskyBase::factorize(const CoinWorkDouble *diagonal, int *rowsDropped)
 {
   const CoinBigIndex *columnStart = model_->clpMatrix()->getVectorStarts();
@@ -2748,7 +3342,6 @@ int ClpCholeskyBase::factorize(const CoinWorkDouble *diagonal, int *rowsDropped)
   CoinWorkDouble smallest = COIN_DBL_MAX;
   int numberDense = 0;
   if (!doKKT_) {
-    const CoinWorkDouble *diagonalSlack = diagonal + numberColumns;
     if (dense_)
       numberDense = dense_->numberRows();
     if (whichDense_) {
@@ -2773,55 +3366,40 @@ int ClpCholeskyBase::factorize(const CoinWorkDouble *diagonal, int *rowsDropped)
         }
       }
     }
-    CoinWorkDouble delta2 = model_->delta(); // add delta*delta to diagonal
-    delta2 *= delta2;
     // largest in initial matrix
     CoinWorkDouble largest2 = 1.0e-20;
-    for (iRow = 0; iRow < numberRows_; iRow++) {
-      longDouble *put = sparseFactor_ + choleskyStart_[iRow];
-      int *which = choleskyRow_ + indexStart_[iRow];
-      int iOriginalRow = permute_[iRow];
-      int number = choleskyStart_[iRow + 1] - choleskyStart_[iRow];
-      if (!rowLength[iOriginalRow])
-        rowsDropped_[iOriginalRow] = 1;
-      if (!rowsDropped_[iOriginalRow]) {
-        CoinBigIndex startRow = rowStart[iOriginalRow];
-        CoinBigIndex endRow = rowStart[iOriginalRow] + rowLength[iOriginalRow];
-        work[iRow] = diagonalSlack[iOriginalRow] + delta2;
-        for (CoinBigIndex k = startRow; k < endRow; k++) {
-          int iColumn = column[k];
-          if (!whichDense_ || !whichDense_[iColumn]) {
-            CoinBigIndex start = columnStart[iColumn];
-            CoinBigIndex end = columnStart[iColumn] + columnLength[iColumn];
-            CoinWorkDouble multiplier = diagonal[iColumn] * elementByRow[k];
-            for (CoinBigIndex j = start; j < end; j++) {
-              int jRow = row[j];
-              int jNewRow = permuteInverse_[jRow];
-              if (jNewRow >= iRow && !rowsDropped_[jRow]) {
-                CoinWorkDouble value = element[j] * multiplier;
-                work[jNewRow] += value;
-              }
-            }
-          }
-        }
-        diagonal_[iRow] = work[iRow];
-        largest2 = CoinMax(largest2, CoinAbs(work[iRow]));
-        work[iRow] = 0.0;
-        int j;
-        for (j = 0; j < number; j++) {
-          int jRow = which[j];
-          put[j] = work[jRow];
-          largest2 = CoinMax(largest2, CoinAbs(work[jRow]));
-          work[jRow] = 0.0;
-        }
-      } else {
-        // dropped
-        diagonal_[iRow] = 1.0;
-        int j;
-        for (j = 1; j < number; j++) {
-          put[j] = 0.0;
+    // A*D*A' by blocks of rows of factor - possibly in parallel
+    int numberThreads = (numberRows_ >= 1000) ? clpParallelThreads() : 1;
+    if (numberThreads > 1) {
+      clpAssembleInfo *info = new clpAssembleInfo[numberThreads];
+      // split so about same number of elements in each
+      CoinBigIndex numberElements = choleskyStart_[numberRows_];
+      int nextRow = 0;
+      for (int i = 0; i < numberThreads; i++) {
+        info[i].factor = this;
+        info[i].diagonal = diagonal;
+        info[i].firstRow = nextRow;
+        CoinBigIndex target = (numberElements * (i + 1)) / numberThreads;
+        if (i < numberThreads - 1) {
+          while (nextRow < numberRows_ && choleskyStart_[nextRow] < target)
+            nextRow++;
+        } else {
+          nextRow = numberRows_;
         }
+        info[i].lastRow = nextRow;
+        info[i].work = i ? new longDouble[numberRows_] : work;
+        if (i)
+          CoinZeroN(info[i].work, numberRows_);
+      }
+      clpParallelFor(assembleBit, info, numberThreads);
+      for (int i = 0; i < numberThreads; i++) {
+        largest2 = CoinMax(largest2, info[i].largest);
+        if (i)
+          delete[] info[i].work;
       }
+      delete[] info;
+    } else {
+      largest2 = CoinMax(largest2, assembleRows(0, numberRows_, diagonal, work));
     }
     //check sizes
     largest2 *= 1.0e-20;
@@ -3744,6 +4322,13 @@ void ClpCholeskyBase::solve(CoinWorkDouble *region)
     solve(region, 2);
   }
 }
+/* Uses factorization to solve several right hand sides.
+   Default is one at a time */
+void ClpCholeskyBase::solveMultiple(CoinWorkDouble *region, int numberRhs)
+{
+  for (int i = 0; i < numberRhs; i++)
+    solve(region + i * numberRows_);
+}
 /* solve - 1 just first half, 2 just second half - 3 both.
    If 1 and 2 then diagonal has sqrt of inverse otherwise inverse
 */
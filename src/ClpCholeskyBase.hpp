@@ -68,11 +68,22 @@ public:
          user must provide factorize and solve.  Otherwise the default factorization is used
          returns non-zero if not enough memory */
   virtual int symbolic();
+  /** Sees if ordering and symbolic factorization from last order and
+      symbolic can be used for model (same sparsity pattern).
+      Checks structureHash() and then pattern exactly.
+      If so refreshes row copy and saves model and returns 0.
+      Returns 1 if order and symbolic must be done.
+      Only native factorizations of normal equations can be reused */
+  virtual int reuseSymbolic(ClpInterior *model);
   /** Factorize - filling in rowsDropped and returning number dropped.
          If return code negative then out of memory */
   virtual int factorize(const CoinWorkDouble *diagonal, int *rowsDropped);
   /** Uses factorization to solve. */
   virtual void solve(CoinWorkDouble *region);
+  /** Uses factorization to solve numberRhs right hand sides stored
+      one after another (each numberRows() long).
+      Default just does one at a time */
+  virtual void solveMultiple(CoinWorkDouble *region, int numberRhs);
   /** Uses factorization to solve. - given as if KKT.
       region1 is rows+columns, region2 is rows */
   virtual void solveKKT(CoinWorkDouble *region1, CoinWorkDouble *region2, const CoinWorkDouble *diagonal,
@@ -81,6 +92,10 @@ public:
 private:
   /// AMD ordering
   int orderAMD();
+  /** Nested dissection ordering of A*A' (from preOrder).
+      If orderingType_ is 2 also does AMD and keeps ordering with
+      smaller predicted factor */
+  int orderND();
 
 public:
   //@}
@@ -179,6 +194,54 @@ public:
   {
     return doubleParameters_[i];
   }
+  /** Ordering used by native order.
+      0 - AMD (default)
+      1 - nested dissection
+      2 - both and keep one with smaller predicted fill */
+  inline int orderingType() const
+  {
+    return orderingType_;
+  }
+  /// Set ordering used by native order
+  inline void setOrderingType(int value)
+  {
+    orderingType_ = value;
+  }
+  /** Number of independent subtrees found by nested dissection
+      (0 if not used) */
+  inline int numberSubtrees() const
+  {
+    return numberSubtrees_;
+  }
+  /** First and last+1 permuted row of each independent subtree.
+      Subtrees share no entries in factorization so can be done in parallel */
+  inline const int *subtrees() const
+  {
+    return subtrees_;
+  }
+  /** Structural hash of matrix used for last order and symbolic
+      (0 if symbolic factorization not valid) */
+  inline unsigned int structureHash() const
+  {
+    return structureHash_;
+  }
+  /// Set structural hash (0 says symbolic factorization not valid)
+  inline void setStructureHash(unsigned int value)
+  {
+    structureHash_ = value;
+  }
+  /// Number of times reuseSymbolic kept ordering and symbolic factorization
+  inline int numberReused() const
+  {
+    return numberReused_;
+  }
+  /** Structural hash of sparsity pattern of matrix of model (never 0).
+      Only depends on dimensions and positions of elements */
+  static unsigned int computeStructureHash(ClpInterior *model);
+  /** Structural hash of dimensions and sparsity pattern of matrix
+      (never 0).  Also used to check a saved basis is for model */
+  static unsigned int computeStructureHash(const ClpMatrixBase *matrix,
+    int numberRows, int numberColumns);
   //@}
 
 public:
@@ -199,6 +262,11 @@ public:
   ///@name Other
   /// Clone
   virtual ClpCholeskyBase *clone() const;
+  /** Puts A*D*A' for (permuted) rows firstRow to lastRow-1 into factor.
+      work must be zero and is left zero.  Returns largest absolute value.
+      Used by factorize (possibly in parallel) */
+  CoinWorkDouble assembleRows(int firstRow, int lastRow,
+    const CoinWorkDouble *diagonal, longDouble *work);
 
   /// Returns type
   inline int type() const
@@ -313,6 +381,16 @@ protected:
   ClpCholeskyDense *dense_;
   /// Dense threshold (for taking out of Cholesky)
   int denseThreshold_;
+  /// Ordering type (0 AMD, 1 nested dissection, 2 best of both)
+  int orderingType_;
+  /// Number of independent subtrees
+  int numberSubtrees_;
+  /// First and last+1 permuted row of each subtree
+  int *subtrees_;
+  /// Structural hash of matrix for symbolic factorization (0 none)
+  unsigned int structureHash_;
+  /// Number of times ordering and symbolic factorization reused
+  int numberReused_;
   //@}
 };
 
@@ -1247,76 +1247,167 @@ void ClpCholeskyDense::solve(CoinWorkDouble *region)
     diagonal_ = yy;
   }
 #endif
-  /*longDouble * xx = sparseFactor_;*/
-  /*longDouble * yy = diagonal_;*/
-  /*diagonal_ = sparseFactor_ + 40000;*/
-  /*sparseFactor_=diagonal_ + numberRows_;*/
+  solveMultiple(region, 1);
+#ifdef CHOL_COMPARE
+  if (numberRows_ < 200) {
+    for (int i = 0; i < numberRows_; i++) {
+      assert(CoinAbs(region[i] - region2[i]) < 1.0e-3);
+    }
+    delete[] region2;
+  }
+#endif
+}
+// Width of panel (in blocks) in solve
+#define SOLVE_PANEL 8
+// Position (in blocks) of block jBlock of block column iBlock
+static inline int blockOffset(int iBlock, int jBlock, int numberBlocks)
+{
+  return iBlock * numberBlocks - ((iBlock * (iBlock - 1)) >> 1) + jBlock - iBlock;
+}
+typedef struct {
+  ClpCholeskyDense *factor;
+  longDouble *a;
+  CoinWorkDouble *region;
+  int numberRows;
+  int numberRhs;
+  int numberBlocks;
+  int firstPanel;
+  int lastPanel;
+  int first;
+  int last;
+  int forward;
+} clpDenseSolveInfo;
+/* Forward - updates blocks first to last-1 (below panel) from panel.
+   Backward - updates panel blocks first to last-1 from blocks below panel */
+static void denseSolveBit(clpDenseSolveInfo &info)
+{
+  ClpCholeskyDense *factor = info.factor;
+  longDouble *a = info.a;
+  int numberRows = info.numberRows;
+  int numberRhs = info.numberRhs;
+  int numberBlocks = info.numberBlocks;
+  if (info.forward) {
+    for (int jBlock = info.first; jBlock < info.last; jBlock++) {
+      int base = jBlock * BLOCK;
+      int nChunk = CoinMin(BLOCK, numberRows - base);
+      for (int iBlock = info.firstPanel; iBlock < info.lastPanel; iBlock++) {
+        longDouble *aa = a + number_entries(blockOffset(iBlock, jBlock, numberBlocks));
+        for (int k = 0; k < numberRhs; k++) {
+          CoinWorkDouble *region = info.region + k * numberRows;
+          factor->solveF2(aa, nChunk, region + iBlock * BLOCK, region + base);
+        }
+      }
+    }
+  } else {
+    for (int iBlock = info.first; iBlock < info.last; iBlock++) {
+      for (int jBlock = numberBlocks - 1; jBlock >= info.lastPanel; jBlock--) {
+        int base = jBlock * BLOCK;
+        int nChunk = CoinMin(BLOCK, numberRows - base);
+        longDouble *aa = a + number_entries(blockOffset(iBlock, jBlock, numberBlocks));
+        for (int k = 0; k < numberRhs; k++) {
+          CoinWorkDouble *region = info.region + k * numberRows;
+          factor->solveB2(aa, nChunk, region + iBlock * BLOCK, region + base);
+        }
+      }
+    }
+  }
+}
+/* Uses factorization to solve several right hand sides in one pass.
+   Block columns are taken in panels.  Triangle of panel is done serially
+   and rectangle below panel in parallel.  Operations on each element are
+   in same order whatever number of threads */
+void ClpCholeskyDense::solveMultiple(CoinWorkDouble *region, int numberRhs)
+{
   int numberBlocks = (numberRows_ + BLOCK - 1) >> BLOCKSHIFT;
   /* later align on boundary*/
   longDouble *a = sparseFactor_ + BLOCKSQ * numberBlocks;
-  int iBlock;
-  longDouble *aa = a;
-  int iColumn;
-  for (iBlock = 0; iBlock < numberBlocks; iBlock++) {
-    int nChunk;
-    int jBlock;
-    int iDo = iBlock * BLOCK;
-    int base = iDo;
-    if (iDo + BLOCK > numberRows_) {
-      nChunk = numberRows_ - iDo;
-    } else {
-      nChunk = BLOCK;
+  int numberThreads = clpParallelThreads();
+  // not worth it if small
+  if (numberBlocks < 4 * SOLVE_PANEL)
+    numberThreads = 1;
+  clpDenseSolveInfo *info = new clpDenseSolveInfo[numberThreads];
+  for (int i = 0; i < numberThreads; i++) {
+    info[i].factor = this;
+    info[i].a = a;
+    info[i].region = region;
+    info[i].numberRows = numberRows_;
+    info[i].numberRhs = numberRhs;
+    info[i].numberBlocks = numberBlocks;
+  }
+  for (int firstPanel = 0; firstPanel < numberBlocks; firstPanel += SOLVE_PANEL) {
+    int lastPanel = CoinMin(firstPanel + SOLVE_PANEL, numberBlocks);
+    for (int iBlock = firstPanel; iBlock < lastPanel; iBlock++) {
+      int iDo = iBlock * BLOCK;
+      int nChunk = CoinMin(BLOCK, numberRows_ - iDo);
+      longDouble *aa = a + number_entries(blockOffset(iBlock, iBlock, numberBlocks));
+      for (int k = 0; k < numberRhs; k++)
+        solveF1(aa, nChunk, region + k * numberRows_ + iDo);
+      for (int jBlock = iBlock + 1; jBlock < lastPanel; jBlock++) {
+        int base = jBlock * BLOCK;
+        nChunk = CoinMin(BLOCK, numberRows_ - base);
+        aa += BLOCKSQ;
+        for (int k = 0; k < numberRhs; k++)
+          solveF2(aa, nChunk, region + k * numberRows_ + iDo,
+            region + k * numberRows_ + base);
+      }
     }
-    solveF1(aa, nChunk, region + iDo);
-    for (jBlock = iBlock + 1; jBlock < numberBlocks; jBlock++) {
-      base += BLOCK;
-      aa += BLOCKSQ;
-      if (base + BLOCK > numberRows_) {
-        nChunk = numberRows_ - base;
-      } else {
-        nChunk = BLOCK;
+    int numberBelow = numberBlocks - lastPanel;
+    if (numberBelow) {
+      int numberTasks = CoinMin(numberThreads, numberBelow);
+      for (int i = 0; i < numberTasks; i++) {
+        info[i].firstPanel = firstPanel;
+        info[i].lastPanel = lastPanel;
+        info[i].first = lastPanel + (i * numberBelow) / numberTasks;
+        info[i].last = lastPanel + ((i + 1) * numberBelow) / numberTasks;
+        info[i].forward = 1;
       }
-      solveF2(aa, nChunk, region + iDo, region + base);
+      if (numberTasks > 1)
+        clpParallelFor(denseSolveBit, info, numberTasks);
+      else
+        denseSolveBit(info[0]);
     }
-    aa += BLOCKSQ;
   }
   /* do diagonal outside*/
-  for (iColumn = 0; iColumn < numberRows_; iColumn++)
-    region[iColumn] *= diagonal_[iColumn];
-  int offset = ((numberBlocks * (numberBlocks + 1)) >> 1);
-  aa = a + number_entries(offset - 1);
-  int lBase = (numberBlocks - 1) * BLOCK;
-  for (iBlock = numberBlocks - 1; iBlock >= 0; iBlock--) {
-    int nChunk;
-    int jBlock;
-    int triBase = iBlock * BLOCK;
-    int iBase = lBase;
-    for (jBlock = iBlock + 1; jBlock < numberBlocks; jBlock++) {
-      if (iBase + BLOCK > numberRows_) {
-        nChunk = numberRows_ - iBase;
-      } else {
-        nChunk = BLOCK;
+  for (int k = 0; k < numberRhs; k++) {
+    CoinWorkDouble *regionK = region + k * numberRows_;
+    for (int iColumn = 0; iColumn < numberRows_; iColumn++)
+      regionK[iColumn] *= diagonal_[iColumn];
+  }
+  int firstPanel = ((numberBlocks - 1) / SOLVE_PANEL) * SOLVE_PANEL;
+  for (; firstPanel >= 0; firstPanel -= SOLVE_PANEL) {
+    int lastPanel = CoinMin(firstPanel + SOLVE_PANEL, numberBlocks);
+    if (lastPanel < numberBlocks) {
+      int numberInPanel = lastPanel - firstPanel;
+      int numberTasks = CoinMin(numberThreads, numberInPanel);
+      for (int i = 0; i < numberTasks; i++) {
+        info[i].firstPanel = firstPanel;
+        info[i].lastPanel = lastPanel;
+        info[i].first = firstPanel + (i * numberInPanel) / numberTasks;
+        info[i].last = firstPanel + ((i + 1) * numberInPanel) / numberTasks;
+        info[i].forward = 0;
       }
-      solveB2(aa, nChunk, region + triBase, region + iBase);
-      iBase -= BLOCK;
-      aa -= BLOCKSQ;
-    }
-    if (triBase + BLOCK > numberRows_) {
-      nChunk = numberRows_ - triBase;
-    } else {
-      nChunk = BLOCK;
+      if (numberTasks > 1)
+        clpParallelFor(denseSolveBit, info, numberTasks);
+      else
+        denseSolveBit(info[0]);
     }
-    solveB1(aa, nChunk, region + triBase);
-    aa -= BLOCKSQ;
-  }
-#ifdef CHOL_COMPARE
-  if (numberRows_ < 200) {
-    for (int i = 0; i < numberRows_; i++) {
-      assert(CoinAbs(region[i] - region2[i]) < 1.0e-3);
+    for (int iBlock = lastPanel - 1; iBlock >= firstPanel; iBlock--) {
+      int triBase = iBlock * BLOCK;
+      for (int jBlock = lastPanel - 1; jBlock > iBlock; jBlock--) {
+        int base = jBlock * BLOCK;
+        int nChunk = CoinMin(BLOCK, numberRows_ - base);
+        longDouble *aa = a + number_entries(blockOffset(iBlock, jBlock, numberBlocks));
+        for (int k = 0; k < numberRhs; k++)
+          solveB2(aa, nChunk, region + k * numberRows_ + triBase,
+            region + k * numberRows_ + base);
+      }
+      int nChunk = CoinMin(BLOCK, numberRows_ - triBase);
+      longDouble *aa = a + number_entries(blockOffset(iBlock, iBlock, numberBlocks));
+      for (int k = 0; k < numberRhs; k++)
+        solveB1(aa, nChunk, region + k * numberRows_ + triBase);
     }
-    delete[] region2;
   }
-#endif
+  delete[] info;
 }
 /* Forward part of solve 1*/
 void ClpCholeskyDense::solveF1(longDouble *a, int n, CoinWorkDouble *region)
@@ -29,6 +29,9 @@ public:
   virtual int factorize(const CoinWorkDouble *diagonal, int *rowsDropped);
   /** Uses factorization to solve. */
   virtual void solve(CoinWorkDouble *region);
+  /** Uses factorization to solve numberRhs right hand sides in one
+      pass over factor (possibly using several threads) */
+  virtual void solveMultiple(CoinWorkDouble *region, int numberRhs);
   /**@}*/
 
   /**@name Non virtual methods for ClpCholeskyDense  */
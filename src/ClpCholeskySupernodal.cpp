@@ -0,0 +1,860 @@
+/* $Id$ */
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CoinPragma.hpp"
+
+#include <iostream>
+#include <algorithm>
+
+#include "ClpCholeskySupernodal.hpp"
+#include "ClpInterior.hpp"
+#include "ClpHelperFunctions.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "ClpMessage.hpp"
+
+//#############################################################################
+// Constructors / Destructor / Assignment
+//#############################################################################
+
+//-------------------------------------------------------------------
+// Default Constructor
+//-------------------------------------------------------------------
+ClpCholeskySupernodal::ClpCholeskySupernodal(int numberThreads)
+  : ClpCholeskyBase(-1)
+  , numberThreads_(numberThreads)
+  , numberSupernodes_(0)
+  , numberLevels_(0)
+  , superFirst_(NULL)
+  , superRowStart_(NULL)
+  , superRow_(NULL)
+  , superStart_(NULL)
+  , updateStart_(NULL)
+  , updateList_(NULL)
+  , levelStart_(NULL)
+  , levelList_(NULL)
+  , pivotValue_(NULL)
+{
+  type_ = 18;
+}
+
+//-------------------------------------------------------------------
+// Copy constructor
+//-------------------------------------------------------------------
+ClpCholeskySupernodal::ClpCholeskySupernodal(const ClpCholeskySupernodal &rhs)
+  : ClpCholeskyBase(rhs)
+{
+  gutsOfCopy(rhs);
+}
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+ClpCholeskySupernodal::~ClpCholeskySupernodal()
+{
+  gutsOfDestructor();
+}
+
+//----------------------------------------------------------------
+// Assignment operator
+//-------------------------------------------------------------------
+ClpCholeskySupernodal &
+ClpCholeskySupernodal::operator=(const ClpCholeskySupernodal &rhs)
+{
+  if (this != &rhs) {
+    ClpCholeskyBase::operator=(rhs);
+    gutsOfDestructor();
+    gutsOfCopy(rhs);
+  }
+  return *this;
+}
+//-------------------------------------------------------------------
+// Clone
+//-------------------------------------------------------------------
+ClpCholeskyBase *ClpCholeskySupernodal::clone() const
+{
+  return new ClpCholeskySupernodal(*this);
+}
+// Frees supernode arrays
+void ClpCholeskySupernodal::gutsOfDestructor()
+{
+  delete[] superFirst_;
+  delete[] superRowStart_;
+  delete[] superRow_;
+  delete[] superStart_;
+  delete[] updateStart_;
+  delete[] updateList_;
+  delete[] levelStart_;
+  delete[] levelList_;
+  delete[] pivotValue_;
+  superFirst_ = NULL;
+  superRowStart_ = NULL;
+  superRow_ = NULL;
+  superStart_ = NULL;
+  updateStart_ = NULL;
+  updateList_ = NULL;
+  levelStart_ = NULL;
+  levelList_ = NULL;
+  pivotValue_ = NULL;
+  numberSupernodes_ = 0;
+  numberLevels_ = 0;
+}
+// Copies supernode arrays
+void ClpCholeskySupernodal::gutsOfCopy(const ClpCholeskySupernodal &rhs)
+{
+  numberThreads_ = rhs.numberThreads_;
+  numberSupernodes_ = rhs.numberSupernodes_;
+  numberLevels_ = rhs.numberLevels_;
+  if (rhs.superFirst_) {
+    superFirst_ = ClpCopyOfArray(rhs.superFirst_, numberSupernodes_ + 1);
+    superRowStart_ = ClpCopyOfArray(rhs.superRowStart_, numberSupernodes_ + 1);
+    superRow_ = ClpCopyOfArray(rhs.superRow_, superRowStart_[numberSupernodes_]);
+    superStart_ = ClpCopyOfArray(rhs.superStart_, numberSupernodes_ + 1);
+    updateStart_ = ClpCopyOfArray(rhs.updateStart_, numberSupernodes_ + 1);
+    updateList_ = ClpCopyOfArray(rhs.updateList_, 2 * updateStart_[numberSupernodes_]);
+    levelStart_ = ClpCopyOfArray(rhs.levelStart_, numberLevels_ + 1);
+    levelList_ = ClpCopyOfArray(rhs.levelList_, numberSupernodes_);
+    pivotValue_ = ClpCopyOfArray(rhs.pivotValue_, numberRows_);
+  } else {
+    superFirst_ = NULL;
+    superRowStart_ = NULL;
+    superRow_ = NULL;
+    superStart_ = NULL;
+    updateStart_ = NULL;
+    updateList_ = NULL;
+    levelStart_ = NULL;
+    levelList_ = NULL;
+    pivotValue_ = NULL;
+  }
+}
+/* Orders rows and saves pointer to matrix.and model */
+int ClpCholeskySupernodal::order(ClpInterior *model)
+{
+  // KKT not coded
+  assert(!doKKT_);
+  gutsOfDestructor();
+  // Base ordering (approximate minimum degree unless orderingType_ set)
+  return ClpCholeskyBase::order(model);
+}
+/* Does Symbolic factorization given permutation.
+   Finds elimination tree, fundamental supernodes, their row structure,
+   which descendants update each supernode and levels for parallelism.
+*/
+int ClpCholeskySupernodal::symbolic()
+{
+  const CoinBigIndex *columnStart = model_->clpMatrix()->getVectorStarts();
+  const int *columnLength = model_->clpMatrix()->getVectorLengths();
+  const int *row = model_->clpMatrix()->getIndices();
+  const CoinBigIndex *rowStart = rowCopy_->getVectorStarts();
+  const int *rowLength = rowCopy_->getVectorLengths();
+  const int *column = rowCopy_->getIndices();
+  int iRow;
+  // Upper triangular pattern of permuted A*A' (without diagonal)
+  int *used = new int[numberRows_ + 1];
+  CoinZeroN(used, numberRows_);
+  int *Astart = new int[numberRows_ + 1];
+  int *Arow = NULL;
+  try {
+    Arow = new int[sizeFactor_];
+  } catch (...) {
+    // no memory
+    delete[] Astart;
+    delete[] used;
+    return -1;
+  }
+  int numberElements = 0;
+  for (iRow = 0; iRow < numberRows_; iRow++) {
+    int iOriginalRow = permute_[iRow];
+    Astart[iRow] = numberElements;
+    int *which = Arow + numberElements;
+    int number = 0;
+    CoinBigIndex startRow = rowStart[iOriginalRow];
+    CoinBigIndex endRow = rowStart[iOriginalRow] + rowLength[iOriginalRow];
+    for (CoinBigIndex k = startRow; k < endRow; k++) {
+      int iColumn = column[k];
+      CoinBigIndex start = columnStart[iColumn];
+      CoinBigIndex end = columnStart[iColumn] + columnLength[iColumn];
+      for (CoinBigIndex j = start; j < end; j++) {
+        int jNewRow = permuteInverse_[row[j]];
+        if (jNewRow < iRow && !used[jNewRow]) {
+          used[jNewRow] = 1;
+          which[number++] = jNewRow;
+        }
+      }
+    }
+    for (int j = 0; j < number; j++)
+      used[which[j]] = 0;
+    numberElements += number;
+  }
+  Astart[numberRows_] = numberElements;
+  // Elimination tree and column counts (as symbolic1)
+  int *parent = new int[numberRows_];
+  int *count = new int[numberRows_];
+  int *marked = new int[numberRows_];
+  for (iRow = 0; iRow < numberRows_; iRow++) {
+    parent[iRow] = -1;
+    count[iRow] = 0;
+  }
+  for (iRow = 0; iRow < numberRows_; iRow++) {
+    marked[iRow] = iRow;
+    for (int j = Astart[iRow]; j < Astart[iRow + 1]; j++) {
+      int kRow = Arow[j];
+      while (marked[kRow] != iRow) {
+        if (parent[kRow] < 0)
+          parent[kRow] = iRow;
+        count[kRow]++;
+        marked[kRow] = iRow;
+        kRow = parent[kRow];
+      }
+    }
+  }
+  // Lower triangular pattern (transpose of upper)
+  int *Lstart = new int[numberRows_ + 1];
+  int *Lrow = new int[numberElements];
+  CoinZeroN(Lstart, numberRows_ + 1);
+  for (int j = 0; j < numberElements; j++)
+    Lstart[Arow[j] + 1]++;
+  for (iRow = 0; iRow < numberRows_; iRow++)
+    Lstart[iRow + 1] += Lstart[iRow];
+  for (iRow = 0; iRow < numberRows_; iRow++) {
+    for (int j = Astart[iRow]; j < Astart[iRow + 1]; j++) {
+      int kRow = Arow[j];
+      Lrow[Lstart[kRow]++] = iRow;
+    }
+  }
+  for (iRow = numberRows_; iRow > 0; iRow--)
+    Lstart[iRow] = Lstart[iRow - 1];
+  Lstart[0] = 0;
+  delete[] Astart;
+  delete[] Arow;
+  // Fundamental supernodes
+  int *numberChildren = marked;
+  CoinZeroN(numberChildren, numberRows_);
+  for (iRow = 0; iRow < numberRows_; iRow++) {
+    if (parent[iRow] >= 0)
+      numberChildren[parent[iRow]]++;
+  }
+  int *superOf = used;
+  superFirst_ = new int[numberRows_ + 1];
+  numberSupernodes_ = 0;
+  for (iRow = 0; iRow < numberRows_; iRow++) {
+    if (!iRow || parent[iRow - 1] != iRow || count[iRow - 1] != count[iRow] + 1
+      || numberChildren[iRow] != 1)
+      superFirst_[numberSupernodes_++] = iRow;
+    superOf[iRow] = numberSupernodes_ - 1;
+  }
+  superFirst_[numberSupernodes_] = numberRows_;
+  // Row structure
+  superRowStart_ = new int[numberSupernodes_ + 1];
+  superStart_ = new CoinBigIndex[numberSupernodes_ + 1];
+  superRowStart_[0] = 0;
+  superStart_[0] = 0;
+  int iSuper;
+  for (iSuper = 0; iSuper < numberSupernodes_; iSuper++) {
+    int first = superFirst_[iSuper];
+    int numberColumns = superFirst_[iSuper + 1] - first;
+    int numberInSuper = count[first] + 1;
+    superRowStart_[iSuper + 1] = superRowStart_[iSuper] + numberInSuper;
+    superStart_[iSuper + 1] = superStart_[iSuper] + static_cast< CoinBigIndex >(numberInSuper) * numberColumns;
+  }
+  bool noMemory = false;
+  if (superStart_[numberSupernodes_] > COIN_INT_MAX) {
+    noMemory = true;
+  } else {
+    try {
+      superRow_ = new int[superRowStart_[numberSupernodes_]];
+    } catch (...) {
+      noMemory = true;
+    }
+  }
+  // children as linked lists
+  int *superParent = new int[numberSupernodes_];
+  int *firstChild = new int[numberSupernodes_];
+  int *nextChild = new int[numberSupernodes_];
+  for (iSuper = 0; iSuper < numberSupernodes_; iSuper++)
+    firstChild[iSuper] = -1;
+  for (iSuper = numberSupernodes_ - 1; iSuper >= 0; iSuper--) {
+    int last = superFirst_[iSuper + 1] - 1;
+    int jSuper = parent[last] >= 0 ? superOf[parent[last]] : -1;
+    superParent[iSuper] = jSuper;
+    if (jSuper >= 0) {
+      nextChild[iSuper] = firstChild[jSuper];
+      firstChild[jSuper] = iSuper;
+    }
+  }
+  if (!noMemory) {
+    for (iRow = 0; iRow < numberRows_; iRow++)
+      marked[iRow] = -1;
+    for (iSuper = 0; iSuper < numberSupernodes_; iSuper++) {
+      int first = superFirst_[iSuper];
+      int last = superFirst_[iSuper + 1] - 1;
+      int *which = superRow_ + superRowStart_[iSuper];
+      int number = 0;
+      for (iRow = first; iRow <= last; iRow++) {
+        which[number++] = iRow;
+        marked[iRow] = iSuper;
+      }
+      int numberColumns = number;
+      for (iRow = first; iRow <= last; iRow++) {
+        for (int j = Lstart[iRow]; j < Lstart[iRow + 1]; j++) {
+          int kRow = Lrow[j];
+          if (marked[kRow] != iSuper) {
+            marked[kRow] = iSuper;
+            which[number++] = kRow;
+          }
+        }
+      }
+      for (int jSuper = firstChild[iSuper]; jSuper >= 0; jSuper = nextChild[jSuper]) {
+        const int *whichChild = superRow_ + superRowStart_[jSuper];
+        int numberChild = superRowStart_[jSuper + 1] - superRowStart_[jSuper];
+        int numberChildColumns = superFirst_[jSuper + 1] - superFirst_[jSuper];
+        for (int j = numberChildColumns; j < numberChild; j++) {
+          int kRow = whichChild[j];
+          if (kRow > last && marked[kRow] != iSuper) {
+            marked[kRow] = iSuper;
+            which[number++] = kRow;
+          }
+        }
+      }
+      assert(number == superRowStart_[iSuper + 1] - superRowStart_[iSuper]);
+      std::sort(which + numberColumns, which + number);
+    }
+  }
+  delete[] Lstart;
+  delete[] Lrow;
+  delete[] count;
+  delete[] parent;
+  if (!noMemory) {
+    // Which descendants update each supernode
+    updateStart_ = new int[numberSupernodes_ + 1];
+    CoinZeroN(updateStart_, numberSupernodes_ + 1);
+    for (int pass = 0; pass < 2; pass++) {
+      for (iSuper = 0; iSuper < numberSupernodes_; iSuper++) {
+        const int *which = superRow_ + superRowStart_[iSuper];
+        int number = superRowStart_[iSuper + 1] - superRowStart_[iSuper];
+        int lastSuper = -1;
+        for (int j = superFirst_[iSuper + 1] - superFirst_[iSuper]; j < number; j++) {
+          int jSuper = superOf[which[j]];
+          if (jSuper != lastSuper) {
+            lastSuper = jSuper;
+            if (!pass) {
+              updateStart_[jSuper]++;
+            } else {
+              int put = 2 * updateStart_[jSuper]++;
+              updateList_[put] = iSuper;
+              updateList_[put + 1] = j;
+            }
+          }
+        }
+      }
+      if (!pass) {
+        int numberUpdates = 0;
+        for (iSuper = 0; iSuper < numberSupernodes_; iSuper++) {
+          int number = updateStart_[iSuper];
+          updateStart_[iSuper] = numberUpdates;
+          numberUpdates += number;
+        }
+        updateStart_[numberSupernodes_] = numberUpdates;
+        updateList_ = new int[2 * numberUpdates];
+      } else {
+        for (iSuper = numberSupernodes_; iSuper > 0; iSuper--)
+          updateStart_[iSuper] = updateStart_[iSuper - 1];
+        updateStart_[0] = 0;
+      }
+    }
+    // Levels - leaves are level 0
+    int *level = firstChild;
+    CoinZeroN(level, numberSupernodes_);
+    numberLevels_ = 0;
+    for (iSuper = 0; iSuper < numberSupernodes_; iSuper++) {
+      int jSuper = superParent[iSuper];
+      numberLevels_ = CoinMax(numberLevels_, level[iSuper] + 1);
+      if (jSuper >= 0)
+        level[jSuper] = CoinMax(level[jSuper], level[iSuper] + 1);
+    }
+    levelStart_ = new int[numberLevels_ + 1];
+    levelList_ = new int[numberSupernodes_];
+    CoinZeroN(levelStart_, numberLevels_ + 1);
+    for (iSuper = 0; iSuper < numberSupernodes_; iSuper++)
+      levelStart_[level[iSuper] + 1]++;
+    for (int iLevel = 0; iLevel < numberLevels_; iLevel++)
+      levelStart_[iLevel + 1] += levelStart_[iLevel];
+    for (iSuper = 0; iSuper < numberSupernodes_; iSuper++)
+      levelList_[levelStart_[level[iSuper]]++] = iSuper;
+    for (int iLevel = numberLevels_; iLevel > 0; iLevel--)
+      levelStart_[iLevel] = levelStart_[iLevel - 1];
+    levelStart_[0] = 0;
+  }
+  delete[] superParent;
+  delete[] firstChild;
+  delete[] nextChild;
+  delete[] marked;
+  delete[] used;
+  if (!noMemory) {
+    sizeFactor_ = static_cast< int >(superStart_[numberSupernodes_]);
+    double flops = 0.0;
+    for (iSuper = 0; iSuper < numberSupernodes_; iSuper++) {
+      double numberColumns = superFirst_[iSuper + 1] - superFirst_[iSuper];
+      double number = superRowStart_[iSuper + 1] - superRowStart_[iSuper];
+      for (int j = 0; j < numberColumns; j++)
+        flops += (number - j) * (number - j + 1.0);
+    }
+    if (model_->messageHandler()->logLevel() > 0)
+      std::cout << sizeFactor_ << " elements in supernodal Cholesky, "
+                << numberSupernodes_ << " supernodes, " << numberLevels_
+                << " levels, flop count " << flops << std::endl;
+    try {
+      sparseFactor_ = new longDouble[sizeFactor_];
+#if CLP_LONG_CHOLESKY != 1
+      workDouble_ = new longDouble[numberRows_];
+#else
+      // actually long double
+      workDouble_ = reinterpret_cast< double * >(new CoinWorkDouble[numberRows_]);
+#endif
+      diagonal_ = new longDouble[numberRows_];
+      pivotValue_ = new longDouble[numberRows_];
+    } catch (...) {
+      // no memory
+      noMemory = true;
+    }
+  }
+  if (noMemory) {
+    gutsOfDestructor();
+    delete[] sparseFactor_;
+    sparseFactor_ = NULL;
+    delete[] workDouble_;
+    workDouble_ = NULL;
+    delete[] diagonal_;
+    diagonal_ = NULL;
+    return -1;
+  }
+  return 0;
+}
+/* Puts A*D*A' for columns of supernodes into panels.
+   Returns largest absolute value */
+CoinWorkDouble
+ClpCholeskySupernodal::assemble(int firstSuper, int lastSuper,
+  const CoinWorkDouble *diagonal, longDouble *work)
+{
+  const CoinBigIndex *columnStart = model_->clpMatrix()->getVectorStarts();
+  const int *columnLength = model_->clpMatrix()->getVectorLengths();
+  const int *row = model_->clpMatrix()->getIndices();
+  const double *element = model_->clpMatrix()->getElements();
+  const CoinBigIndex *rowStart = rowCopy_->getVectorStarts();
+  const int *rowLength = rowCopy_->getVectorLengths();
+  const int *column = rowCopy_->getIndices();
+  const double *elementByRow = rowCopy_->getElements();
+  int numberColumns = model_->clpMatrix()->getNumCols();
+  const CoinWorkDouble *diagonalSlack = diagonal + numberColumns;
+  CoinWorkDouble delta2 = model_->delta(); // add delta*delta to diagonal
+  delta2 *= delta2;
+  CoinWorkDouble largest = 1.0e-20;
+  for (int iSuper = firstSuper; iSuper < lastSuper; iSuper++) {
+    int first = superFirst_[iSuper];
+    int last = superFirst_[iSuper + 1];
+    const int *which = superRow_ + superRowStart_[iSuper];
+    int number = superRowStart_[iSuper + 1] - superRowStart_[iSuper];
+    longDouble *put = sparseFactor_ + superStart_[iSuper];
+    for (int iRow = first; iRow < last; iRow++) {
+      int iOriginalRow = permute_[iRow];
+      int offset = iRow - first;
+      int j;
+      for (j = 0; j < offset; j++)
+        put[j] = 0.0;
+      if (!rowLength[iOriginalRow])
+        rowsDropped_[iOriginalRow] = 1;
+      if (!rowsDropped_[iOriginalRow]) {
+        CoinBigIndex startRow = rowStart[iOriginalRow];
+        CoinBigIndex endRow = rowStart[iOriginalRow] + rowLength[iOriginalRow];
+        work[iRow] = diagonalSlack[iOriginalRow] + delta2;
+        for (CoinBigIndex k = startRow; k < endRow; k++) {
+          int iColumn = column[k];
+          CoinBigIndex start = columnStart[iColumn];
+          CoinBigIndex end = columnStart[iColumn] + columnLength[iColumn];
+          CoinWorkDouble multiplier = diagonal[iColumn] * elementByRow[k];
+          for (CoinBigIndex jj = start; jj < end; jj++) {
+            int jRow = row[jj];
+            int jNewRow = permuteInverse_[jRow];
+            if (jNewRow >= iRow && !rowsDropped_[jRow]) {
+              CoinWorkDouble value = element[jj] * multiplier;
+              work[jNewRow] += value;
+            }
+          }
+        }
+        for (j = offset; j < number; j++) {
+          int jRow = which[j];
+          put[j] = work[jRow];
+          largest = CoinMax(largest, CoinAbs(work[jRow]));
+          work[jRow] = 0.0;
+        }
+      } else {
+        // dropped
+        put[offset] = 1.0;
+        for (j = offset + 1; j < number; j++)
+          put[j] = 0.0;
+      }
+      put += number;
+    }
+  }
+  return largest;
+}
+/* Blocked update for lower triangle of update (as BLAS syrk/gemm).
+   update(i,j) += sum over k of a(i,k)*scaled(j,k) for i >= j where a
+   has leading dimension lda, scaled is nColumn by numberK by row and
+   update is nRow by nColumn by column.  Blocks of columns, inner index
+   and rows are chosen so a block of a and of scaled stay in cache and
+   four columns of a are used at a time.  Order of operations is fixed
+   so results do not depend on threads. */
+#ifndef CLP_SUPERNODAL_BLOCK
+#define CLP_SUPERNODAL_BLOCK 64
+#endif
+#ifndef CLP_SUPERNODAL_INNER
+#define CLP_SUPERNODAL_INNER 128
+#endif
+static void
+blockUpdate(int nRow, int nColumn, int numberK,
+  const longDouble *COIN_RESTRICT a, int lda,
+  const longDouble *COIN_RESTRICT scaled, longDouble *COIN_RESTRICT update)
+{
+  for (int jBlock = 0; jBlock < nColumn; jBlock += CLP_SUPERNODAL_BLOCK) {
+    int jEnd = CoinMin(jBlock + CLP_SUPERNODAL_BLOCK, nColumn);
+    for (int kBlock = 0; kBlock < numberK; kBlock += CLP_SUPERNODAL_INNER) {
+      int kEnd = CoinMin(kBlock + CLP_SUPERNODAL_INNER, numberK);
+      // only blocks on or below diagonal
+      for (int iBlock = jBlock; iBlock < nRow; iBlock += CLP_SUPERNODAL_BLOCK) {
+        int iEnd = CoinMin(iBlock + CLP_SUPERNODAL_BLOCK, nRow);
+        for (int j = jBlock; j < jEnd; j++) {
+          int iStart = CoinMax(iBlock, j);
+          if (iStart >= iEnd)
+            continue;
+          const longDouble *COIN_RESTRICT w = scaled + j * numberK;
+          longDouble *COIN_RESTRICT c = update + j * nRow;
+          int k = kBlock;
+          for (; k < kEnd - 3; k += 4) {
+            const longDouble *COIN_RESTRICT a0 = a + k * lda;
+            const longDouble *COIN_RESTRICT a1 = a0 + lda;
+            const longDouble *COIN_RESTRICT a2 = a1 + lda;
+            const longDouble *COIN_RESTRICT a3 = a2 + lda;
+            CoinWorkDouble t0 = w[k];
+            CoinWorkDouble t1 = w[k + 1];
+            CoinWorkDouble t2 = w[k + 2];
+            CoinWorkDouble t3 = w[k + 3];
+            for (int i = iStart; i < iEnd; i++)
+              c[i] += a0[i] * t0 + a1[i] * t1 + a2[i] * t2 + a3[i] * t3;
+          }
+          for (; k < kEnd; k++) {
+            const longDouble *COIN_RESTRICT a0 = a + k * lda;
+            CoinWorkDouble t0 = w[k];
+            if (!t0)
+              continue;
+            for (int i = iStart; i < iEnd; i++)
+              c[i] += a0[i] * t0;
+          }
+        }
+      }
+    }
+  }
+}
+/* Gathers updates from descendants into supernode and factorizes it.
+   Updates from a descendant are formed as a dense block
+   L2*D*L1' (L1 the rows which are columns of this supernode and L2 all
+   rows from there on) and then scattered into panel.
+*/
+void ClpCholeskySupernodal::factorizeSupernode(int iSuper, int *rowsDropped, int *map,
+  longDouble *&buffer, int &sizeBuffer,
+  CoinWorkDouble &largest, CoinWorkDouble &smallest,
+  int &numberDropped)
+{
+  double dropValue = doubleParameters_[10];
+  int first = superFirst_[iSuper];
+  int numberColumns = superFirst_[iSuper + 1] - first;
+  int last = first + numberColumns - 1;
+  const int *which = superRow_ + superRowStart_[iSuper];
+  int number = superRowStart_[iSuper + 1] - superRowStart_[iSuper];
+  longDouble *panel = sparseFactor_ + superStart_[iSuper];
+  int j;
+  for (j = 0; j < number; j++)
+    map[which[j]] = j;
+  for (int iUpdate = updateStart_[iSuper]; iUpdate < updateStart_[iSuper + 1]; iUpdate++) {
+    int kSuper = updateList_[2 * iUpdate];
+    int kFirst = updateList_[2 * iUpdate + 1];
+    const int *whichK = superRow_ + superRowStart_[kSuper];
+    int numberK = superRowStart_[kSuper + 1] - superRowStart_[kSuper];
+    int numberColumnsK = superFirst_[kSuper + 1] - superFirst_[kSuper];
+    const longDouble *panelK = sparseFactor_ + superStart_[kSuper];
+    const longDouble *pivotK = pivotValue_ + superFirst_[kSuper];
+    int kLast = kFirst;
+    while (kLast < numberK && whichK[kLast] <= last)
+      kLast++;
+    int nColumn = kLast - kFirst;
+    int nRow = numberK - kFirst;
+    // update in buffer then L1*D (transposed) after it
+    int sizeNeeded = nRow * nColumn + nColumn * numberColumnsK;
+    if (sizeNeeded > sizeBuffer) {
+      delete[] buffer;
+      sizeBuffer = CoinMax(sizeNeeded, 2 * sizeBuffer);
+      buffer = new longDouble[sizeBuffer];
+    }
+    longDouble *scaled = buffer + nRow * nColumn;
+    for (int iColumn = 0; iColumn < nColumn; iColumn++) {
+      longDouble *put = scaled + iColumn * numberColumnsK;
+      for (int k = 0; k < numberColumnsK; k++)
+        put[k] = pivotK[k] * panelK[k * numberK + kFirst + iColumn];
+    }
+    // update = L2 * (L1*D)' (lower part only)
+    CoinZeroN(buffer, nRow * nColumn);
+    blockUpdate(nRow, nColumn, numberColumnsK, panelK + kFirst, numberK,
+      scaled, buffer);
+    // scatter
+    for (int iColumn = 0; iColumn < nColumn; iColumn++) {
+      longDouble *put = panel + (whichK[kFirst + iColumn] - first) * number;
+      const longDouble *update = buffer + iColumn * nRow;
+      for (int i = iColumn; i < nRow; i++)
+        put[map[whichK[kFirst + i]]] -= update[i];
+    }
+  }
+  // Factorize panel (positive definite so all pivots must be positive)
+  for (j = 0; j < numberColumns; j++) {
+    longDouble *a = panel + j * number;
+    CoinWorkDouble diagonalValue = a[j];
+    int originalRow = permute_[first + j];
+    CoinWorkDouble dValue;
+    if (diagonalValue >= dropValue) {
+      smallest = CoinMin(smallest, diagonalValue);
+      largest = CoinMax(largest, diagonalValue);
+      dValue = diagonalValue;
+      diagonalValue = 1.0 / diagonalValue;
+    } else {
+      rowsDropped[originalRow] = 2;
+      dValue = 0.0;
+      diagonalValue = 0.0;
+      numberDropped++;
+    }
+    diagonal_[first + j] = diagonalValue;
+    pivotValue_[first + j] = dValue;
+    int i;
+    for (i = j + 1; i < number; i++)
+      a[i] *= diagonalValue;
+    if (dValue) {
+      for (int k = j + 1; k < numberColumns; k++) {
+        CoinWorkDouble t = dValue * a[k];
+        if (t) {
+          longDouble *b = panel + k * number;
+          for (i = k; i < number; i++)
+            b[i] -= a[i] * t;
+        }
+      }
+    }
+  }
+}
+// For parallel tasks
+typedef struct {
+  ClpCholeskySupernodal *factor;
+  const CoinWorkDouble *diagonal;
+  const int *which;
+  int *rowsDropped;
+  int *map;
+  longDouble *work;
+  longDouble *buffer;
+  CoinWorkDouble largest;
+  CoinWorkDouble smallest;
+  int sizeBuffer;
+  int firstSuper;
+  int lastSuper;
+  int numberDropped;
+} clpSupernodalInfo;
+static void assembleBit(clpSupernodalInfo &info)
+{
+  CoinWorkDouble largest = info.factor->assemble(info.firstSuper, info.lastSuper,
+    info.diagonal, info.work);
+  info.largest = CoinMax(info.largest, largest);
+}
+static void factorizeBit(clpSupernodalInfo &info)
+{
+  for (int i = info.firstSuper; i < info.lastSuper; i++)
+    info.factor->factorizeSupernode(info.which[i], info.rowsDropped, info.map,
+      info.buffer, info.sizeBuffer,
+      info.largest, info.smallest, info.numberDropped);
+}
+/* Factorize - filling in rowsDropped and returning number dropped */
+int ClpCholeskySupernodal::factorize(const CoinWorkDouble *diagonal, int *rowsDropped)
+{
+  //perturbation
+  CoinWorkDouble perturbation = model_->diagonalPerturbation() * model_->diagonalNorm();
+  if (perturbation > 1.0) {
+#ifdef COIN_DEVELOP
+    //if (model_->model()->logLevel()&4)
+    std::cout << "large perturbation " << perturbation << std::endl;
+#endif
+    perturbation = 1.0;
+  }
+  int numberThreads = numberThreads_ > 0 ? numberThreads_ : clpParallelThreads();
+  numberThreads = CoinMax(1, CoinMin(numberThreads, numberSupernodes_));
+  clpSupernodalInfo *info = new clpSupernodalInfo[numberThreads];
+  longDouble *work = new longDouble[numberThreads * numberRows_];
+  int *map = new int[numberThreads * numberRows_];
+  CoinZeroN(work, numberThreads * numberRows_);
+  int i;
+  for (i = 0; i < numberThreads; i++) {
+    info[i].factor = this;
+    info[i].diagonal = diagonal;
+    info[i].which = levelList_;
+    info[i].rowsDropped = rowsDropped;
+    info[i].map = map + i * numberRows_;
+    info[i].work = work + i * numberRows_;
+    info[i].buffer = NULL;
+    info[i].largest = 0.0;
+    info[i].smallest = COIN_DBL_MAX;
+    info[i].sizeBuffer = 0;
+    info[i].firstSuper = (i * numberSupernodes_) / numberThreads;
+    info[i].lastSuper = ((i + 1) * numberSupernodes_) / numberThreads;
+    info[i].numberDropped = 0;
+  }
+  // Put A*D*A' into panels
+  clpParallelFor(assembleBit, info, numberThreads);
+  CoinWorkDouble largest2 = 1.0e-20;
+  for (i = 0; i < numberThreads; i++)
+    largest2 = CoinMax(largest2, info[i].largest);
+  delete[] work;
+  //check sizes
+  largest2 *= 1.0e-20;
+  int numberDroppedBefore = 0;
+  for (int iSuper = 0; iSuper < numberSupernodes_; iSuper++) {
+    int first = superFirst_[iSuper];
+    int number = superRowStart_[iSuper + 1] - superRowStart_[iSuper];
+    longDouble *put = sparseFactor_ + superStart_[iSuper];
+    for (int iRow = first; iRow < superFirst_[iSuper + 1]; iRow++) {
+      int iOriginalRow = permute_[iRow];
+      int dropped = rowsDropped_[iOriginalRow];
+      // Move to int array
+      rowsDropped[iOriginalRow] = dropped;
+      if (!dropped) {
+        CoinWorkDouble diagonal = put[iRow - first];
+        if (diagonal <= largest2) {
+          rowsDropped[iOriginalRow] = 2;
+          numberDroppedBefore++;
+        }
+        put[iRow - first] = diagonal + perturbation;
+      }
+      put += number;
+    }
+  }
+  doubleParameters_[10] = CoinMax(1.0e-20, CoinMin(largest2, CHOL_SMALL_VALUE));
+  // Now factorize level by level - each task keeps its own statistics
+  for (i = 0; i < numberThreads; i++)
+    info[i].largest = 0.0;
+  for (int iLevel = 0; iLevel < numberLevels_; iLevel++) {
+    int start = levelStart_[iLevel];
+    int numberInLevel = levelStart_[iLevel + 1] - start;
+    int numberTasks = CoinMin(numberThreads, numberInLevel);
+    for (i = 0; i < numberTasks; i++) {
+      info[i].firstSuper = start + (i * numberInLevel) / numberTasks;
+      info[i].lastSuper = start + ((i + 1) * numberInLevel) / numberTasks;
+    }
+    clpParallelFor(factorizeBit, info, numberTasks);
+  }
+  for (i = 1; i < numberThreads; i++) {
+    info[0].largest = CoinMax(info[0].largest, info[i].largest);
+    info[0].smallest = CoinMin(info[0].smallest, info[i].smallest);
+    info[0].numberDropped += info[i].numberDropped;
+  }
+  CoinWorkDouble largest = info[0].largest;
+  CoinWorkDouble smallest = info[0].smallest;
+  int newDropped = info[0].numberDropped + numberDroppedBefore;
+  for (i = 0; i < numberThreads; i++)
+    delete[] info[i].buffer;
+  delete[] info;
+  delete[] map;
+  doubleParameters_[3] = largest;
+  doubleParameters_[4] = smallest;
+  integerParameters_[20] = newDropped - numberDroppedBefore;
+  if (model_->messageHandler()->logLevel() > 1)
+    std::cout << "Cholesky - largest " << largest << " smallest " << smallest << std::endl;
+  choleskyCondition_ = largest / smallest;
+  bool cleanCholesky;
+  if (model_->numberIterations() < 2000)
+    cleanCholesky = true;
+  else
+    cleanCholesky = false;
+  if (cleanCholesky) {
+    //drop fresh makes some formADAT easier
+    if (newDropped || numberRowsDropped_) {
+      newDropped = 0;
+      for (int i = 0; i < numberRows_; i++) {
+        char dropped = static_cast< char >(rowsDropped[i]);
+        rowsDropped_[i] = 0;
+        if (dropped == 2) {
+          //dropped this time
+          rowsDropped[newDropped++] = i;
+        }
+      }
+      numberRowsDropped_ = newDropped;
+      newDropped = -(2 + newDropped);
+    }
+  } else {
+    if (newDropped) {
+      newDropped = 0;
+      for (int i = 0; i < numberRows_; i++) {
+        char dropped = static_cast< char >(rowsDropped[i]);
+        rowsDropped_[i] = dropped;
+        if (dropped == 2) {
+          //dropped this time
+          rowsDropped[newDropped++] = i;
+          rowsDropped_[i] = 1;
+        }
+      }
+    }
+    numberRowsDropped_ += newDropped;
+  }
+  status_ = 0;
+  return newDropped;
+}
+/* Uses factorization to solve. */
+void ClpCholeskySupernodal::solve(CoinWorkDouble *region)
+{
+  CoinWorkDouble *work = reinterpret_cast< CoinWorkDouble * >(workDouble_);
+  int i;
+  for (i = 0; i < numberRows_; i++) {
+    int iRow = permute_[i];
+    work[i] = region[iRow];
+  }
+  int iSuper;
+  // forward
+  for (iSuper = 0; iSuper < numberSupernodes_; iSuper++) {
+    int first = superFirst_[iSuper];
+    int numberColumns = superFirst_[iSuper + 1] - first;
+    const int *which = superRow_ + superRowStart_[iSuper];
+    int number = superRowStart_[iSuper + 1] - superRowStart_[iSuper];
+    const longDouble *a = sparseFactor_ + superStart_[iSuper];
+    for (int j = 0; j < numberColumns; j++) {
+      CoinWorkDouble value = work[first + j];
+      if (value) {
+        for (int k = j + 1; k < number; k++)
+          work[which[k]] -= a[k] * value;
+      }
+      a += number;
+    }
+  }
+  // backward
+  for (iSuper = numberSupernodes_ - 1; iSuper >= 0; iSuper--) {
+    int first = superFirst_[iSuper];
+    int numberColumns = superFirst_[iSuper + 1] - first;
+    const int *which = superRow_ + superRowStart_[iSuper];
+    int number = superRowStart_[iSuper + 1] - superRowStart_[iSuper];
+    for (int j = numberColumns - 1; j >= 0; j--) {
+      const longDouble *a = sparseFactor_ + superStart_[iSuper] + j * number;
+      CoinWorkDouble value = work[first + j] * diagonal_[first + j];
+      for (int k = j + 1; k < number; k++)
+        value -= a[k] * work[which[k]];
+      work[first + j] = value;
+    }
+  }
+  for (i = 0; i < numberRows_; i++) {
+    int iRow = permute_[i];
+    region[iRow] = work[i];
+  }
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
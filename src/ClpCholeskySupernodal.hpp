@@ -0,0 +1,137 @@
+/* $Id$ */
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef ClpCholeskySupernodal_H
+#define ClpCholeskySupernodal_H
+
+#include "ClpCholeskyBase.hpp"
+
+/** Native supernodal Cholesky (LDL') factorization.
+
+    Uses ordering of ClpCholeskyBase.  Symbolic factorization finds
+    the elimination tree and fundamental supernodes.  Each supernode is
+    held as a dense column-major panel.  Factorization is left-looking -
+    a supernode gathers dense block updates from its descendants and then
+    factorizes its own panel.  Supernodes at the same level of the
+    supernodal elimination tree are independent so are done in parallel
+    (clpParallelRun).  Results do not depend on number of threads.
+    There is no BLAS in Clp so the block update L2*D*L1' is done by a
+    hand-written cache blocked kernel in the style of dsyrk/dgemm (blocks
+    of 64 rows and columns by 128 inner, four inner columns at a time).
+
+    Only normal equations (not KKT) and no dense columns.
+*/
+
+class CLPLIB_EXPORT ClpCholeskySupernodal : public ClpCholeskyBase {
+
+public:
+  /**@name Virtual methods that the derived classes provides  */
+  //@{
+  /** Orders rows and saves pointer to matrix.and model.
+      Returns non-zero if not enough memory */
+  virtual int order(ClpInterior *model);
+  /** Does Symbolic factorization given permutation.
+         This is called immediately after order.
+         returns non-zero if not enough memory */
+  virtual int symbolic();
+  /** Factorize - filling in rowsDropped and returning number dropped.
+         If return code negative then out of memory */
+  virtual int factorize(const CoinWorkDouble *diagonal, int *rowsDropped);
+  /** Uses factorization to solve. */
+  virtual void solve(CoinWorkDouble *region);
+  //@}
+
+  /**@name Gets and sets */
+  //@{
+  /// Number of threads (0 means use clpParallelThreads())
+  inline int numberThreads() const
+  {
+    return numberThreads_;
+  }
+  /// Set number of threads (0 means use clpParallelThreads())
+  inline void setNumberThreads(int value)
+  {
+    numberThreads_ = value;
+  }
+  /// Number of supernodes
+  inline int numberSupernodes() const
+  {
+    return numberSupernodes_;
+  }
+  /// Number of levels in supernodal elimination tree
+  inline int numberLevels() const
+  {
+    return numberLevels_;
+  }
+  //@}
+
+  /**@name Constructors, destructor */
+  //@{
+  /** Constructor */
+  ClpCholeskySupernodal(int numberThreads = 0);
+  /** Destructor  */
+  virtual ~ClpCholeskySupernodal();
+  /// Copy
+  ClpCholeskySupernodal(const ClpCholeskySupernodal &);
+  /// Assignment
+  ClpCholeskySupernodal &operator=(const ClpCholeskySupernodal &);
+  /// Clone
+  virtual ClpCholeskyBase *clone() const;
+  //@}
+
+  /**@name Used by parallel tasks */
+  //@{
+  /** Puts A*D*A' for columns of supernodes into panels.
+         Returns largest absolute value */
+  CoinWorkDouble assemble(int firstSuper, int lastSuper,
+    const CoinWorkDouble *diagonal, longDouble *work);
+  /** Gathers updates from descendants into supernode and factorizes it.
+         map is numberRows_ long, buffer is grown if needed.
+         Updates largest, smallest and numberDropped */
+  void factorizeSupernode(int iSuper, int *rowsDropped, int *map,
+    longDouble *&buffer, int &sizeBuffer,
+    CoinWorkDouble &largest, CoinWorkDouble &smallest,
+    int &numberDropped);
+  //@}
+
+private:
+  /// Frees supernode arrays
+  void gutsOfDestructor();
+  /// Copies supernode arrays
+  void gutsOfCopy(const ClpCholeskySupernodal &rhs);
+
+  /**@name Data members */
+  //@{
+  /// Number of threads
+  int numberThreads_;
+  /// Number of supernodes
+  int numberSupernodes_;
+  /// Number of levels
+  int numberLevels_;
+  /// First (permuted) column of each supernode (numberSupernodes_+1)
+  int *superFirst_;
+  /// Start of each supernode in superRow_ (numberSupernodes_+1)
+  int *superRowStart_;
+  /// Row structure of each supernode (own columns first and sorted)
+  int *superRow_;
+  /// Start of each supernode panel in sparseFactor_ (numberSupernodes_+1)
+  CoinBigIndex *superStart_;
+  /// Start of descendants updating each supernode (numberSupernodes_+1)
+  int *updateStart_;
+  /// Pairs of descendant supernode and first row position in it
+  int *updateList_;
+  /// Start of each level in levelList_ (numberLevels_+1)
+  int *levelStart_;
+  /// Supernodes in level order (leaves first)
+  int *levelList_;
+  /// Pivot values (zero if dropped)
+  longDouble *pivotValue_;
+  //@}
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -4,11 +4,16 @@
 // This code is licensed under the terms of the Eclipse Public License (EPL).
 
 #include "CoinPragma.hpp"
+#if ABOCA_LITE
+// 1 is not owner of abcState_
+#define ABCSTATE_LITE 1
+#endif
 #include "ClpSimplex.hpp"
 #include "ClpDualRowSteepest.hpp"
 #include "CoinIndexedVector.hpp"
 #include "ClpFactorization.hpp"
 #include "CoinHelperFunctions.hpp"
+#include "ClpHelperFunctions.hpp"
 #include <cstdio>
 //#############################################################################
 // Constructors / Destructor / Assignment
@@ -206,6 +211,120 @@ void ClpDualRowSteepest::fill(const ClpDualRowSteepest &rhs)
     dubiousWeights_ = NULL;
   }
 }
+#if ABOCA_LITE
+// Size of chunk for parallel choice of row
+#define CHUZR_CHUNK 4096
+// Minimum size of update before going parallel
+#define MINIMUM_PARALLEL_UPDATE 4096
+// Most candidates recorded per chunk before chunk is redone serially
+#define CHUZR_RECORDS 64
+typedef struct {
+  const double *infeas;
+  const double *weights;
+  const int *index;
+  const int *pivotVariable;
+  const unsigned char *status;
+  const double *solution;
+  const double *lower;
+  const double *upper;
+  double tolerance;
+  double startLargest;
+  int lastPivotRow;
+  int start[4];
+  // number of candidates (value > tolerance) in chunk
+  int numberCandidates;
+  // -1 if too many records
+  int numberRecords;
+  // candidate count before each record
+  int position[CHUZR_RECORDS];
+  int row[CHUZR_RECORDS];
+} clpChuzrInfo;
+/* Looks at up to two ranges of infeasibilities using serial test but
+   starting from startLargest.  Any candidate which would beat largest so
+   far is recorded so that merge can replay chunk with true largest and
+   true count of wanted */
+static void
+pivotRowBit(clpChuzrInfo &info)
+{
+  const double *COIN_RESTRICT infeas = info.infeas;
+  const double *COIN_RESTRICT weights = info.weights;
+  const int *COIN_RESTRICT index = info.index;
+  const int *COIN_RESTRICT pivotVariable = info.pivotVariable;
+  const unsigned char *COIN_RESTRICT status = info.status;
+  const double *COIN_RESTRICT solution = info.solution;
+  const double *COIN_RESTRICT lower = info.lower;
+  const double *COIN_RESTRICT upper = info.upper;
+  double tolerance = info.tolerance;
+  int lastPivotRow = info.lastPivotRow;
+  double largest = info.startLargest;
+  int numberCandidates = 0;
+  int numberRecords = 0;
+  for (int k = 0; k < 4; k += 2) {
+    for (int i = info.start[k]; i < info.start[k + 1]; i++) {
+      int iRow = index[i];
+      double value = infeas[iRow];
+      if (value > tolerance) {
+        double weight = CoinMin(weights[iRow], 1.0e50);
+        if (value > largest * weight) {
+          if (numberRecords < CHUZR_RECORDS) {
+            info.position[numberRecords] = numberCandidates;
+            info.row[numberRecords] = iRow;
+            numberRecords++;
+          } else {
+            numberRecords = -1;
+            break;
+          }
+          if (iRow == lastPivotRow)
+            value *= 1.0e-10;
+          int iSequence = pivotVariable[iRow];
+          if (value >= largest * weight && (status[iSequence] & 64) == 0) {
+            if (solution[iSequence] > upper[iSequence] + tolerance || solution[iSequence] < lower[iSequence] - tolerance)
+              largest = value / weight;
+          }
+        }
+        numberCandidates++;
+      }
+    }
+    if (numberRecords < 0)
+      break;
+  }
+  info.numberCandidates = numberCandidates;
+  info.numberRecords = numberRecords;
+}
+// Steepest edge update for part of updated column
+static void
+updateWeightsBit(clpTempInfo &info)
+{
+  const int *COIN_RESTRICT which = info.index;
+  const double *COIN_RESTRICT work = info.work;
+  const double *COIN_RESTRICT work2 = info.spare;
+  double *COIN_RESTRICT weights = info.solution;
+  double *COIN_RESTRICT work3 = info.infeas;
+  int *COIN_RESTRICT which3 = info.which;
+  const int *COIN_RESTRICT pivotColumn = info.pivotVariable;
+  double norm = info.theta;
+  double multiplier = info.changeObj;
+  int pivotRow = info.numberAdded;
+  double alpha = 0.0;
+  for (int i = 0; i < info.numberToDo; i++) {
+    int iRow = which[i];
+    double theta = work[i];
+    if (iRow == pivotRow)
+      alpha = theta;
+    double devex = weights[iRow];
+    work3[i] = devex; // save old
+    which3[i] = iRow;
+    // transform to match spare
+    int jRow = pivotColumn ? pivotColumn[iRow] : iRow;
+    double value = work2[jRow];
+    devex += theta * (theta * norm + value * multiplier);
+    if (devex < DEVEX_TRY_NORM)
+      devex = DEVEX_TRY_NORM;
+    weights[iRow] = devex;
+  }
+  info.primalRatio = alpha;
+}
+#endif
 // Returns pivot row, -1 if none
 int ClpDualRowSteepest::pivotRow()
 {
@@ -309,9 +428,132 @@ int ClpDualRowSteepest::pivotRow()
   double dstart = static_cast< double >(number) * model_->randomNumberGenerator()->randomDouble();
   start[0] = static_cast< int >(dstart);
   start[3] = start[0];
+  int firstPass = 0;
+#if ABOCA_LITE
+  int numberThreads = CoinMin(abcState(), ABOCA_LITE);
+  if (numberThreads > 1 && number > 4 * CHUZR_CHUNK && numberWanted > 0) {
+    /* Fixed size chunks in same order as below, a wave at a time.
+       Each chunk records the rows which could change largest or count
+       and chunks are then replayed in order with the serial test - so
+       pivot is same as serial and does not depend on number of threads */
+    clpChuzrInfo info[ABOCA_LITE];
+    int chunk = CoinMax(CHUZR_CHUNK, (number + 63) >> 6);
+    double startLargest = largest;
+    int position = 0;
+    while (position < number && numberWanted > 0) {
+      int numberChunks = 0;
+      while (numberChunks < numberThreads && position < number) {
+        clpChuzrInfo &infoC = info[numberChunks++];
+        int *startC = infoC.start;
+        int first = position + start[0];
+        int last = CoinMin(position + chunk, number) + start[0];
+        position += chunk;
+        if (first >= number) {
+          startC[0] = first - number;
+          startC[1] = last - number;
+          startC[2] = 0;
+          startC[3] = 0;
+        } else if (last <= number) {
+          startC[0] = first;
+          startC[1] = last;
+          startC[2] = 0;
+          startC[3] = 0;
+        } else {
+          startC[0] = first;
+          startC[1] = number;
+          startC[2] = 0;
+          startC[3] = last - number;
+        }
+        infoC.startLargest = startLargest;
+        infoC.infeas = infeas;
+        infoC.weights = weights_;
+        infoC.index = index;
+        infoC.pivotVariable = pivotVariable;
+        infoC.status = model_->statusArray();
+        infoC.solution = solution;
+        infoC.lower = lower;
+        infoC.upper = upper;
+        infoC.tolerance = tolerance;
+        infoC.lastPivotRow = lastPivotRow;
+      }
+      clpParallelFor(pivotRowBit, info, numberChunks);
+      for (int iChunk = 0; iChunk < numberChunks && numberWanted > 0; iChunk++) {
+        clpChuzrInfo &infoC = info[iChunk];
+        if (infoC.numberRecords >= 0) {
+          // replay - numberWanted only changes at candidates
+          int numberExtra = 0;
+          for (int j = 0; j < infoC.numberRecords; j++) {
+            int stopAt = numberWanted + numberExtra - 1;
+            if (infoC.position[j] > stopAt)
+              break;
+            iRow = infoC.row[j];
+            double value = infeas[iRow];
+            double weight = CoinMin(weights_[iRow], 1.0e50);
+            if (value > largest * weight) {
+              // make last pivot row last resort choice
+              if (iRow == lastPivotRow) {
+                if (value * 1.0e-10 < largest * weight) {
+                  numberExtra++;
+                  continue;
+                } else {
+                  value *= 1.0e-10;
+                }
+              }
+              int iSequence = pivotVariable[iRow];
+              if (!model_->flagged(iSequence)) {
+                if (solution[iSequence] > upper[iSequence] + tolerance || solution[iSequence] < lower[iSequence] - tolerance) {
+                  chosenRow = iRow;
+                  largest = value / weight;
+                }
+              } else {
+                numberExtra++;
+                continue;
+              }
+            }
+            if (infoC.position[j] == stopAt)
+              break;
+          }
+          numberWanted = CoinMax(numberWanted - infoC.numberCandidates + numberExtra, 0);
+          continue;
+        }
+        // too many records - do serially
+        for (int k = 0; k < 4 && numberWanted; k += 2) {
+          for (i = infoC.start[k]; i < infoC.start[k + 1]; i++) {
+            iRow = index[i];
+            double value = infeas[iRow];
+            if (value > tolerance) {
+              double weight = CoinMin(weights_[iRow], 1.0e50);
+              if (value > largest * weight) {
+                if (iRow == lastPivotRow) {
+                  if (value * 1.0e-10 < largest * weight)
+                    continue;
+                  else
+                    value *= 1.0e-10;
+                }
+                int iSequence = pivotVariable[iRow];
+                if (!model_->flagged(iSequence)) {
+                  if (solution[iSequence] > upper[iSequence] + tolerance || solution[iSequence] < lower[iSequence] - tolerance) {
+                    chosenRow = iRow;
+                    largest = value / weight;
+                  }
+                } else {
+                  numberWanted++;
+                }
+              }
+              numberWanted--;
+              if (!numberWanted)
+                break;
+            }
+          }
+        }
+      }
+    }
+    firstPass = 2;
+  }
+#endif
   //double largestWeight=0.0;
   //double smallestWeight=1.0e100;
-  for (iPass = 0; iPass < 2; iPass++) {
+  for (iPass = firstPass; iPass < 2; iPass++) {
     int end = start[2 * iPass + 1];
     for (i = start[2 * iPass]; i < end; i++) {
       iRow = index[i];
@@ -547,6 +789,36 @@ ClpDualRowSteepest::updateWeights(CoinIndexedVector *input,
     double *work3 = alternateWeights_->denseVector();
     int *which3 = alternateWeights_->getIndices();
     const int *pivotColumn = model_->factorization()->pivotColumn();
+#if ABOCA_LITE
+    int numberThreads = CoinMin(abcState(), ABOCA_LITE);
+    if (numberThreads > 1 && numberNonZero > MINIMUM_PARALLEL_UPDATE) {
+      // each entry independent so just split
+      clpTempInfo info[ABOCA_LITE];
+      int chunk = (numberNonZero + numberThreads - 1) / numberThreads;
+      int n = 0;
+      for (i = 0; i < numberThreads; i++) {
+        info[i].index = which + n;
+        info[i].work = work + n;
+        info[i].spare = work2;
+        info[i].solution = weights_;
+        info[i].infeas = work3 + n;
+        info[i].which = which3 + n;
+        info[i].pivotVariable = permute ? pivotColumn : NULL;
+        info[i].theta = norm;
+        info[i].changeObj = multiplier;
+        info[i].numberAdded = pivotRow;
+        info[i].numberToDo = CoinMax(CoinMin(chunk, numberNonZero - n), 0);
+        n += chunk;
+      }
+      clpParallelFor(updateWeightsBit, info, numberThreads);
+      for (i = 0; i < numberThreads; i++) {
+        if (info[i].primalRatio)
+          alpha = info[i].primalRatio;
+      }
+      nSave = numberNonZero;
+      numberNonZero = 0;
+    }
+#endif
     for (i = 0; i < numberNonZero; i++) {
       int iRow = which[i];
       double theta = work[i];
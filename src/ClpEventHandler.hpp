@@ -73,7 +73,8 @@ public:
     beforeCreateNonLinear,
     afterCreateNonLinear,
     startOfCrossover, // in Idiot
-    noTheta // At end (because no pivot)
+    noTheta, // At end (because no pivot)
+    adaptiveRefactorization // refactorization decided from measured times
   };
   /**@name Virtual method that the derived classes should provide.
       The base class instance does nothing and as event() is only useful method
@@ -30,8 +30,8 @@ const static bool doCheck = false;
 #ifndef CLP_FACTORIZATION_NEW_TIMING
 #define CLP_FACTORIZATION_NEW_TIMING
 #endif
-#ifdef CLP_FACTORIZATION_INSTRUMENT
 #include "CoinTime.hpp"
+#ifdef CLP_FACTORIZATION_INSTRUMENT
 double factorization_instrument(int type)
 {
   static int times[10] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
@@ -1035,6 +1035,17 @@ void ClpFactorization::updateTwoColumnsTranspose(CoinIndexedVector *regionSparse
   }
 #endif
 }
+/* Updates numberRhs columns (FTRAN) from regionSparse2 returning
+   total number of elements
+   region1 starts as zero and is zero at end */
+int ClpFactorization::updateColumns(CoinIndexedVector *regionSparse, int numberRhs,
+  CoinIndexedVector **regionSparse2) const
+{
+  int numberElements = 0;
+  for (int i = 0; i < numberRhs; i++)
+    numberElements += updateColumn(regionSparse, regionSparse2[i]);
+  return numberElements;
+}
 /* makes a row copy of L for speed and to allow very sparse problems */
 void ClpFactorization::goSparse()
 {
@@ -1154,6 +1165,7 @@ typedef CoinOslFactorization CoinOtherFactorization;
 #include "CoinOslFactorization.hpp"
 #endif
 #endif
+#include "ClpParallelFactorization.hpp"
 
 //-------------------------------------------------------------------
 // Default Constructor
@@ -1167,11 +1179,19 @@ ClpFactorization::ClpFactorization()
   coinFactorizationA_ = new CoinFactorization();
   coinFactorizationB_ = NULL;
   //coinFactorizationB_ = new CoinOtherFactorization();
+  coinFactorizationSaved_ = NULL;
   forceB_ = 0;
   goOslThreshold_ = -1;
   goDenseThreshold_ = -1;
   goSmallThreshold_ = -1;
   doStatistics_ = true;
+  clearDensityCounts();
+  factorizeTime_ = 0.0;
+  iterationsTime_ = 0.0;
+  recentTime_ = 0.0;
+  lastClock_ = 0.0;
+  adaptivePivots_ = 0;
+  bestPivots_ = 0;
   memset(&shortestAverage_, 0, 3 * (sizeof(double) + sizeof(int)));
 }
 
@@ -1195,6 +1215,13 @@ ClpFactorization::ClpFactorization(const ClpFactorization &rhs,
   goDenseThreshold_ = rhs.goDenseThreshold_;
   goSmallThreshold_ = rhs.goSmallThreshold_;
   doStatistics_ = rhs.doStatistics_;
+  memcpy(densityCount_, rhs.densityCount_, sizeof(densityCount_));
+  factorizeTime_ = rhs.factorizeTime_;
+  iterationsTime_ = rhs.iterationsTime_;
+  recentTime_ = rhs.recentTime_;
+  lastClock_ = rhs.lastClock_;
+  adaptivePivots_ = rhs.adaptivePivots_;
+  bestPivots_ = rhs.bestPivots_;
   int goDense = 0;
 #ifdef CLP_REUSE_ETAS
   model_ = rhs.model_;
@@ -1229,6 +1256,10 @@ ClpFactorization::ClpFactorization(const ClpFactorization &rhs,
     coinFactorizationB_ = rhs.coinFactorizationB_->clone();
   else
     coinFactorizationB_ = NULL;
+  if (rhs.coinFactorizationSaved_)
+    coinFactorizationSaved_ = rhs.coinFactorizationSaved_->clone();
+  else
+    coinFactorizationSaved_ = NULL;
 #if COIN_BIG_INDEX == 0
   if (goDense) {
     delete coinFactorizationB_;
@@ -1267,6 +1298,7 @@ ClpFactorization::ClpFactorization(const CoinFactorization &rhs)
 #endif
   coinFactorizationA_ = new CoinFactorization(rhs);
   coinFactorizationB_ = NULL;
+  coinFactorizationSaved_ = NULL;
 #ifdef CLP_FACTORIZATION_INSTRUMENT
   factorization_instrument(1);
 #endif
@@ -1275,6 +1307,13 @@ ClpFactorization::ClpFactorization(const CoinFactorization &rhs)
   goDenseThreshold_ = -1;
   goSmallThreshold_ = -1;
   doStatistics_ = true;
+  clearDensityCounts();
+  factorizeTime_ = 0.0;
+  iterationsTime_ = 0.0;
+  recentTime_ = 0.0;
+  lastClock_ = 0.0;
+  adaptivePivots_ = 0;
+  bestPivots_ = 0;
   assert(!coinFactorizationA_ || !coinFactorizationB_);
   memset(&shortestAverage_, 0, 3 * (sizeof(double) + sizeof(int)));
 }
@@ -1290,11 +1329,19 @@ ClpFactorization::ClpFactorization(const CoinOtherFactorization &rhs)
   coinFactorizationA_ = NULL;
   coinFactorizationB_ = rhs.clone();
   //coinFactorizationB_ = new CoinOtherFactorization(rhs);
+  coinFactorizationSaved_ = NULL;
   forceB_ = 0;
   goOslThreshold_ = -1;
   goDenseThreshold_ = -1;
   goSmallThreshold_ = -1;
   doStatistics_ = true;
+  clearDensityCounts();
+  factorizeTime_ = 0.0;
+  iterationsTime_ = 0.0;
+  recentTime_ = 0.0;
+  lastClock_ = 0.0;
+  adaptivePivots_ = 0;
+  bestPivots_ = 0;
 #ifdef CLP_FACTORIZATION_INSTRUMENT
   factorization_instrument(1);
 #endif
@@ -1312,6 +1359,7 @@ ClpFactorization::~ClpFactorization()
 #endif
   delete coinFactorizationA_;
   delete coinFactorizationB_;
+  delete coinFactorizationSaved_;
 }
 
 //----------------------------------------------------------------
@@ -1339,6 +1387,13 @@ ClpFactorization::operator=(const ClpFactorization &rhs)
     goDenseThreshold_ = rhs.goDenseThreshold_;
     goSmallThreshold_ = rhs.goSmallThreshold_;
     doStatistics_ = rhs.doStatistics_;
+    memcpy(densityCount_, rhs.densityCount_, sizeof(densityCount_));
+    factorizeTime_ = rhs.factorizeTime_;
+    iterationsTime_ = rhs.iterationsTime_;
+    recentTime_ = rhs.recentTime_;
+    lastClock_ = rhs.lastClock_;
+    adaptivePivots_ = rhs.adaptivePivots_;
+    bestPivots_ = rhs.bestPivots_;
     memcpy(&shortestAverage_, &rhs.shortestAverage_, 3 * (sizeof(double) + sizeof(int)));
     if (rhs.coinFactorizationA_) {
       if (coinFactorizationA_)
@@ -1376,6 +1431,11 @@ ClpFactorization::operator=(const ClpFactorization &rhs)
       coinFactorizationB_ = NULL;
     }
 #endif
+    delete coinFactorizationSaved_;
+    if (rhs.coinFactorizationSaved_)
+      coinFactorizationSaved_ = rhs.coinFactorizationSaved_->clone();
+    else
+      coinFactorizationSaved_ = NULL;
   }
 #ifdef CLP_FACTORIZATION_INSTRUMENT
   factorization_instrument(1);
@@ -1411,13 +1471,15 @@ void ClpFactorization::goDenseOrSmall(int numberRows)
   }
   assert(!coinFactorizationA_ || !coinFactorizationB_);
 }
-// If nonzero force use of 1,dense 2,small 3,osl
+// If nonzero force use of 1,dense 2,small 3,osl 5,parallel
 void ClpFactorization::forceOtherFactorization(int which)
 {
   delete coinFactorizationB_;
+  delete coinFactorizationSaved_;
   forceB_ = 0;
   coinFactorizationB_ = NULL;
-  if (which > 0 && which < 4) {
+  coinFactorizationSaved_ = NULL;
+  if ((which > 0 && which < 4) || which == 5) {
     delete coinFactorizationA_;
     coinFactorizationA_ = NULL;
     forceB_ = which;
@@ -1436,6 +1498,9 @@ void ClpFactorization::forceOtherFactorization(int which)
       goOslThreshold_ = COIN_INT_MAX;
       break;
 #endif
+    case 5:
+      coinFactorizationB_ = new ClpParallelFactorization();
+      break;
     }
   } else if (!coinFactorizationA_) {
     coinFactorizationA_ = new CoinFactorization();
@@ -1647,6 +1712,62 @@ bool ClpFactorization::timeToRefactorize() const
     return coinFactorizationB_->pivots() > coinFactorizationB_->numberRows() / 2.45 + 20;
   }
 #endif
+// Sets seconds taken by factorization and starts clock for iterations
+void ClpFactorization::setFactorizeTime(double seconds)
+{
+  factorizeTime_ = seconds;
+  iterationsTime_ = 0.0;
+  recentTime_ = 0.0;
+  lastClock_ = CoinGetTimeOfDay();
+}
+/* Adds time since last call (or factorization) to iteration time.
+   Returns 1 if cheaper to refactorize now, 0 if not and -1 if
+   times are too small to say */
+int ClpFactorization::timeIteration()
+{
+  int numberPivots = pivots();
+  if (!lastClock_ || numberPivots <= 0)
+    return -1;
+  double now = CoinGetTimeOfDay();
+  double time = now - lastClock_;
+  lastClock_ = now;
+  iterationsTime_ += time;
+  // first iteration also has cost of getting solution
+  if (numberPivots <= 2)
+    recentTime_ = time;
+  else
+    recentTime_ += 0.2 * (time - recentTime_);
+  // clock not good enough for very small problems
+  if (factorizeTime_ < 1.0e-4)
+    return -1;
+  // wait until smoothing means something
+  if (numberPivots < 10)
+    return 0;
+  double average = (factorizeTime_ + iterationsTime_) / numberPivots;
+  return (recentTime_ > average) ? 1 : 0;
+}
+/* Moves adaptivePivots when refactorization decided on - byTime
+   true if because of times.  Returns true if changed */
+bool ClpFactorization::adjustAdaptivePivots(bool byTime)
+{
+  int numberPivots = pivots();
+  int maximum = maximumPivots();
+  int current = adaptivePivots();
+  int wanted = current;
+  if (byTime) {
+    if (bestPivots_)
+      bestPivots_ = (3 * bestPivots_ + numberPivots + 2) / 4;
+    else
+      bestPivots_ = numberPivots;
+    wanted = 2 * bestPivots_;
+  } else if (numberPivots >= current) {
+    // never got to best - allow more
+    wanted = current + (current + 1) / 2;
+  }
+  wanted = CoinMax(CoinMin(wanted, maximum), CoinMin(20, maximum));
+  adaptivePivots_ = wanted;
+  return wanted != current;
+}
 int ClpFactorization::factorize(ClpSimplex *model,
   int solveType, bool valuesPass)
 {
@@ -1680,6 +1801,16 @@ scaledDense,scaledDense_2,scaledL,scaledR,scaledU\n");
     printf("maxfactor %d\n", coinFactorizationA_->maximumPivots());
 #endif
   bool anyChanged = false;
+  if (coinFactorizationSaved_) {
+    // last one was done by normal code - back to parallel
+    coinFactorizationSaved_->maximumPivots(coinFactorizationA_->maximumPivots());
+    coinFactorizationSaved_->pivotTolerance(coinFactorizationA_->pivotTolerance());
+    coinFactorizationSaved_->zeroTolerance(coinFactorizationA_->zeroTolerance());
+    delete coinFactorizationA_;
+    coinFactorizationA_ = NULL;
+    coinFactorizationB_ = coinFactorizationSaved_;
+    coinFactorizationSaved_ = NULL;
+  }
   if (coinFactorizationB_) {
     coinFactorizationB_->setStatus(-99);
     int *pivotVariable = model->pivotVariable();
@@ -1872,6 +2003,20 @@ scaledDense,scaledDense_2,scaledL,scaledR,scaledU\n");
 #endif
       coinFactorizationB_->preProcess();
       coinFactorizationB_->factor();
+      if (coinFactorizationB_->status() == -98) {
+        /* nucleus too big for parallel dense code - do this one with
+           normal code and try parallel again next time */
+        CoinOtherFactorization *parallel = coinFactorizationB_;
+        coinFactorizationB_ = NULL;
+        parallel->clearArrays();
+        coinFactorizationA_ = new CoinFactorization();
+        coinFactorizationA_->maximumPivots(parallel->maximumPivots());
+        coinFactorizationA_->pivotTolerance(parallel->pivotTolerance());
+        coinFactorizationA_->zeroTolerance(parallel->zeroTolerance());
+        int returnCode = factorize(model, solveType, valuesPass);
+        coinFactorizationSaved_ = parallel;
+        return returnCode;
+      }
       if (coinFactorizationB_->status() == -1 && (coinFactorizationB_->solveMode() % 3) != 0) {
         int solveMode = coinFactorizationB_->solveMode();
         solveMode -= solveMode % 3; // so bottom will be 0
@@ -2743,6 +2888,7 @@ int ClpFactorization::updateColumnFT(CoinIndexedVector *regionSparse,
 #ifdef CLP_FACTORIZATION_INSTRUMENT
     factorization_instrument(4);
 #endif
+    countDensity(0, regionSparse2->getNumElements());
     return returnCode;
 #ifndef SLIM_CLP
   } else {
@@ -2821,6 +2967,7 @@ int ClpFactorization::updateColumn(CoinIndexedVector *regionSparse,
 #ifdef CLP_FACTORIZATION_INSTRUMENT
     factorization_instrument(5);
 #endif
+    countDensity(0, regionSparse2->getNumElements());
     //#define PRINT_VECTOR
 #ifdef PRINT_VECTOR
     printf("Update\n");
@@ -2943,6 +3090,8 @@ int ClpFactorization::updateTwoColumnsFT(CoinIndexedVector *regionSparse1,
 #ifdef CLP_FACTORIZATION_INSTRUMENT
     factorization_instrument(9);
 #endif
+    countDensity(0, regionSparse2->getNumElements());
+    countDensity(0, regionSparse3->getNumElements());
 #ifdef PRINT_VECTOR
     printf("UpdateTwoFT\n");
     regionSparse2->print();
@@ -3005,6 +3154,7 @@ int ClpFactorization::updateColumnTranspose(CoinIndexedVector *regionSparse,
 #ifdef CLP_FACTORIZATION_INSTRUMENT
     factorization_instrument(6);
 #endif
+    countDensity(1, regionSparse2->getNumElements());
 #ifdef PRINT_VECTOR
     printf("UpdateTranspose\n");
     regionSparse2->print();
@@ -3087,6 +3237,8 @@ void ClpFactorization::updateTwoColumnsTranspose(CoinIndexedVector *regionSparse
 #ifdef CLP_FACTORIZATION_INSTRUMENT
     factorization_instrument(6);
 #endif
+    countDensity(1, regionSparse2->getNumElements());
+    countDensity(1, regionSparse3->getNumElements());
 #ifndef SLIM_CLP
   } else {
     updateColumnTranspose(regionSparse, regionSparse2);
@@ -3094,6 +3246,37 @@ void ClpFactorization::updateTwoColumnsTranspose(CoinIndexedVector *regionSparse
   }
 #endif
 }
+/* Updates numberRhs columns (FTRAN) from regionSparse2 returning
+   total number of elements.  ClpParallelFactorization goes through
+   factors once for a block of columns, otherwise one by one.
+   region1 starts as zero and is zero at end */
+int ClpFactorization::updateColumns(CoinIndexedVector *regionSparse, int numberRhs,
+  CoinIndexedVector **regionSparse2) const
+{
+  if (!numberRows())
+    return 0;
+  ClpParallelFactorization *parallel = NULL;
+#ifndef SLIM_CLP
+  if (!networkBasis_)
+#endif
+    parallel = dynamic_cast< ClpParallelFactorization * >(coinFactorizationB_);
+  if (!parallel || numberRhs == 1) {
+    int numberElements = 0;
+    for (int i = 0; i < numberRhs; i++)
+      numberElements += updateColumn(regionSparse, regionSparse2[i]);
+    return numberElements;
+  }
+#ifdef CLP_FACTORIZATION_INSTRUMENT
+  factorization_instrument(-1);
+#endif
+  int numberElements = parallel->updateColumns(regionSparse, numberRhs, regionSparse2);
+#ifdef CLP_FACTORIZATION_INSTRUMENT
+  factorization_instrument(5);
+#endif
+  for (int i = 0; i < numberRhs; i++)
+    countDensity(0, regionSparse2[i]->getNumElements());
+  return numberElements;
+}
 /* makes a row copy of L for speed and to allow very sparse problems */
 void ClpFactorization::goSparse()
 {
@@ -142,6 +142,14 @@ public:
   void updateTwoColumnsTranspose(CoinIndexedVector *regionSparse,
     CoinIndexedVector *regionSparse2,
     CoinIndexedVector *regionSparse3) const;
+  /** Updates numberRhs columns (FTRAN) from regionSparse2 returning
+         total number of elements.  ClpParallelFactorization goes through
+         factors once for a block of columns.  Other factorizations
+         (including default CoinFactorization) still solve the columns one
+         at a time so only save call overhead.
+	 region1 starts as zero and is zero at end */
+  int updateColumns(CoinIndexedVector *regionSparse, int numberRhs,
+    CoinIndexedVector **regionSparse2) const;
   //@}
 #ifdef CLP_MULTIPLE_FACTORIZATIONS
   /**@name Lifted from CoinFactorization */
@@ -416,7 +424,9 @@ public:
       coinFactorizationA_->zeroTolerance(1.0e-13);
     }
   }
-  /// If nonzero force use of 1,dense 2,small 3,osl
+  /** If nonzero force use of 1,dense 2,small 3,osl 5,parallel.
+      Hyper-sparse solves with cached reach are only in 5 (ClpParallelFactorization)
+      so are not used by default */
   void forceOtherFactorization(int which);
   /// Get switch to osl if number rows <= this
   inline int goOslThreshold() const
@@ -462,6 +472,11 @@ public:
   {
     return coinFactorizationA_;
   }
+  /// Return coinFactorizationB_ (dense, small, osl or parallel)
+  inline CoinOtherFactorization *coinOtherFactorization() const
+  {
+    return coinFactorizationB_;
+  }
 #else
   inline bool timeToRefactorize() const
   {
@@ -509,8 +524,82 @@ public:
 #endif
   /// Fills weighted row list
   void getWeights(int *weights) const;
+  /** Counts of FTRAN results (0-3) and BTRAN results (4-7) with
+      up to 1%, 10%, 50% and more of rows nonzero */
+  inline const int *densityCounts() const
+  {
+    return densityCount_;
+  }
+  /// Zeroes density counts
+  inline void clearDensityCounts() const
+  {
+    for (int i = 0; i < 8; i++)
+      densityCount_[i] = 0;
+  }
+  //@}
+
+  /**@name Refactorization from measured times
+      Used if ClpSimplex::moreSpecialOptions() has 33554432 bit.
+      Average time per iteration (including factorization) is least
+      when an iteration takes as long as the average, so refactorization
+      is when smoothed time of recent iterations goes above average.
+      Number of pivots allowed is then moved towards twice smoothed
+      number at which this happened - never above maximumPivots as
+      that sizes arrays. */
+  //@{
+  /// Sets seconds taken by factorization and starts clock for iterations
+  void setFactorizeTime(double seconds);
+  /** Adds time since last call (or factorization) to iteration time.
+      Returns 1 if cheaper to refactorize now, 0 if not and -1 if
+      times are too small to say */
+  int timeIteration();
+  /** Moves adaptivePivots when refactorization decided on - byTime
+      true if because of times.  Returns true if changed */
+  bool adjustAdaptivePivots(bool byTime);
+  /// Pivots allowed before refactorization (maximumPivots if not set)
+  inline int adaptivePivots() const
+  {
+    int maximum = maximumPivots();
+    return (adaptivePivots_ > 0 && adaptivePivots_ < maximum) ? adaptivePivots_ : maximum;
+  }
+  /// Seconds for last factorization
+  inline double factorizeTime() const
+  {
+    return factorizeTime_;
+  }
+  /// Average seconds per iteration since last factorization (including it)
+  inline double averageIterationTime() const
+  {
+    int numberPivots = pivots();
+    return numberPivots > 0 ? (factorizeTime_ + iterationsTime_) / numberPivots : 0.0;
+  }
+  /// Smoothed seconds for recent iterations
+  inline double recentIterationTime() const
+  {
+    return recentTime_;
+  }
+  /// Smoothed number of pivots when refactorized because of times
+  inline int bestPivots() const
+  {
+    return bestPivots_;
+  }
   //@}
 
+private:
+  /// Adds result of FTRAN (0) or BTRAN (1) to density counts
+  inline void countDensity(int which, int number) const
+  {
+    int numberRows = this->numberRows();
+    int k = 3;
+    if (number * 100 <= numberRows)
+      k = 0;
+    else if (number * 10 <= numberRows)
+      k = 1;
+    else if (number * 2 <= numberRows)
+      k = 2;
+    densityCount_[4 * which + k]++;
+  }
+
   ////////////////// data //////////////////
 private:
   /**@name data */
@@ -524,11 +613,14 @@ private:
   CoinFactorization *coinFactorizationA_;
   /// Pointer to CoinOtherFactorization
   CoinOtherFactorization *coinFactorizationB_;
+  /** Parallel factorization put aside while one factorization is done
+      by CoinFactorization (nucleus too big) - tried again next time */
+  CoinOtherFactorization *coinFactorizationSaved_;
 #ifdef CLP_REUSE_ETAS
   /// Pointer to model
   ClpSimplex *model_;
 #endif
-  /// If nonzero force use of 1,dense 2,small 3,osl
+  /// If nonzero force use of 1,dense 2,small 3,osl 5,parallel
   int forceB_;
   /// Switch to osl if number rows <= this
   int goOslThreshold_;
@@ -548,6 +640,19 @@ private:
 #endif
   /// To switch statistics on or off
   mutable bool doStatistics_;
+  /// FTRAN and BTRAN results by density
+  mutable int densityCount_[8];
+  /// Seconds for last factorization and for iterations since
+  double factorizeTime_;
+  double iterationsTime_;
+  /// Smoothed seconds for recent iterations
+  double recentTime_;
+  /// Clock at end of last factorization or iteration (0.0 if not timed)
+  double lastClock_;
+  /// Pivots allowed before refactorization (0 if not set)
+  int adaptivePivots_;
+  /// Smoothed number of pivots when refactorized because of times
+  int bestPivots_;
   //@}
 };
 
@@ -15,6 +15,7 @@
 #include <cmath>
 #include "CoinHelperFunctions.hpp"
 #include "CoinTypes.hpp"
+#include "ClpHelperFunctions.hpp"
 
 double
 maximumAbsElement(const double *region, int size)
@@ -111,6 +112,152 @@ void getNorms(const double *region, int size, double &norm1, double &norm2)
     norm1 = CoinMax(norm1, fabs(region[i]));
   }
 }
+#ifdef CLP_THREAD_POOL
+#include <pthread.h>
+#ifndef CLP_MAX_POOL_THREADS
+#define CLP_MAX_POOL_THREADS 64
+#endif
+/*
+  One job at a time is given to pool.  Workers sleep on workWaiting
+  until there are tasks left in current job, take next one under lock
+  and say when all done.  Caller does tasks as well.
+*/
+static pthread_mutex_t clpPoolOwner = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t clpPoolMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t clpPoolWorkWaiting = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t clpPoolAllDone = PTHREAD_COND_INITIALIZER;
+static pthread_t clpPoolThread[CLP_MAX_POOL_THREADS];
+static int clpPoolNumberWorkers = 0;
+static bool clpPoolStop = false;
+static ClpParallelTask clpPoolTask = NULL;
+static void *clpPoolData = NULL;
+static int clpPoolNext = 0;
+static int clpPoolNumberTasks = 0;
+static int clpPoolNumberDone = 0;
+// Take tasks from current job until none left - mutex must be locked
+static void clpPoolDoTasks()
+{
+  while (clpPoolNext < clpPoolNumberTasks) {
+    int which = clpPoolNext++;
+    ClpParallelTask task = clpPoolTask;
+    void *data = clpPoolData;
+    pthread_mutex_unlock(&clpPoolMutex);
+    task(data, which);
+    pthread_mutex_lock(&clpPoolMutex);
+    if (++clpPoolNumberDone == clpPoolNumberTasks)
+      pthread_cond_broadcast(&clpPoolAllDone);
+  }
+}
+static void *clpPoolWorker(void *)
+{
+  pthread_mutex_lock(&clpPoolMutex);
+  while (!clpPoolStop) {
+    if (clpPoolNext < clpPoolNumberTasks)
+      clpPoolDoTasks();
+    else
+      pthread_cond_wait(&clpPoolWorkWaiting, &clpPoolMutex);
+  }
+  pthread_mutex_unlock(&clpPoolMutex);
+  return NULL;
+}
+// Stop or start workers - clpPoolOwner must be locked
+static void clpPoolResize(int numberWorkers)
+{
+  numberWorkers = CoinMax(0, CoinMin(numberWorkers, CLP_MAX_POOL_THREADS));
+  if (numberWorkers < clpPoolNumberWorkers) {
+    pthread_mutex_lock(&clpPoolMutex);
+    clpPoolStop = true;
+    pthread_cond_broadcast(&clpPoolWorkWaiting);
+    pthread_mutex_unlock(&clpPoolMutex);
+    for (int i = 0; i < clpPoolNumberWorkers; i++)
+      pthread_join(clpPoolThread[i], NULL);
+    clpPoolStop = false;
+    clpPoolNumberWorkers = 0;
+  }
+  while (clpPoolNumberWorkers < numberWorkers) {
+    if (pthread_create(clpPoolThread + clpPoolNumberWorkers, NULL,
+          clpPoolWorker, NULL))
+      break; // just use what we have
+    clpPoolNumberWorkers++;
+  }
+}
+// So workers are stopped cleanly at exit
+class ClpPoolCleanup {
+public:
+  ~ClpPoolCleanup()
+  {
+    pthread_mutex_lock(&clpPoolOwner);
+    clpPoolResize(0);
+    pthread_mutex_unlock(&clpPoolOwner);
+  }
+};
+static ClpPoolCleanup clpPoolCleanup;
+#elif ABOCA_LITE
+#ifndef FAKE_CILK
+#include <cilk/cilk.h>
+#else
+#define cilk_spawn
+#define cilk_sync
+#endif
+#endif
+void clpParallelRun(ClpParallelTask task, void *data, int numberTasks)
+{
+#ifdef CLP_THREAD_POOL
+  if (numberTasks > 1 && !pthread_mutex_trylock(&clpPoolOwner)) {
+    // pool is not grown here - workers take extra tasks as they finish
+    if (!clpPoolNumberWorkers) {
+      pthread_mutex_unlock(&clpPoolOwner);
+      for (int i = 0; i < numberTasks; i++)
+        task(data, i);
+      return;
+    }
+    pthread_mutex_lock(&clpPoolMutex);
+    clpPoolTask = task;
+    clpPoolData = data;
+    clpPoolNumberDone = 0;
+    clpPoolNext = 0;
+    clpPoolNumberTasks = numberTasks;
+    pthread_cond_broadcast(&clpPoolWorkWaiting);
+    clpPoolDoTasks();
+    while (clpPoolNumberDone < numberTasks)
+      pthread_cond_wait(&clpPoolAllDone, &clpPoolMutex);
+    clpPoolNumberTasks = 0;
+    clpPoolNext = 0;
+    pthread_mutex_unlock(&clpPoolMutex);
+    pthread_mutex_unlock(&clpPoolOwner);
+    return;
+  }
+#elif ABOCA_LITE
+  if (numberTasks > 1) {
+    for (int i = 0; i < numberTasks; i++)
+      cilk_spawn task(data, i);
+    cilk_sync;
+    return;
+  }
+#endif
+  for (int i = 0; i < numberTasks; i++)
+    task(data, i);
+}
+int clpSetParallelThreads(int numberThreads)
+{
+#ifdef CLP_THREAD_POOL
+  pthread_mutex_lock(&clpPoolOwner);
+  int oldNumber = clpPoolNumberWorkers + 1;
+  clpPoolResize(numberThreads - 1);
+  pthread_mutex_unlock(&clpPoolOwner);
+  return oldNumber;
+#else
+  return 1;
+#endif
+}
+int clpParallelThreads()
+{
+#ifdef CLP_THREAD_POOL
+  return clpPoolNumberWorkers + 1;
+#else
+  return 1;
+#endif
+}
 #ifndef NDEBUG
 #include "ClpModel.hpp"
 #include "ClpMessage.hpp"
@@ -81,6 +81,47 @@ inline double CoinSqrt(double x)
   return sqrt(x);
 }
 #endif
+/** Parallel tasks.
+    If built with CLP_THREAD_POOL (configure --enable-clp-threads) a pool
+    of persistent pthread workers is used.  The pool is only resized by
+    clpSetParallelThreads - if there are more tasks than threads workers
+    take the extra ones as they finish.  Otherwise if ABOCA_LITE is using cilk tasks
+    are spawned and if neither tasks are just done in order.
+    Each task must only write to its own part of the output so that
+    results do not depend on the number of threads.  The caller always
+    does some of the tasks and only returns when all are finished.
+    If the pool is already busy (another model or nested call) tasks
+    are done serially by the caller.
+*/
+typedef void (*ClpParallelTask)(void *data, int which);
+/// Does task(data,i) for i=0..numberTasks-1 - possibly in parallel
+void clpParallelRun(ClpParallelTask task, void *data, int numberTasks);
+/** Sets number of threads in pool (including caller) and returns old value.
+    0 or 1 stops all workers.  Does nothing without CLP_THREAD_POOL */
+int clpSetParallelThreads(int numberThreads);
+/// Number of threads in pool (including caller)
+int clpParallelThreads();
+/// For clpParallelFor
+template < class T >
+struct ClpParallelForData {
+  void (*work)(T &);
+  T *info;
+};
+template < class T >
+void clpParallelForTask(void *data, int which)
+{
+  ClpParallelForData< T > *stuff = static_cast< ClpParallelForData< T > * >(data);
+  stuff->work(stuff->info[which]);
+}
+/// Does work(info[i]) for i=0..numberTasks-1 - possibly in parallel
+template < class T >
+inline void clpParallelFor(void (*work)(T &), T *info, int numberTasks)
+{
+  ClpParallelForData< T > stuff;
+  stuff.work = work;
+  stuff.info = info;
+  clpParallelRun(clpParallelForTask< T >, &stuff, numberTasks);
+}
 /// Trace
 #ifdef NDEBUG
 #define ClpTraceDebug(expression) \
@@ -102,6 +102,8 @@ ClpInterior::ClpInterior()
   , numberComplementarityPairs_(0)
   , numberComplementarityItems_(0)
   , maximumBarrierIterations_(200)
+  , maximumCorrectors_(5)
+  , warmStart_(NULL)
   , gonePrimalFeasible_(false)
   , goneDualFeasible_(false)
   , algorithm_(-1)
@@ -191,6 +193,8 @@ ClpInterior::ClpInterior(const ClpModel *rhs,
   , numberComplementarityPairs_(0)
   , numberComplementarityItems_(0)
   , maximumBarrierIterations_(200)
+  , maximumCorrectors_(5)
+  , warmStart_(NULL)
   , gonePrimalFeasible_(false)
   , goneDualFeasible_(false)
   , algorithm_(-1)
@@ -262,6 +266,7 @@ ClpInterior::ClpInterior(const ClpInterior &rhs)
   , zVec_(NULL)
   , wVec_(NULL)
   , cholesky_(NULL)
+  , warmStart_(NULL)
 {
   gutsOfDelete();
   gutsOfCopy(rhs);
@@ -343,6 +348,8 @@ ClpInterior::ClpInterior(const ClpModel &rhs)
   , numberComplementarityPairs_(0)
   , numberComplementarityItems_(0)
   , maximumBarrierIterations_(200)
+  , maximumCorrectors_(5)
+  , warmStart_(NULL)
   , gonePrimalFeasible_(false)
   , goneDualFeasible_(false)
   , algorithm_(-1)
@@ -439,6 +446,8 @@ void ClpInterior::gutsOfCopy(const ClpInterior &rhs)
   numberComplementarityPairs_ = rhs.numberComplementarityPairs_;
   numberComplementarityItems_ = rhs.numberComplementarityItems_;
   maximumBarrierIterations_ = rhs.maximumBarrierIterations_;
+  maximumCorrectors_ = rhs.maximumCorrectors_;
+  warmStart_ = ClpCopyOfArray(rhs.warmStart_, numberColumns_ + 2 * numberRows_);
   gonePrimalFeasible_ = rhs.gonePrimalFeasible_;
   goneDualFeasible_ = rhs.goneDualFeasible_;
   algorithm_ = rhs.algorithm_;
@@ -514,6 +523,8 @@ void ClpInterior::gutsOfDelete()
   zVec_ = NULL;
   delete[] wVec_;
   wVec_ = NULL;
+  delete[] warmStart_;
+  warmStart_ = NULL;
   delete cholesky_;
 }
 bool ClpInterior::createWorkingData()
@@ -672,6 +683,8 @@ bool ClpInterior::createWorkingData()
 void ClpInterior::deleteWorkingData()
 {
   int i;
+  // duals have already been multiplied by scaleFactor_ in solve
+  // (scaleWarmStart must undo the same steps)
   if (optimizationDirection_ != 1.0 || objectiveScale_ != 1.0) {
     CoinWorkDouble scaleC = optimizationDirection_ / objectiveScale_;
     // and modify all dual signs
@@ -738,6 +751,46 @@ void ClpInterior::deleteWorkingData()
   delete[] dj_;
   dj_ = NULL;
 }
+/* Scales warm start into primal (columns then rows) and dual.
+   Reverse of scaleFactor_ at end of ClpPredictorCorrector::solve and
+   then deleteWorkingData - so must use same factors in reverse order */
+void ClpInterior::scaleWarmStart(CoinWorkDouble *primal, CoinWorkDouble *dual) const
+{
+  const double *columnWarm = warmStart_;
+  const double *rowWarm = warmStart_ + numberColumns_;
+  const double *dualWarm = rowWarm + numberRows_;
+  int i;
+  for (i = 0; i < numberColumns_; i++)
+    primal[i] = columnWarm[i];
+  for (i = 0; i < numberRows_; i++) {
+    primal[numberColumns_ + i] = rowWarm[i];
+    dual[i] = dualWarm[i];
+  }
+  if (rowScale_) {
+    for (i = 0; i < numberColumns_; i++)
+      primal[i] = (primal[i] * rhsScale_) / columnScale_[i];
+    for (i = 0; i < numberRows_; i++) {
+      CoinWorkDouble scaleFactor = rowScale_[i];
+      primal[numberColumns_ + i] = primal[numberColumns_ + i] * rhsScale_ * scaleFactor;
+      dual[i] /= scaleFactor;
+    }
+  } else if (rhsScale_ != 1.0) {
+    for (i = 0; i < numberColumns_ + numberRows_; i++)
+      primal[i] *= rhsScale_;
+  }
+  if (optimizationDirection_ != 1.0 || objectiveScale_ != 1.0) {
+    CoinWorkDouble scaleC = optimizationDirection_ / objectiveScale_;
+    if (scaleC) {
+      for (i = 0; i < numberRows_; i++)
+        dual[i] /= scaleC;
+    }
+  }
+  // scaleFactor_ as for this solve
+  if (scaleFactor_ && scaleFactor_ != 1.0) {
+    for (i = 0; i < numberRows_; i++)
+      dual[i] /= scaleFactor_;
+  }
+}
 // Sanity check on input data - returns true if okay
 bool ClpInterior::sanityCheck()
 {
@@ -1074,6 +1127,51 @@ void ClpInterior::setCholesky(ClpCholeskyBase *cholesky)
   delete cholesky_;
   cholesky_ = cholesky;
 }
+/* Warm start next primalDual.  NULL means use current values in model
+   (row activities are then computed from column activities if those
+   were given) */
+void ClpInterior::setWarmStart(const double *columnActivity, const double *rowActivity,
+  const double *rowDual)
+{
+  delete[] warmStart_;
+  warmStart_ = new double[numberColumns_ + 2 * numberRows_];
+  double *columnWarm = warmStart_;
+  double *rowWarm = warmStart_ + numberColumns_;
+  double *dualWarm = rowWarm + numberRows_;
+  CoinMemcpyN(columnActivity ? columnActivity : columnActivity_, numberColumns_, columnWarm);
+  if (rowActivity) {
+    CoinMemcpyN(rowActivity, numberRows_, rowWarm);
+  } else if (columnActivity) {
+    CoinZeroN(rowWarm, numberRows_);
+    matrix_->times(1.0, columnWarm, rowWarm);
+  } else {
+    CoinMemcpyN(rowActivity_, numberRows_, rowWarm);
+  }
+  CoinMemcpyN(rowDual ? rowDual : dual_, numberRows_, dualWarm);
+}
+// Clears warm start
+void ClpInterior::clearWarmStart()
+{
+  delete[] warmStart_;
+  warmStart_ = NULL;
+}
+// Returns copy of Cholesky with symbolic factorization (or NULL)
+ClpCholeskyBase *ClpInterior::exportSymbolic() const
+{
+  if (!cholesky_ || !cholesky_->structureHash())
+    return NULL;
+  return cholesky_->clone();
+}
+// Uses copy of exported symbolic factorization if structure matches
+int ClpInterior::importSymbolic(const ClpCholeskyBase *symbolic)
+{
+  if (!symbolic || !symbolic->structureHash()
+    || symbolic->structureHash() != ClpCholeskyBase::computeStructureHash(this))
+    return 1;
+  delete cholesky_;
+  cholesky_ = symbolic->clone();
+  return 0;
+}
 /* Borrow model.  This is so we dont have to copy large amounts
    of data around.  It assumes a derived class wants to overwrite
    an empty model with a real one - while it does an algorithm.
@@ -278,8 +278,44 @@ public:
   {
     maximumBarrierIterations_ = value;
   }
+  /** Maximum number of centrality correctors per iteration (default 5).
+      -1 chooses 5 to 9 from cost of factorization relative to solve */
+  inline int maximumCorrectors() const
+  {
+    return maximumCorrectors_;
+  }
+  inline void setMaximumCorrectors(int value)
+  {
+    maximumCorrectors_ = value;
+  }
   /// Set cholesky (and delete present one)
   void setCholesky(ClpCholeskyBase *cholesky);
+  /** Warm start next primalDual from a previous solution e.g. of a
+      slightly different problem.  Any array may be NULL in which case
+      current solution in model is used (so after primalDual just call
+      setWarmStart()).  Point is shifted into interior.  Used once.
+      If sparsity pattern of matrix is unchanged then ordering and
+      symbolic factorization are reused anyway */
+  void setWarmStart(const double *columnActivity = NULL,
+    const double *rowActivity = NULL,
+    const double *rowDual = NULL);
+  /// Clears warm start
+  void clearWarmStart();
+  /** Returns copy of Cholesky after ordering and symbolic factorization
+      (permutation, elimination tree, supernodes and storage) so it can be
+      cached and given to importSymbolic of this or another ClpInterior
+      with same structure.  NULL if no valid symbolic factorization */
+  ClpCholeskyBase *exportSymbolic() const;
+  /** Uses copy of symbolic (from exportSymbolic) as Cholesky so next
+      primalDual skips ordering and symbolic factorization.
+      Returns 0 if imported, 1 if structural hash does not match matrix
+      (Cholesky left alone) */
+  int importSymbolic(const ClpCholeskyBase *symbolic);
+  /// Whether warm start set
+  inline bool warmStart() const
+  {
+    return warmStart_ != NULL;
+  }
   /// Return number fixed to see if worth presolving
   int numberFixed() const;
   /** fix variables interior says should be.  If reallyFix false then just
@@ -307,6 +343,10 @@ protected:
   /// Returns true if data looks okay, false if not
   bool createWorkingData();
   void deleteWorkingData();
+  /** Scales warm start into primal (columns then rows) and dual.
+      Exact reverse of unscaling i.e. scaleFactor_ at end of
+      ClpPredictorCorrector::solve and then deleteWorkingData */
+  void scaleWarmStart(CoinWorkDouble *primal, CoinWorkDouble *dual) const;
   /// Sanity check on input rim data
   bool sanityCheck();
   ///  This does housekeeping
@@ -596,6 +636,10 @@ protected:
   int numberComplementarityItems_;
   /// Maximum iterations
   int maximumBarrierIterations_;
+  /// Maximum centrality correctors (default 5, -1 automatic)
+  int maximumCorrectors_;
+  /// Warm start - column and row activities then row duals (or NULL)
+  double *warmStart_;
   /// gonePrimalFeasible.
   bool gonePrimalFeasible_;
   /// goneDualFeasible.
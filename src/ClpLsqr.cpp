@@ -19,7 +19,7 @@ void ClpLsqr::do_lsqr(CoinDenseVector< double > &b,
      */
 
   //     Initialize.
-  static char term_msg[8][80] = {
+  static const char term_msg[8][80] = {
     "The exact solution is x = 0",
     "The residual Ax - b is small enough, given ATOL and BTOL",
     "The least squares error is small enough, given ATOL",
@@ -36,6 +36,7 @@ void ClpLsqr::do_lsqr(CoinDenseVector< double > &b,
   char str1[100], str2[100], str3[100], str4[100], head1[100], head2[100];
 
   int n = ncols_; // set  m,n from lsqr object
+  ClpPdco *pdcoModel = (ClpPdco *)model_;
 
   *itn = 0;
   *istop = 0;
@@ -64,7 +65,7 @@ void ClpLsqr::do_lsqr(CoinDenseVector< double > &b,
     u = (1 / beta) * u;
     matVecMult(2, v, u);
     if (precon)
-      v = v * Pr;
+      pdcoModel->matPreconApply(2, v, Pr);
     alfa = v.twoNorm();
   }
   if (alfa > 0) {
@@ -106,7 +107,8 @@ void ClpLsqr::do_lsqr(CoinDenseVector< double > &b,
 
     u.scale((-alfa));
     if (precon) {
-      CoinDenseVector< double > pv(v * Pr);
+      CoinDenseVector< double > pv(v);
+      pdcoModel->matPreconApply(1, pv, Pr);
       matVecMult(1, u, pv);
     } else {
       matVecMult(1, u, v);
@@ -120,7 +122,7 @@ void ClpLsqr::do_lsqr(CoinDenseVector< double > &b,
       vv.clear();
       matVecMult(2, vv, u);
       if (precon)
-        vv = vv * Pr;
+        pdcoModel->matPreconApply(2, vv, Pr);
       v = v + vv;
       alfa = v.twoNorm();
       if (alfa > 0)
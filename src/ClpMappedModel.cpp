@@ -0,0 +1,147 @@
+/* $Id$ */
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CoinPragma.hpp"
+
+#include <cstdio>
+#include <cstring>
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+#define CLP_HAS_MMAP
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "CoinHelperFunctions.hpp"
+#include "ClpMappedModel.hpp"
+
+//#############################################################################
+// ClpMappedFile
+//#############################################################################
+
+ClpMappedFile::ClpMappedFile()
+  : base_(NULL)
+  , size_(0)
+  , references_(1)
+  , mapped_(false)
+{
+}
+
+ClpMappedFile::~ClpMappedFile()
+{
+#ifdef CLP_HAS_MMAP
+  if (mapped_) {
+    munmap(base_, size_);
+    base_ = NULL;
+  }
+#endif
+  delete[] base_;
+}
+// Maps file - returns NULL if can not
+ClpMappedFile *
+ClpMappedFile::open(const char *fileName)
+{
+  ClpMappedFile *file = NULL;
+#ifdef CLP_HAS_MMAP
+  int fd = ::open(fileName, O_RDONLY);
+  if (fd < 0)
+    return NULL;
+  struct stat statBuffer;
+  if (!fstat(fd, &statBuffer) && statBuffer.st_size > 0) {
+    size_t size = static_cast< size_t >(statBuffer.st_size);
+    // private so changes are not written back
+    void *base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    if (base != MAP_FAILED) {
+      file = new ClpMappedFile();
+      file->base_ = static_cast< char * >(base);
+      file->size_ = size;
+      file->mapped_ = true;
+    }
+  }
+  close(fd);
+  if (file)
+    return file;
+#endif
+  // read into memory
+  FILE *fp = fopen(fileName, "rb");
+  if (!fp)
+    return NULL;
+  fseek(fp, 0, SEEK_END);
+  long size = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  if (size > 0) {
+    file = new ClpMappedFile();
+    file->base_ = new char[size];
+    file->size_ = static_cast< size_t >(size);
+    if (fread(file->base_, 1, file->size_, fp) != file->size_) {
+      file->release();
+      file = NULL;
+    }
+  }
+  fclose(fp);
+  return file;
+}
+// Drops a reference - unmaps and deletes when last one goes
+void ClpMappedFile::release()
+{
+  references_--;
+  if (!references_)
+    delete this;
+}
+
+//#############################################################################
+// ClpMappedMatrix
+//#############################################################################
+
+ClpMappedMatrix::ClpMappedMatrix(ClpMappedFile *file, int numberRows, int numberColumns,
+  CoinBigIndex numberElements, double *element, int *index,
+  CoinBigIndex *start, int *length)
+  : CoinPackedMatrix()
+  , file_(file)
+{
+  setExtraGap(0.0);
+  setExtraMajor(0.0);
+  assignMatrix(true, numberRows, numberColumns, numberElements,
+    element, index, start, length);
+  file_->addReference();
+}
+
+ClpMappedMatrix::~ClpMappedMatrix()
+{
+  if (file_) {
+    // arrays in file are not ours to delete
+    if (file_->contains(element_))
+      element_ = NULL;
+    if (file_->contains(index_))
+      index_ = NULL;
+    if (file_->contains(start_))
+      start_ = NULL;
+    if (file_->contains(length_))
+      length_ = NULL;
+    file_->release();
+    file_ = NULL;
+  }
+}
+// Copies any arrays still in file and drops reference
+void ClpMappedMatrix::unmap()
+{
+  if (!file_)
+    return;
+  if (file_->contains(element_))
+    element_ = CoinCopyOfArray(element_, size_);
+  if (file_->contains(index_))
+    index_ = CoinCopyOfArray(index_, size_);
+  if (file_->contains(start_))
+    start_ = CoinCopyOfArray(start_, majorDim_ + 1);
+  if (file_->contains(length_))
+    length_ = CoinCopyOfArray(length_, majorDim_);
+  file_->release();
+  file_ = NULL;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,138 @@
+/* $Id$ */
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef ClpMappedModel_H
+#define ClpMappedModel_H
+
+#include "CoinPragma.hpp"
+#include "CoinTypes.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "ClpConfig.h"
+
+#include <cstddef>
+
+/** File saved by ClpSimplex::saveModel mapped into memory.
+
+    The mapping is private and writable so arrays in it can be changed
+    in place - the system copies just the pages which are touched and
+    the file is never changed.  Arrays which have to change size are
+    copied out first (see ClpModel::unmapModel).  On systems without
+    mmap the file is read into one block so the code is the same.
+
+    Mapping is reference counted as model and matrix both point into it.
+*/
+
+class CLPLIB_EXPORT ClpMappedFile {
+
+public:
+  /**@name Use */
+  //@{
+  /// Maps file - returns NULL if can not
+  static ClpMappedFile *open(const char *fileName);
+  /// Start of file
+  inline const char *data() const
+  {
+    return base_;
+  }
+  /// Start of file (writable - private to this process)
+  inline char *data()
+  {
+    return base_;
+  }
+  /// Size of file in bytes
+  inline size_t size() const
+  {
+    return size_;
+  }
+  /// True if pointer is inside mapping
+  inline bool contains(const void *pointer) const
+  {
+    const char *where = static_cast< const char * >(pointer);
+    return where >= base_ && where < base_ + size_;
+  }
+  /// True if really mapped (false if read into memory)
+  inline bool mapped() const
+  {
+    return mapped_;
+  }
+  /// Adds a reference
+  inline void addReference()
+  {
+    references_++;
+  }
+  /// Drops a reference - unmaps and deletes when last one goes
+  void release();
+  //@}
+
+private:
+  /**@name Constructors, destructor */
+  //@{
+  ClpMappedFile();
+  ~ClpMappedFile();
+  /// Not allowed
+  ClpMappedFile(const ClpMappedFile &);
+  ClpMappedFile &operator=(const ClpMappedFile &);
+  //@}
+
+  /**@name Data members */
+  //@{
+  /// Start of mapping
+  char *base_;
+  /// Size of mapping
+  size_t size_;
+  /// Number of references
+  int references_;
+  /// True if mapped (otherwise new[])
+  bool mapped_;
+  //@}
+};
+
+/** Column ordered CoinPackedMatrix whose arrays are in a mapped file.
+
+    Arrays still in the file are not deleted by destructor.  Anything
+    which would make CoinPackedMatrix allocate new arrays (adding rows
+    or columns) must call unmap first - ClpModel does this.
+*/
+
+class CLPLIB_EXPORT ClpMappedMatrix : public CoinPackedMatrix {
+
+public:
+  /**@name Use */
+  //@{
+  /// Copies any arrays still in file and drops reference
+  void unmap();
+  /// True if arrays are still in file
+  inline bool isMapped() const
+  {
+    return file_ != NULL;
+  }
+  //@}
+
+  /**@name Constructors, destructor */
+  //@{
+  /// Constructor - arrays must be in file and matrix must have no gaps
+  ClpMappedMatrix(ClpMappedFile *file, int numberRows, int numberColumns,
+    CoinBigIndex numberElements, double *element, int *index,
+    CoinBigIndex *start, int *length);
+  /// Destructor
+  virtual ~ClpMappedMatrix();
+  //@}
+
+private:
+  /// Not allowed
+  ClpMappedMatrix(const ClpMappedMatrix &);
+  ClpMappedMatrix &operator=(const ClpMappedMatrix &);
+
+  /**@name Data members */
+  //@{
+  /// Mapped file (NULL when unmapped)
+  ClpMappedFile *file_;
+  //@}
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
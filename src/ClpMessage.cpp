@@ -106,6 +106,10 @@ static Clp_message clp_us_english[] = {
   { CLP_CRUNCH_STATS, 61, 2, "Crunch %d (%d) rows, %d (%d) columns and %d (%d) elements" },
   { CLP_PARAMETRICS_STATS, 62, 1, "Theta %g - objective %g" },
   { CLP_PARAMETRICS_STATS2, 63, 2, "Theta %g - objective %g, %s in, %s out" },
+  { CLP_BARRIER_WARM, 66, 2, "Warm start - primal shift %g, dual shift %g" },
+  { CLP_CROSSOVER_PUSH, 67, 1, "%s push - %d variables pushed, %d basis changes in %d batches - %.2f seconds" },
+  { CLP_IMPORT_MEMORY, 68, 2, "Reader peak memory %.1f MB, matrix %.1f MB, process peak %.1f MB" },
+  { CLP_FACTORIZATION_DENSITY, 69, 3, "Ftran results %d, %d, %d, %d and btran %d, %d, %d, %d with up to 1, 10, 50 and over 50 percent of rows nonzero" },
 #ifndef NO_FATHOM_PRINT
   { CLP_FATHOM_STATUS, 63, 2, "Fathoming node %d - %d nodes (%d iterations) - current depth %d" },
   { CLP_FATHOM_SOLUTION, 64, 1, "Fathoming node %d - solution of %g after %d nodes at depth %d" },
@@ -104,6 +104,10 @@ enum CLP_Message {
   CLP_CRUNCH_STATS,
   CLP_PARAMETRICS_STATS,
   CLP_PARAMETRICS_STATS2,
+  CLP_BARRIER_WARM,
+  CLP_CROSSOVER_PUSH,
+  CLP_IMPORT_MEMORY,
+  CLP_FACTORIZATION_DENSITY,
 #ifndef NO_FATHOM_PRINT
   CLP_FATHOM_STATUS,
   CLP_FATHOM_SOLUTION,
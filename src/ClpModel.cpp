@@ -41,6 +41,7 @@
 #include "ClpModel.hpp"
 #include "ClpEventHandler.hpp"
 #include "ClpPackedMatrix.hpp"
+#include "ClpMappedModel.hpp"
 #ifndef SLIM_CLP
 #include "ClpPlusMinusOneMatrix.hpp"
 #endif
@@ -55,6 +56,7 @@
 #include "CoinMpsIO.hpp"
 #include "CoinFileIO.hpp"
 #include "CoinModel.hpp"
+#include "ClpMpsReader.hpp"
 #endif
 #include "ClpMessage.hpp"
 #include "CoinMessage.hpp"
@@ -122,6 +124,7 @@ ClpModel::ClpModel(bool emptyMessages)
   , maximumInternalRows_(-1)
   , savedRowScale_(NULL)
   , savedColumnScale_(NULL)
+  , mappedFile_(NULL)
 {
   intParam_[ClpMaxNumIteration] = 2147483647;
   intParam_[ClpMaxNumIterationHotStart] = 9999999;
@@ -165,6 +168,19 @@ void ClpModel::gutsOfDelete(int type)
   if (!type || !permanentArrays()) {
     maximumRows_ = -1;
     maximumColumns_ = -1;
+    if (mappedFile_) {
+      // arrays in file are not ours to delete (matrix looks after itself)
+      if (mappedFile_->contains(rowLower_))
+        rowLower_ = NULL;
+      if (mappedFile_->contains(rowUpper_))
+        rowUpper_ = NULL;
+      if (mappedFile_->contains(columnLower_))
+        columnLower_ = NULL;
+      if (mappedFile_->contains(columnUpper_))
+        columnUpper_ = NULL;
+      mappedFile_->release();
+      mappedFile_ = NULL;
+    }
     delete[] rowActivity_;
     rowActivity_ = NULL;
     delete[] columnActivity_;
@@ -678,6 +694,7 @@ ClpModel::ClpModel(const ClpModel &rhs, int scalingMode)
   , maximumInternalRows_(-1)
   , savedRowScale_(NULL)
   , savedColumnScale_(NULL)
+  , mappedFile_(NULL)
 {
   gutsOfCopy(rhs);
   if (scalingMode >= 0 && matrix_ && matrix_->allElementsInRange(this, smallElement_, 1.0e20)) {
@@ -1029,6 +1046,29 @@ void ClpModel::returnModel(ClpModel &otherModel)
   inverseRowScale_ = NULL;
   inverseColumnScale_ = NULL;
 }
+/* Copies bounds and matrix still in mapped file and drops mapping.
+   Pages which were changed have already been copied by system */
+void ClpModel::unmapModel()
+{
+  if (!mappedFile_)
+    return;
+  if (mappedFile_->contains(rowLower_))
+    rowLower_ = CoinCopyOfArray(rowLower_, numberRows_);
+  if (mappedFile_->contains(rowUpper_))
+    rowUpper_ = CoinCopyOfArray(rowUpper_, numberRows_);
+  if (mappedFile_->contains(columnLower_))
+    columnLower_ = CoinCopyOfArray(columnLower_, numberColumns_);
+  if (mappedFile_->contains(columnUpper_))
+    columnUpper_ = CoinCopyOfArray(columnUpper_, numberColumns_);
+  ClpPackedMatrix *clpMatrix = dynamic_cast< ClpPackedMatrix * >(matrix_);
+  if (clpMatrix) {
+    ClpMappedMatrix *mapped = dynamic_cast< ClpMappedMatrix * >(clpMatrix->getPackedMatrix());
+    if (mapped)
+      mapped->unmap();
+  }
+  mappedFile_->release();
+  mappedFile_ = NULL;
+}
 //#############################################################################
 // Parameter related methods
 //#############################################################################
@@ -1221,6 +1261,7 @@ ClpModel::cleanMatrix(double threshold)
 {
   ClpPackedMatrix *matrix = (dynamic_cast< ClpPackedMatrix * >(matrix_));
   if (matrix) {
+    unmapModel();
     return matrix->getPackedMatrix()->cleanMatrix(threshold);
   } else {
     return -1;
@@ -1231,6 +1272,7 @@ void ClpModel::resize(int newNumberRows, int newNumberColumns)
 {
   if (newNumberRows == numberRows_ && newNumberColumns == numberColumns_)
     return; // nothing to do
+  unmapModel();
   whatsChanged_ = 0;
   int numberRows2 = newNumberRows;
   int numberColumns2 = newNumberColumns;
@@ -1399,6 +1441,7 @@ void ClpModel::deleteRows(int number, const int *which)
 {
   if (!number)
     return; // nothing to do
+  unmapModel();
   whatsChanged_ &= ~(1 + 2 + 4 + 8 + 16 + 32); // all except columns changed
   int newSize = 0;
 #define CLP_TIDY_DELETE_ROWS
@@ -1526,6 +1569,7 @@ void ClpModel::deleteColumns(int number, const int *which)
 {
   if (!number)
     return; // nothing to do
+  unmapModel();
   assert(maximumColumns_ < 0);
   whatsChanged_ &= ~(1 + 2 + 4 + 8 + 64 + 128 + 256); // all except rows changed
   int newSize = 0;
@@ -1608,6 +1652,7 @@ void ClpModel::deleteRowsAndColumns(int numberRows, const int *whichRows,
   } else if (!numberRows) {
     deleteColumns(numberColumns, whichColumns);
   } else {
+    unmapModel();
     whatsChanged_ &= ~511; // all changed
     bool doStatus = status_ != NULL;
     int numberTotal = numberRows_ + numberColumns_;
@@ -2961,6 +3006,91 @@ int ClpModel::readMps(const char *fileName,
 
   return status;
 }
+// Read an mps file in one pass building packed matrix directly
+int ClpModel::readMpsStream(const char *fileName,
+  bool keepNames,
+  bool ignoreErrors)
+{
+  if (!strcmp(fileName, "-") || !strcmp(fileName, "stdin"))
+    return readMps(fileName, keepNames, ignoreErrors);
+  std::string name = fileName;
+  bool readable = fileCoinReadable(name);
+  if (!readable) {
+    handler_->message(CLP_UNABLE_OPEN, messages_)
+      << fileName << CoinMessageEol;
+    return -1;
+  }
+  double time1 = CoinCpuTime(), time2;
+  // errors are reported through our handler
+  ClpMpsReader reader(handler_, &messages_, CoinMax(smallElement_, 1.0e-14));
+  reader.setNumberThreads(numberThreads_);
+  reader.setKeepNames(keepNames);
+  int status = reader.read(name.c_str());
+  if (status == -2) {
+    // not plain LP (quadratic, SOS etc) - CoinMpsIO has to do it
+    return readMps(fileName, keepNames, ignoreErrors);
+  } else if (status == -1) {
+    handler_->message(CLP_UNABLE_OPEN, messages_)
+      << fileName << CoinMessageEol;
+    return -1;
+  } else if (status && !ignoreErrors) {
+    // errors
+    handler_->message(CLP_IMPORT_ERRORS, messages_)
+      << status << fileName << CoinMessageEol;
+    return status;
+  }
+  // bad entries were skipped so model is as from readMps ignoring errors
+  gutsOfLoadModel(reader.numberRows(), reader.numberColumns(),
+    reader.columnLower(), reader.columnUpper(),
+    reader.objective(),
+    reader.rowLower(), reader.rowUpper(), NULL);
+  // matrix owns arrays so no copy
+  matrix_ = new ClpPackedMatrix(reader.takeMatrix());
+  matrix_->setDimensions(numberRows_, numberColumns_);
+  if (reader.integerType()) {
+    integerType_ = CoinCopyOfArray(reader.integerType(), numberColumns_);
+  } else {
+    integerType_ = NULL;
+  }
+#ifndef CLP_NO_STD
+  // set problem name
+  setStrParam(ClpProbName, reader.problemName());
+  // do names
+  if (keepNames) {
+    unsigned int maxLength = 0;
+    rowNames_ = std::vector< std::string >();
+    columnNames_ = std::vector< std::string >();
+    rowNames_.reserve(numberRows_);
+    for (int iRow = 0; iRow < numberRows_; iRow++) {
+      const char *name = reader.rowName(iRow);
+      maxLength = CoinMax(maxLength, static_cast< unsigned int >(strlen(name)));
+      rowNames_.push_back(name);
+    }
+    columnNames_.reserve(numberColumns_);
+    for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+      const char *name = reader.columnName(iColumn);
+      maxLength = CoinMax(maxLength, static_cast< unsigned int >(strlen(name)));
+      columnNames_.push_back(name);
+    }
+    lengthNames_ = static_cast< int >(maxLength);
+  } else {
+    lengthNames_ = 0;
+  }
+#endif
+  setDblParam(ClpObjOffset, reader.objectiveOffset());
+  if (reader.optimizationDirection() < 0.0)
+    setOptimizationDirection(-1.0);
+  time2 = CoinCpuTime();
+  handler_->message(CLP_IMPORT_RESULT, messages_)
+    << fileName
+    << time2 - time1 << CoinMessageEol;
+  handler_->message(CLP_IMPORT_MEMORY, messages_)
+    << reader.peakMemory() * 1.0e-6
+    << reader.matrixMemory() * 1.0e-6
+    << ClpMpsReader::processPeakMemory() * 1.0e-6
+    << CoinMessageEol;
+  return status;
+}
 // Read GMPL files from the given filenames
 int ClpModel::readGMPL(const char *fileName, const char *dataName,
   bool keepNames)
@@ -3265,6 +3395,7 @@ ClpModel::ClpModel(const ClpModel *rhs,
   , maximumInternalRows_(-1)
   , savedRowScale_(NULL)
   , savedColumnScale_(NULL)
+  , mappedFile_(NULL)
 {
   defaultHandler_ = rhs->defaultHandler_;
   if (defaultHandler_)
@@ -24,6 +24,7 @@
 #include "ClpParameters.hpp"
 #include "ClpObjective.hpp"
 class ClpEventHandler;
+class ClpMappedFile;
 /** This is the base class for Linear and quadratic Models
     This knows nothing about the algorithm, but it seems to
     have a reasonable amount of information
@@ -125,6 +126,18 @@ public:
   int readMps(const char *filename,
     bool keepNames = false,
     bool ignoreErrors = false);
+  /** Read an mps file in one pass building packed matrix directly.
+         Uses less memory than readMps for large LPs and reports peak
+         memory at log level 2.  Falls back to readMps only if file has
+         sections which are not plain LP.  Errors are reported through
+         model's handler and bad entries skipped - with ignoreErrors
+         model is then loaded and number of errors returned as readMps.
+         COLUMNS section is parsed with numberThreads() threads (0 means
+         clpParallelThreads()) and model is same whatever the number of
+         threads */
+  int readMpsStream(const char *filename,
+    bool keepNames = false,
+    bool ignoreErrors = false);
   /// Read GMPL files from the given filenames
   int readGMPL(const char *filename, const char *dataName,
     bool keepNames = false);
@@ -232,6 +245,7 @@ public:
   inline void modifyCoefficient(int row, int column, double newElement,
     bool keepZero = false)
   {
+    unmapModel();
     matrix_->modifyCoefficient(row, column, newElement, keepZero);
   }
   /** Change row lower bounds */
@@ -251,6 +265,15 @@ public:
   /** Return model - nulls all arrays so can be deleted safely
          also updates any scalars */
   void returnModel(ClpModel &otherModel);
+  /** If model was restored from a mapped file (see ClpSimplex::restoreModel)
+         copies bounds and matrix still in file and drops mapping.
+         Done automatically before anything changes size of model */
+  void unmapModel();
+  /// True if some arrays are in a mapped file
+  inline bool isMapped() const
+  {
+    return mappedFile_ != NULL;
+  }
 
   /// Create empty ClpPackedMatrix
   void createEmptyMatrix();
@@ -1388,6 +1411,8 @@ protected:
   double *savedRowScale_;
   /// Saved column scale factors
   double *savedColumnScale_;
+  /// Mapped file bounds may be in (NULL if none)
+  ClpMappedFile *mappedFile_;
 #ifndef CLP_NO_STD
   /// Array of string parameters
   std::string strParam_[ClpLastStrParam];
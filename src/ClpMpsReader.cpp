@@ -0,0 +1,1104 @@
+/* $Id$ */
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CoinPragma.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+#include <sys/time.h>
+#include <sys/resource.h>
+#endif
+
+#include "CoinHelperFunctions.hpp"
+#include "CoinFileIO.hpp"
+#include "CoinError.hpp"
+#include "CoinMessageHandler.hpp"
+#include "CoinMessage.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "ClpMpsReader.hpp"
+#include "ClpMessage.hpp"
+#include "ClpHelperFunctions.hpp"
+
+// Longest line
+#define MPS_LINE 4096
+// Most fields on a line
+#define MPS_TOKENS 8
+// Elements per chunk
+#define MPS_CHUNK_SHIFT 20
+#define MPS_CHUNK (1 << MPS_CHUNK_SHIFT)
+// Errors which are printed
+#define MPS_MAX_ERRORS 20
+// Bytes of COLUMNS section per thread in a parallel block
+#define MPS_BLOCK (1 << 22)
+// Smallest piece of block worth a task
+#define MPS_MIN_TASK 65536
+
+enum {
+  MPS_NONE = 0,
+  MPS_NAME,
+  MPS_OBJSENSE,
+  MPS_ROWS,
+  MPS_COLUMNS,
+  MPS_RHS,
+  MPS_RANGES,
+  MPS_BOUNDS
+};
+
+//#############################################################################
+// Constructors / Destructor
+//#############################################################################
+
+ClpMpsReader::ClpMpsReader(CoinMessageHandler *handler, CoinMessages *messages,
+  double smallElement)
+  : handler_(handler)
+  , messages_(messages)
+  , smallElement_(smallElement)
+  , objectiveOffset_(0.0)
+  , optimizationDirection_(1.0)
+  , memory_(0.0)
+  , peakMemory_(0.0)
+  , numberRows_(0)
+  , maximumRows_(0)
+  , numberColumns_(0)
+  , maximumColumns_(0)
+  , numberElements_(0)
+  , numberIntegers_(0)
+  , numberErrors_(0)
+  , lineNumber_(0)
+  , rowType_(NULL)
+  , rowLower_(NULL)
+  , rowUpper_(NULL)
+  , columnLower_(NULL)
+  , columnUpper_(NULL)
+  , objective_(NULL)
+  , integerType_(NULL)
+  , columnStart_(NULL)
+  , elementChunk_(NULL)
+  , indexChunk_(NULL)
+  , numberChunks_(0)
+  , maximumChunks_(0)
+  , rowNames_(NULL)
+  , rowNameStart_(NULL)
+  , sizeRowNames_(0)
+  , maximumRowNames_(0)
+  , columnNames_(NULL)
+  , columnNameStart_(NULL)
+  , sizeColumnNames_(0)
+  , maximumColumnNames_(0)
+  , rowHash_(NULL)
+  , rowHashSize_(0)
+  , columnHash_(NULL)
+  , columnHashSize_(0)
+  , rowUsed_(NULL)
+  , lastObjective_(-1)
+  , buffer_(NULL)
+  , sizeBuffer_(0)
+  , numberThreads_(0)
+  , keepNames_(true)
+{
+}
+
+ClpMpsReader::~ClpMpsReader()
+{
+  gutsOfDelete();
+}
+// Frees everything
+void ClpMpsReader::gutsOfDelete()
+{
+  delete[] rowType_;
+  delete[] rowLower_;
+  delete[] rowUpper_;
+  delete[] columnLower_;
+  delete[] columnUpper_;
+  delete[] objective_;
+  delete[] integerType_;
+  delete[] columnStart_;
+  for (int i = 0; i < numberChunks_; i++) {
+    delete[] elementChunk_[i];
+    delete[] indexChunk_[i];
+  }
+  delete[] elementChunk_;
+  delete[] indexChunk_;
+  delete[] rowNames_;
+  delete[] rowNameStart_;
+  delete[] columnNames_;
+  delete[] columnNameStart_;
+  delete[] rowHash_;
+  delete[] columnHash_;
+  delete[] rowUsed_;
+  delete[] buffer_;
+  rowType_ = NULL;
+  rowLower_ = NULL;
+  rowUpper_ = NULL;
+  columnLower_ = NULL;
+  columnUpper_ = NULL;
+  objective_ = NULL;
+  integerType_ = NULL;
+  columnStart_ = NULL;
+  elementChunk_ = NULL;
+  indexChunk_ = NULL;
+  rowNames_ = NULL;
+  rowNameStart_ = NULL;
+  columnNames_ = NULL;
+  columnNameStart_ = NULL;
+  rowHash_ = NULL;
+  columnHash_ = NULL;
+  rowUsed_ = NULL;
+  lastObjective_ = -1;
+  buffer_ = NULL;
+  sizeBuffer_ = 0;
+  numberChunks_ = 0;
+  maximumChunks_ = 0;
+  numberRows_ = 0;
+  maximumRows_ = 0;
+  numberColumns_ = 0;
+  maximumColumns_ = 0;
+  numberElements_ = 0;
+  numberIntegers_ = 0;
+  numberErrors_ = 0;
+  lineNumber_ = 0;
+  sizeRowNames_ = 0;
+  maximumRowNames_ = 0;
+  sizeColumnNames_ = 0;
+  maximumColumnNames_ = 0;
+  rowHashSize_ = 0;
+  columnHashSize_ = 0;
+  memory_ = 0.0;
+  objectiveOffset_ = 0.0;
+  optimizationDirection_ = 1.0;
+  problemName_ = "";
+  objectiveName_ = "";
+  freeRowNames_.clear();
+}
+// Frees names and hash tables
+void ClpMpsReader::freeNames()
+{
+  addMemory(-static_cast< double >(maximumRowNames_ + maximumColumnNames_));
+  addMemory(-static_cast< double >(rowHashSize_ + columnHashSize_) * sizeof(int));
+  delete[] rowNames_;
+  delete[] columnNames_;
+  delete[] rowHash_;
+  delete[] columnHash_;
+  rowNames_ = NULL;
+  columnNames_ = NULL;
+  rowHash_ = NULL;
+  columnHash_ = NULL;
+  sizeRowNames_ = 0;
+  maximumRowNames_ = 0;
+  sizeColumnNames_ = 0;
+  maximumColumnNames_ = 0;
+  rowHashSize_ = 0;
+  columnHashSize_ = 0;
+}
+// Memory accounting
+void ClpMpsReader::addMemory(double bytes)
+{
+  memory_ += bytes;
+  peakMemory_ = CoinMax(peakMemory_, memory_);
+}
+// Bytes in final matrix
+double ClpMpsReader::matrixMemory() const
+{
+  return static_cast< double >(numberElements_) * (sizeof(double) + sizeof(int))
+    + static_cast< double >(numberColumns_ + 1) * sizeof(CoinBigIndex)
+    + static_cast< double >(numberColumns_) * sizeof(int);
+}
+// Peak memory of process (0.0 if not known)
+double ClpMpsReader::processPeakMemory()
+{
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+  struct rusage usage;
+  if (!getrusage(RUSAGE_SELF, &usage)) {
+#ifdef __APPLE__
+    return static_cast< double >(usage.ru_maxrss);
+#else
+    return 1024.0 * static_cast< double >(usage.ru_maxrss);
+#endif
+  }
+#endif
+  return 0.0;
+}
+// Resizes array keeping contents
+template < class T >
+static void mpsResize(T *&array, CoinBigIndex oldSize, CoinBigIndex newSize)
+{
+  T *temp = new T[newSize];
+  if (array)
+    CoinMemcpyN(array, oldSize, temp);
+  delete[] array;
+  array = temp;
+}
+// Makes sure row arrays can take one more
+void ClpMpsReader::growRows()
+{
+  if (numberRows_ == maximumRows_) {
+    int newMaximum = CoinMax(1024, maximumRows_ + maximumRows_ / 2);
+    mpsResize(rowType_, numberRows_, newMaximum);
+    mpsResize(rowLower_, numberRows_, newMaximum);
+    mpsResize(rowUpper_, numberRows_, newMaximum);
+    mpsResize(rowNameStart_, numberRows_, newMaximum);
+    addMemory(static_cast< double >(newMaximum - maximumRows_) * (sizeof(char) + 2 * sizeof(double) + sizeof(CoinBigIndex)));
+    maximumRows_ = newMaximum;
+  }
+}
+// Makes sure column arrays can take one more
+void ClpMpsReader::growColumns()
+{
+  if (numberColumns_ == maximumColumns_) {
+    int newMaximum = CoinMax(1024, maximumColumns_ + maximumColumns_ / 2);
+    mpsResize(columnLower_, numberColumns_, newMaximum);
+    mpsResize(columnUpper_, numberColumns_, newMaximum);
+    mpsResize(objective_, numberColumns_, newMaximum);
+    mpsResize(integerType_, numberColumns_, newMaximum);
+    mpsResize(columnStart_, numberColumns_ + 1, newMaximum + 1);
+    mpsResize(columnNameStart_, numberColumns_, newMaximum);
+    addMemory(static_cast< double >(newMaximum - maximumColumns_) * (3 * sizeof(double) + sizeof(char) + 2 * sizeof(CoinBigIndex)));
+    maximumColumns_ = newMaximum;
+  }
+}
+// Adds name to names storage - returns start
+CoinBigIndex ClpMpsReader::addName(char *&names, CoinBigIndex &size, CoinBigIndex &maximum,
+  const char *name)
+{
+  CoinBigIndex length = static_cast< CoinBigIndex >(strlen(name)) + 1;
+  if (size + length > maximum) {
+    CoinBigIndex newMaximum = CoinMax(size + length, CoinMax(static_cast< CoinBigIndex >(16384), maximum + maximum / 2));
+    mpsResize(names, size, newMaximum);
+    addMemory(static_cast< double >(newMaximum - maximum));
+    maximum = newMaximum;
+  }
+  CoinBigIndex start = size;
+  memcpy(names + start, name, length);
+  size += length;
+  return start;
+}
+// Adds element to chunks
+void ClpMpsReader::addElement(int iRow, double value)
+{
+  int iChunk = static_cast< int >(numberElements_ >> MPS_CHUNK_SHIFT);
+  int position = static_cast< int >(numberElements_ & (MPS_CHUNK - 1));
+  if (iChunk == numberChunks_) {
+    if (numberChunks_ == maximumChunks_) {
+      int newMaximum = CoinMax(64, 2 * maximumChunks_);
+      mpsResize(elementChunk_, numberChunks_, newMaximum);
+      mpsResize(indexChunk_, numberChunks_, newMaximum);
+      maximumChunks_ = newMaximum;
+    }
+    elementChunk_[numberChunks_] = new double[MPS_CHUNK];
+    indexChunk_[numberChunks_] = new int[MPS_CHUNK];
+    numberChunks_++;
+    addMemory(static_cast< double >(MPS_CHUNK) * (sizeof(double) + sizeof(int)));
+  }
+  elementChunk_[iChunk][position] = value;
+  indexChunk_[iChunk][position] = iRow;
+  numberElements_++;
+}
+// Hash of name
+static inline unsigned int mpsHash(const char *name)
+{
+  unsigned int hash = 2166136261u;
+  while (*name) {
+    hash ^= static_cast< unsigned char >(*name++);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+// Hash lookup - returns index or -1
+int ClpMpsReader::findName(const int *hash, int hashSize, const char *names,
+  const CoinBigIndex *nameStart, const char *name) const
+{
+  if (!hashSize)
+    return -1;
+  int mask = hashSize - 1;
+  int position = static_cast< int >(mpsHash(name) & mask);
+  while (hash[position] >= 0) {
+    int index = hash[position];
+    if (!strcmp(names + nameStart[index], name))
+      return index;
+    position = (position + 1) & mask;
+  }
+  return -1;
+}
+// Adds index to hash (rebuilding if needed)
+void ClpMpsReader::addHash(int *&hash, int &hashSize, const char *names,
+  const CoinBigIndex *nameStart, int number, const char *name)
+{
+  if (2 * (number + 1) > hashSize) {
+    int newSize = CoinMax(4096, 2 * hashSize);
+    delete[] hash;
+    hash = new int[newSize];
+    addMemory(static_cast< double >(newSize - hashSize) * sizeof(int));
+    hashSize = newSize;
+    for (int i = 0; i < hashSize; i++)
+      hash[i] = -1;
+    int mask = hashSize - 1;
+    for (int i = 0; i < number; i++) {
+      int position = static_cast< int >(mpsHash(names + nameStart[i]) & mask);
+      while (hash[position] >= 0)
+        position = (position + 1) & mask;
+      hash[position] = i;
+    }
+  }
+  int mask = hashSize - 1;
+  int position = static_cast< int >(mpsHash(name) & mask);
+  while (hash[position] >= 0)
+    position = (position + 1) & mask;
+  hash[position] = number;
+}
+// Row number for name (-1 objective, -2 free row, -3 unknown)
+int ClpMpsReader::rowNumber(const char *name) const
+{
+  int iRow = findName(rowHash_, rowHashSize_, rowNames_, rowNameStart_, name);
+  if (iRow >= 0)
+    return iRow;
+  if (objectiveName_ == name)
+    return -1;
+  for (size_t i = 0; i < freeRowNames_.size(); i++) {
+    if (freeRowNames_[i] == name)
+      return -2;
+  }
+  return -3;
+}
+// Converts value (and infinities)
+double ClpMpsReader::value(const char *token, bool &ok) const
+{
+  char *after;
+  double value = strtod(token, &after);
+  ok = (*after == '\0' && after != token);
+  if (value >= 1.0e30)
+    value = COIN_DBL_MAX;
+  else if (value <= -1.0e30)
+    value = -COIN_DBL_MAX;
+  return value;
+}
+// Reports an error (first few printed)
+void ClpMpsReader::error(const char *message, const char *name)
+{
+  numberErrors_++;
+  if (handler_ && numberErrors_ <= MPS_MAX_ERRORS) {
+    char line[200];
+    sprintf(line, "Line %d - %s %.80s", lineNumber_, message, name);
+    handler_->message(CLP_GENERAL_WARNING, *messages_)
+      << line << CoinMessageEol;
+  }
+}
+/* Checks for row (or objective if -1) already in current column
+   and reports it as CoinMpsIO does */
+bool ClpMpsReader::duplicate(int iRow, char **token, int n)
+{
+  int iColumn = numberColumns_ - 1;
+  bool isDuplicate;
+  if (iRow >= 0) {
+    isDuplicate = (rowUsed_[iRow] == iColumn);
+    rowUsed_[iRow] = iColumn;
+  } else {
+    isDuplicate = (lastObjective_ == iColumn);
+    lastObjective_ = iColumn;
+  }
+  if (isDuplicate) {
+    numberErrors_++;
+    if (handler_ && numberErrors_ <= MPS_MAX_ERRORS) {
+      // card image from fields
+      char card[200];
+      int length = 0;
+      for (int i = 0; i < n && length < 160; i++)
+        length += sprintf(card + length, i ? " %.40s" : "%.40s", token[i]);
+      CoinMessage coinMessages;
+      if (iRow >= 0)
+        handler_->message(COIN_MPS_DUPROW, coinMessages)
+          << rowName(iRow) << lineNumber_ << card << CoinMessageEol;
+      else
+        handler_->message(COIN_MPS_DUPOBJ, coinMessages)
+          << lineNumber_ << card << CoinMessageEol;
+    }
+  }
+  return isDuplicate;
+}
+// Splits line into fields
+static int mpsTokens(char *line, char **token)
+{
+  int n = 0;
+  char *put = line;
+  while (*put) {
+    while (*put == ' ' || *put == '\t' || *put == '\r' || *put == '\n')
+      *put++ = '\0';
+    if (!*put)
+      break;
+    if (n == MPS_TOKENS)
+      return -1;
+    token[n++] = put;
+    while (*put && *put != ' ' && *put != '\t' && *put != '\r' && *put != '\n')
+      put++;
+  }
+  return n;
+}
+// Pieces of a parallel block of COLUMNS section
+typedef struct clpMpsColumnsInfo {
+  const ClpMpsReader *reader;
+  char *start;
+  char *end;
+  // one entry per piece (run of lines with same column name)
+  char **name;
+  int *integer; // marker at start of piece (-1 as before block)
+  double *objective;
+  char *hasObjective;
+  CoinBigIndex *pieceStart;
+  // elements
+  int *row;
+  double *element;
+  int numberPieces;
+  int marker; // marker at end (-1 no marker in block)
+  int numberErrors;
+} clpMpsColumnsInfo;
+static void columnsBit(clpMpsColumnsInfo &info)
+{
+  info.reader->parseColumns(info);
+}
+// Tokenizes lines of a block of COLUMNS section
+void ClpMpsReader::parseColumns(clpMpsColumnsInfo &info) const
+{
+  int numberLines = 0;
+  for (char *put = info.start; put < info.end; put++) {
+    if (*put == '\n')
+      numberLines++;
+  }
+  info.name = new char *[numberLines];
+  info.integer = new int[numberLines];
+  info.objective = new double[numberLines];
+  info.hasObjective = new char[numberLines];
+  info.pieceStart = new CoinBigIndex[numberLines + 1];
+  info.row = new int[2 * numberLines];
+  info.element = new double[2 * numberLines];
+  info.numberPieces = 0;
+  info.marker = -1;
+  info.numberErrors = 0;
+  char *token[MPS_TOKENS];
+  const char *lastName = NULL;
+  int numberPieces = 0;
+  CoinBigIndex numberElements = 0;
+  char *next = info.start;
+  while (next < info.end) {
+    char *line = next;
+    next = static_cast< char * >(memchr(line, '\n', info.end - line));
+    *next = '\0';
+    next++;
+    if (line[0] == '*')
+      continue;
+    int n = mpsTokens(line, token);
+    if (!n)
+      continue;
+    if (n < 0) {
+      info.numberErrors++;
+      break;
+    }
+    if (n >= 3 && strstr(token[1], "MARKER")) {
+      if (strstr(token[2], "INTORG")) {
+        info.marker = 1;
+      } else if (strstr(token[2], "INTEND")) {
+        info.marker = 0;
+      } else {
+        info.numberErrors++;
+        break;
+      }
+      continue;
+    }
+    if (n != 3 && n != 5) {
+      info.numberErrors++;
+      break;
+    }
+    if (!lastName || strcmp(lastName, token[0])) {
+      info.name[numberPieces] = token[0];
+      info.integer[numberPieces] = info.marker;
+      info.objective[numberPieces] = 0.0;
+      info.hasObjective[numberPieces] = 0;
+      info.pieceStart[numberPieces] = numberElements;
+      numberPieces++;
+      lastName = token[0];
+    }
+    for (int i = 1; i < n; i += 2) {
+      bool ok;
+      double element = value(token[i + 1], ok);
+      int iRow = rowNumber(token[i]);
+      if (!ok || iRow == -3) {
+        info.numberErrors++;
+        break;
+      } else if (iRow >= 0) {
+        // small elements dropped in merge after duplicate check
+        info.row[numberElements] = iRow;
+        info.element[numberElements++] = element;
+      } else if (iRow == -1) {
+        if (info.hasObjective[numberPieces - 1]) {
+          // duplicate - serial read will report
+          info.numberErrors++;
+          break;
+        }
+        info.objective[numberPieces - 1] = element;
+        info.hasObjective[numberPieces - 1] = 1;
+      }
+    }
+    if (info.numberErrors)
+      break;
+  }
+  info.pieceStart[numberPieces] = numberElements;
+  info.numberPieces = numberPieces;
+}
+/* Reads block of COLUMNS section and merges it.  Returns 0 if next
+   line (not simple data) is in line, 1 at end of file, 2 if block was
+   full and -1 if there were errors */
+int ClpMpsReader::readColumns(CoinFileInput *input, char *line, int numberThreads,
+  bool &integerMarker)
+{
+  if (!buffer_) {
+    sizeBuffer_ = static_cast< CoinBigIndex >(numberThreads) * MPS_BLOCK;
+    buffer_ = new char[sizeBuffer_];
+    addMemory(static_cast< double >(sizeBuffer_));
+  }
+  // lines which start with blank (or comments) go in block
+  CoinBigIndex used = 0;
+  int numberLines = 0;
+  int returnCode = 2;
+  while (used + MPS_LINE + 1 < sizeBuffer_) {
+    char *put = buffer_ + used;
+    if (!input->gets(put, MPS_LINE)) {
+      returnCode = 1;
+      break;
+    }
+    size_t length = strlen(put);
+    if ((put[0] != ' ' && put[0] != '\t' && put[0] != '*' && put[0] != '\n' && put[0] != '\r')
+      || !length || (length == MPS_LINE - 1 && put[length - 1] != '\n')) {
+      // leave for caller
+      memcpy(line, put, length + 1);
+      returnCode = 0;
+      break;
+    }
+    if (put[length - 1] != '\n')
+      put[length++] = '\n';
+    used += static_cast< CoinBigIndex >(length);
+    numberLines++;
+  }
+  if (!used)
+    return returnCode;
+  // split at line boundaries - pieces merged in order so
+  // result does not depend on number of tasks
+  int numberTasks = static_cast< int >(CoinMin(static_cast< CoinBigIndex >(numberThreads),
+    used / MPS_MIN_TASK));
+  numberTasks = CoinMax(1, numberTasks);
+  clpMpsColumnsInfo *info = new clpMpsColumnsInfo[numberTasks];
+  CoinBigIndex first = 0;
+  for (int i = 0; i < numberTasks; i++) {
+    CoinBigIndex last = static_cast< CoinBigIndex >((static_cast< double >(used) * (i + 1)) / numberTasks);
+    if (i == numberTasks - 1)
+      last = used;
+    last = CoinMax(last, first);
+    while (last < used && buffer_[last - 1] != '\n')
+      last++;
+    info[i].reader = this;
+    info[i].start = buffer_ + first;
+    info[i].end = buffer_ + last;
+    first = last;
+  }
+  clpParallelFor(columnsBit, info, numberTasks);
+  double taskMemory = static_cast< double >(numberLines) * (sizeof(char *) + sizeof(int) + sizeof(double) + sizeof(char) + sizeof(CoinBigIndex) + 2 * (sizeof(int) + sizeof(double)));
+  addMemory(taskMemory);
+  for (int i = 0; i < numberTasks; i++) {
+    if (info[i].numberErrors)
+      returnCode = -1;
+  }
+  // merge
+  for (int i = 0; i < numberTasks && returnCode >= 0; i++) {
+    clpMpsColumnsInfo &thisInfo = info[i];
+    for (int k = 0; k < thisInfo.numberPieces && returnCode >= 0; k++) {
+      const char *name = thisInfo.name[k];
+      int iColumn = numberColumns_ - 1;
+      if (!numberColumns_ || strcmp(columnName(iColumn), name)) {
+        // new column
+        if (findName(columnHash_, columnHashSize_, columnNames_, columnNameStart_, name) >= 0) {
+          returnCode = -1;
+          break;
+        }
+        growColumns();
+        iColumn = numberColumns_;
+        bool isInteger = thisInfo.integer[k] >= 0 ? (thisInfo.integer[k] != 0) : integerMarker;
+        columnStart_[iColumn] = numberElements_;
+        columnLower_[iColumn] = 0.0;
+        columnUpper_[iColumn] = COIN_DBL_MAX;
+        objective_[iColumn] = 0.0;
+        integerType_[iColumn] = isInteger ? 1 : 0;
+        if (isInteger)
+          numberIntegers_++;
+        columnNameStart_[iColumn] = addName(columnNames_, sizeColumnNames_, maximumColumnNames_, name);
+        addHash(columnHash_, columnHashSize_, columnNames_, columnNameStart_, iColumn, name);
+        numberColumns_++;
+      }
+      if (thisInfo.hasObjective[k]) {
+        if (lastObjective_ == iColumn) {
+          // duplicate - serial read will report
+          returnCode = -1;
+          break;
+        }
+        lastObjective_ = iColumn;
+        objective_[iColumn] = thisInfo.objective[k];
+      }
+      for (CoinBigIndex j = thisInfo.pieceStart[k]; j < thisInfo.pieceStart[k + 1]; j++) {
+        int iRow = thisInfo.row[j];
+        if (rowUsed_[iRow] == iColumn) {
+          returnCode = -1;
+          break;
+        }
+        rowUsed_[iRow] = iColumn;
+        if (fabs(thisInfo.element[j]) >= smallElement_)
+          addElement(iRow, thisInfo.element[j]);
+      }
+    }
+    if (thisInfo.marker >= 0)
+      integerMarker = (thisInfo.marker != 0);
+  }
+  for (int i = 0; i < numberTasks; i++) {
+    delete[] info[i].name;
+    delete[] info[i].integer;
+    delete[] info[i].objective;
+    delete[] info[i].hasObjective;
+    delete[] info[i].pieceStart;
+    delete[] info[i].row;
+    delete[] info[i].element;
+  }
+  delete[] info;
+  addMemory(-taskMemory);
+  lineNumber_ += numberLines;
+  return returnCode;
+}
+// Reads file
+int ClpMpsReader::read(const char *fileName)
+{
+  peakMemory_ = 0.0;
+  int numberThreads = numberThreads_ ? numberThreads_ : clpParallelThreads();
+  int returnCode = readFile(fileName, numberThreads);
+  if (returnCode == -3) {
+    // errors in parallel part - redo so messages same as serial
+    returnCode = readFile(fileName, 1);
+  }
+  return returnCode;
+}
+// Reads file using given number of threads (-3 redo with one thread)
+int ClpMpsReader::readFile(const char *fileName, int numberThreads)
+{
+  gutsOfDelete();
+  CoinFileInput *input = NULL;
+  try {
+    input = CoinFileInput::create(fileName);
+  } catch (CoinError e) {
+    e.print();
+    return -1;
+  }
+  char line[MPS_LINE];
+  char *token[MPS_TOKENS];
+  int section = MPS_NONE;
+  bool integerMarker = false;
+  bool finished = false;
+  bool needCoinMpsIO = false;
+  std::string rhsName;
+  std::string rangeName;
+  std::string boundName;
+  while (!finished) {
+    if (section == MPS_COLUMNS && numberThreads > 1 && !numberErrors_) {
+      int returnCode = readColumns(input, line, numberThreads, integerMarker);
+      if (returnCode < 0) {
+        delete input;
+        return -3;
+      } else if (returnCode == 1) {
+        break;
+      } else if (returnCode == 2) {
+        continue;
+      }
+    } else if (!input->gets(line, MPS_LINE)) {
+      break;
+    }
+    lineNumber_++;
+    size_t length = strlen(line);
+    if (length == MPS_LINE - 1 && line[length - 1] != '\n') {
+      // too long for us
+      needCoinMpsIO = true;
+      break;
+    }
+    if (line[0] == '*')
+      continue;
+    bool dataLine = (line[0] == ' ' || line[0] == '\t');
+    int n = mpsTokens(line, token);
+    if (n < 0) {
+      error("Too many fields", "");
+      continue;
+    } else if (!n) {
+      continue;
+    }
+    if (!dataLine) {
+      // section (or data line in free format starting in column 1)
+      if (!strcmp(token[0], "NAME")) {
+        section = MPS_NAME;
+        problemName_ = n > 1 ? token[1] : "";
+      } else if (!strcmp(token[0], "OBJSENSE") || !strcmp(token[0], "OBJSENCE")) {
+        section = MPS_OBJSENSE;
+        if (n > 1 && !strncmp(token[1], "MAX", 3))
+          optimizationDirection_ = -1.0;
+      } else if (!strcmp(token[0], "ROWS")) {
+        section = MPS_ROWS;
+      } else if (!strcmp(token[0], "COLUMNS")) {
+        section = MPS_COLUMNS;
+        if (!rowUsed_) {
+          // for duplicate check
+          rowUsed_ = new int[CoinMax(1, numberRows_)];
+          addMemory(static_cast< double >(numberRows_) * sizeof(int));
+          for (int iRow = 0; iRow < numberRows_; iRow++)
+            rowUsed_[iRow] = -1;
+        }
+      } else if (!strcmp(token[0], "RHS") && n == 1) {
+        section = MPS_RHS;
+      } else if (!strcmp(token[0], "RANGES") && n == 1) {
+        section = MPS_RANGES;
+      } else if (!strcmp(token[0], "BOUNDS") && n == 1) {
+        section = MPS_BOUNDS;
+      } else if (!strcmp(token[0], "ENDATA")) {
+        finished = true;
+      } else if (!strcmp(token[0], "QUADOBJ") || !strcmp(token[0], "QSECTION")
+        || !strcmp(token[0], "QMATRIX") || !strcmp(token[0], "QCMATRIX")
+        || !strcmp(token[0], "CSECTION") || !strcmp(token[0], "SOS")
+        || !strcmp(token[0], "SETS") || !strcmp(token[0], "INDICATORS")) {
+        needCoinMpsIO = true;
+        break;
+      } else if (section >= MPS_ROWS) {
+        dataLine = true;
+      } else {
+        error("Unknown section", token[0]);
+      }
+      if (!dataLine)
+        continue;
+    }
+    switch (section) {
+    case MPS_OBJSENSE:
+      if (!strncmp(token[0], "MAX", 3))
+        optimizationDirection_ = -1.0;
+      else if (!strncmp(token[0], "MIN", 3))
+        optimizationDirection_ = 1.0;
+      break;
+    case MPS_ROWS: {
+      if (n != 2 || token[0][1]) {
+        error("Bad row", n > 1 ? token[1] : token[0]);
+        break;
+      }
+      char type = token[0][0];
+      if (type == 'n')
+        type = 'N';
+      else if (type == 'e')
+        type = 'E';
+      else if (type == 'l')
+        type = 'L';
+      else if (type == 'g')
+        type = 'G';
+      if (type == 'N') {
+        if (objectiveName_.empty())
+          objectiveName_ = token[1];
+        else
+          freeRowNames_.push_back(token[1]);
+      } else if (type == 'E' || type == 'L' || type == 'G') {
+        if (rowUsed_) {
+          error("Row after COLUMNS", token[1]);
+          break;
+        }
+        if (rowNumber(token[1]) != -3) {
+          error("Duplicate row", token[1]);
+          break;
+        }
+        growRows();
+        rowType_[numberRows_] = type;
+        rowLower_[numberRows_] = 0.0; // rhs
+        rowUpper_[numberRows_] = 0.0; // range
+        rowNameStart_[numberRows_] = addName(rowNames_, sizeRowNames_, maximumRowNames_, token[1]);
+        addHash(rowHash_, rowHashSize_, rowNames_, rowNameStart_, numberRows_, token[1]);
+        numberRows_++;
+      } else {
+        error("Unknown row type", token[0]);
+      }
+    } break;
+    case MPS_COLUMNS: {
+      if (n >= 3 && strstr(token[1], "MARKER")) {
+        if (strstr(token[2], "INTORG"))
+          integerMarker = true;
+        else if (strstr(token[2], "INTEND"))
+          integerMarker = false;
+        else
+          error("Unknown marker", token[2]);
+        break;
+      }
+      if (n != 3 && n != 5) {
+        error("Bad column entry", token[0]);
+        break;
+      }
+      if (!numberColumns_ || strcmp(columnName(numberColumns_ - 1), token[0])) {
+        // new column
+        if (findName(columnHash_, columnHashSize_, columnNames_, columnNameStart_, token[0]) >= 0) {
+          error("Column entries not together", token[0]);
+          break;
+        }
+        growColumns();
+        columnStart_[numberColumns_] = numberElements_;
+        columnLower_[numberColumns_] = 0.0;
+        columnUpper_[numberColumns_] = COIN_DBL_MAX;
+        objective_[numberColumns_] = 0.0;
+        integerType_[numberColumns_] = integerMarker ? 1 : 0;
+        if (integerMarker)
+          numberIntegers_++;
+        columnNameStart_[numberColumns_] = addName(columnNames_, sizeColumnNames_, maximumColumnNames_, token[0]);
+        addHash(columnHash_, columnHashSize_, columnNames_, columnNameStart_, numberColumns_, token[0]);
+        numberColumns_++;
+      }
+      for (int i = 1; i < n; i += 2) {
+        bool ok;
+        double element = value(token[i + 1], ok);
+        int iRow = rowNumber(token[i]);
+        if (!ok) {
+          error("Bad value", token[i + 1]);
+        } else if (iRow >= 0) {
+          if (!duplicate(iRow, token, n) && fabs(element) >= smallElement_)
+            addElement(iRow, element);
+        } else if (iRow == -1) {
+          if (!duplicate(-1, token, n))
+            objective_[numberColumns_ - 1] = element;
+        } else if (iRow == -3) {
+          error("Unknown row", token[i]);
+        }
+      }
+    } break;
+    case MPS_RHS:
+    case MPS_RANGES: {
+      int first = (n & 1) ? 1 : 0;
+      if (n < 2 || n > 5) {
+        error("Bad entry", token[0]);
+        break;
+      }
+      if (first) {
+        std::string &setName = (section == MPS_RHS) ? rhsName : rangeName;
+        if (setName.empty())
+          setName = token[0];
+        else if (setName != token[0])
+          break; // only first set
+      }
+      for (int i = first; i < n; i += 2) {
+        bool ok;
+        double number = value(token[i + 1], ok);
+        int iRow = rowNumber(token[i]);
+        if (!ok) {
+          error("Bad value", token[i + 1]);
+        } else if (iRow >= 0) {
+          if (section == MPS_RHS) {
+            rowLower_[iRow] = number;
+          } else {
+            rowUpper_[iRow] = number;
+            // lower case means ranged
+            rowType_[iRow] = static_cast< char >(rowType_[iRow] | 0x20);
+          }
+        } else if (iRow == -1) {
+          if (section == MPS_RHS)
+            objectiveOffset_ = number;
+        } else if (iRow == -3) {
+          error("Unknown row", token[i]);
+        }
+      }
+    } break;
+    case MPS_BOUNDS: {
+      const char *type = token[0];
+      bool hasValue = !strcmp(type, "UP") || !strcmp(type, "LO") || !strcmp(type, "FX")
+        || !strcmp(type, "LI") || !strcmp(type, "UI");
+      bool noValue = !strcmp(type, "FR") || !strcmp(type, "MI") || !strcmp(type, "PL")
+        || !strcmp(type, "BV");
+      if (!strcmp(type, "SC")) {
+        needCoinMpsIO = true;
+        break;
+      }
+      if (!hasValue && !noValue) {
+        error("Unknown bound type", type);
+        break;
+      }
+      const char *set = NULL;
+      const char *name = NULL;
+      const char *valueToken = NULL;
+      if (hasValue) {
+        if (n == 4) {
+          set = token[1];
+          name = token[2];
+          valueToken = token[3];
+        } else if (n == 3) {
+          name = token[1];
+          valueToken = token[2];
+        }
+      } else {
+        if (n == 4) {
+          set = token[1];
+          name = token[2];
+        } else if (n == 3) {
+          if (findName(columnHash_, columnHashSize_, columnNames_, columnNameStart_, token[2]) >= 0) {
+            set = token[1];
+            name = token[2];
+          } else {
+            name = token[1];
+          }
+        } else if (n == 2) {
+          name = token[1];
+        }
+      }
+      if (!name) {
+        error("Bad bound", token[0]);
+        break;
+      }
+      if (set) {
+        if (boundName.empty())
+          boundName = set;
+        else if (boundName != set)
+          break; // only first set
+      }
+      int iColumn = findName(columnHash_, columnHashSize_, columnNames_, columnNameStart_, name);
+      if (iColumn < 0) {
+        error("Unknown column", name);
+        break;
+      }
+      double number = 0.0;
+      if (valueToken) {
+        bool ok;
+        number = value(valueToken, ok);
+        if (!ok) {
+          error("Bad value", valueToken);
+          break;
+        }
+      }
+      if (!strcmp(type, "UP") || !strcmp(type, "UI")) {
+        columnUpper_[iColumn] = number;
+        if (number < 0.0 && columnLower_[iColumn] == 0.0)
+          columnLower_[iColumn] = -COIN_DBL_MAX;
+      } else if (!strcmp(type, "LO") || !strcmp(type, "LI")) {
+        columnLower_[iColumn] = number;
+      } else if (!strcmp(type, "FX")) {
+        columnLower_[iColumn] = number;
+        columnUpper_[iColumn] = number;
+      } else if (!strcmp(type, "FR")) {
+        columnLower_[iColumn] = -COIN_DBL_MAX;
+        columnUpper_[iColumn] = COIN_DBL_MAX;
+      } else if (!strcmp(type, "MI")) {
+        columnLower_[iColumn] = -COIN_DBL_MAX;
+      } else if (!strcmp(type, "PL")) {
+        columnUpper_[iColumn] = COIN_DBL_MAX;
+      } else if (!strcmp(type, "BV")) {
+        columnLower_[iColumn] = 0.0;
+        columnUpper_[iColumn] = 1.0;
+      }
+      if (type[1] == 'I' || type[0] == 'B') {
+        if (!integerType_[iColumn])
+          numberIntegers_++;
+        integerType_[iColumn] = 1;
+      }
+    } break;
+    default:
+      error("Data outside section", token[0]);
+      break;
+    }
+    if (needCoinMpsIO)
+      break;
+  }
+  delete input;
+  if (needCoinMpsIO)
+    return -2;
+  if (!finished)
+    error("No ENDATA", "");
+  if (rowUsed_) {
+    addMemory(-static_cast< double >(numberRows_) * sizeof(int));
+    delete[] rowUsed_;
+    rowUsed_ = NULL;
+  }
+  if (!keepNames_)
+    freeNames();
+  if (!maximumColumns_)
+    growColumns();
+  columnStart_[numberColumns_] = numberElements_;
+  // rhs and ranges to bounds
+  for (int iRow = 0; iRow < numberRows_; iRow++) {
+    double rhs = rowLower_[iRow];
+    double range = rowUpper_[iRow];
+    switch (rowType_[iRow]) {
+    case 'E':
+      rowLower_[iRow] = rhs;
+      rowUpper_[iRow] = rhs;
+      break;
+    case 'L':
+      rowLower_[iRow] = -COIN_DBL_MAX;
+      rowUpper_[iRow] = rhs;
+      break;
+    case 'G':
+      rowLower_[iRow] = rhs;
+      rowUpper_[iRow] = COIN_DBL_MAX;
+      break;
+    case 'e':
+      if (range >= 0.0) {
+        rowLower_[iRow] = rhs;
+        rowUpper_[iRow] = rhs + range;
+      } else {
+        rowLower_[iRow] = rhs + range;
+        rowUpper_[iRow] = rhs;
+      }
+      break;
+    case 'l':
+      rowLower_[iRow] = rhs - fabs(range);
+      rowUpper_[iRow] = rhs;
+      break;
+    case 'g':
+      rowLower_[iRow] = rhs;
+      rowUpper_[iRow] = rhs + fabs(range);
+      break;
+    }
+  }
+  return numberErrors_;
+}
+// Takes matrix
+CoinPackedMatrix *ClpMpsReader::takeMatrix()
+{
+  // elements then indices so only one set of chunks and one array at once
+  double *element = new double[numberElements_];
+  addMemory(static_cast< double >(numberElements_) * sizeof(double));
+  for (int iChunk = 0; iChunk < numberChunks_; iChunk++) {
+    CoinBigIndex first = static_cast< CoinBigIndex >(iChunk) << MPS_CHUNK_SHIFT;
+    CoinBigIndex number = CoinMin(static_cast< CoinBigIndex >(MPS_CHUNK), numberElements_ - first);
+    CoinMemcpyN(elementChunk_[iChunk], number, element + first);
+    delete[] elementChunk_[iChunk];
+    elementChunk_[iChunk] = NULL;
+    addMemory(-static_cast< double >(MPS_CHUNK) * sizeof(double));
+  }
+  int *index = new int[numberElements_];
+  addMemory(static_cast< double >(numberElements_) * sizeof(int));
+  for (int iChunk = 0; iChunk < numberChunks_; iChunk++) {
+    CoinBigIndex first = static_cast< CoinBigIndex >(iChunk) << MPS_CHUNK_SHIFT;
+    CoinBigIndex number = CoinMin(static_cast< CoinBigIndex >(MPS_CHUNK), numberElements_ - first);
+    CoinMemcpyN(indexChunk_[iChunk], number, index + first);
+    delete[] indexChunk_[iChunk];
+    indexChunk_[iChunk] = NULL;
+    addMemory(-static_cast< double >(MPS_CHUNK) * sizeof(int));
+  }
+  numberChunks_ = 0;
+  if (!columnStart_) {
+    columnStart_ = new CoinBigIndex[1];
+    columnStart_[0] = 0;
+  }
+  int *length = new int[CoinMax(1, numberColumns_)];
+  addMemory(static_cast< double >(numberColumns_) * sizeof(int));
+  for (int iColumn = 0; iColumn < numberColumns_; iColumn++)
+    length[iColumn] = static_cast< int >(columnStart_[iColumn + 1] - columnStart_[iColumn]);
+  CoinPackedMatrix *matrix = new CoinPackedMatrix();
+  matrix->assignMatrix(true, numberRows_, numberColumns_, numberElements_,
+    element, index, columnStart_, length);
+  // matrix owns arrays now
+  columnStart_ = NULL;
+  return matrix;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,292 @@
+/* $Id$ */
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef ClpMpsReader_H
+#define ClpMpsReader_H
+
+#include "CoinPragma.hpp"
+#include "CoinTypes.hpp"
+#include "ClpConfig.h"
+
+#include <string>
+#include <vector>
+
+class CoinFileInput;
+class CoinMessageHandler;
+class CoinMessages;
+class CoinPackedMatrix;
+struct clpMpsColumnsInfo;
+
+/** Single pass MPS reader for large LPs.
+
+    Elements go into chunks as the COLUMNS section is read, so there
+    are no intermediate triplet or CoinModel copies.  takeMatrix copies
+    the chunks into the arrays of a CoinPackedMatrix - elements first
+    and then indices, freeing each chunk as it is copied.  So peak is
+    while elements are copied: all chunks plus the element array, about
+    1.67 times the final matrix (8 byte doubles, 4 byte indices).
+    Input can be compressed if CoinUtils was built with zlib or bzlib.
+
+    A row which appears twice in one column (or a second objective entry)
+    is an error and is reported with the CoinMpsIO message.
+
+    Names must not contain blanks (free format or fixed format with
+    ordinary names).  Only first RHS, RANGES and BOUNDS sets are used.
+    Sections which are not plain LP (quadratic, SOS, cones, semicontinuous
+    bounds) make read return -2 so caller can use CoinMpsIO instead.
+
+    With more than one thread the COLUMNS section is read in large
+    blocks which are split at line boundaries and tokenized (with row
+    lookup) in parallel.  Pieces are merged in order so the model is
+    exactly the same as with one thread.  If any task finds an error
+    the file is read again with one thread so messages are the same.
+*/
+
+class CLPLIB_EXPORT ClpMpsReader {
+
+public:
+  /**@name Reading */
+  //@{
+  /** Reads file.  Returns 0 if okay, number of errors if > 0,
+         -1 if file can not be opened and -2 if file needs CoinMpsIO */
+  int read(const char *fileName);
+  /** Takes matrix (column ordered).  Reader no longer owns it.
+         Element and index chunks are freed as they are copied */
+  CoinPackedMatrix *takeMatrix();
+  //@}
+
+  /**@name Results */
+  //@{
+  inline int numberRows() const
+  {
+    return numberRows_;
+  }
+  inline int numberColumns() const
+  {
+    return numberColumns_;
+  }
+  inline CoinBigIndex numberElements() const
+  {
+    return numberElements_;
+  }
+  inline const double *rowLower() const
+  {
+    return rowLower_;
+  }
+  inline const double *rowUpper() const
+  {
+    return rowUpper_;
+  }
+  inline const double *columnLower() const
+  {
+    return columnLower_;
+  }
+  inline const double *columnUpper() const
+  {
+    return columnUpper_;
+  }
+  inline const double *objective() const
+  {
+    return objective_;
+  }
+  /// Integer information (NULL if no integers)
+  inline const char *integerType() const
+  {
+    return numberIntegers_ ? integerType_ : NULL;
+  }
+  /// Objective offset
+  inline double objectiveOffset() const
+  {
+    return objectiveOffset_;
+  }
+  /// Optimization direction (1 minimize, -1 maximize)
+  inline double optimizationDirection() const
+  {
+    return optimizationDirection_;
+  }
+  inline const std::string &problemName() const
+  {
+    return problemName_;
+  }
+  /// Row name (only if names kept)
+  inline const char *rowName(int iRow) const
+  {
+    return rowNames_ + rowNameStart_[iRow];
+  }
+  /// Column name (only if names kept)
+  inline const char *columnName(int iColumn) const
+  {
+    return columnNames_ + columnNameStart_[iColumn];
+  }
+  /// Peak memory used by reader in bytes
+  inline double peakMemory() const
+  {
+    return peakMemory_;
+  }
+  /// Bytes in final matrix
+  double matrixMemory() const;
+  /// Peak memory of process in bytes (0.0 if not known)
+  static double processPeakMemory();
+  //@}
+
+  /**@name Gets and sets */
+  //@{
+  /// Number of threads (0 means use clpParallelThreads())
+  inline int numberThreads() const
+  {
+    return numberThreads_;
+  }
+  /// Set number of threads (0 means use clpParallelThreads())
+  inline void setNumberThreads(int value)
+  {
+    numberThreads_ = value;
+  }
+  /// Whether names are kept after read
+  inline bool keepNames() const
+  {
+    return keepNames_;
+  }
+  /** Set whether names are kept after read (default true).  Names are
+      needed while reading for lookup but if not kept name storage and
+      hash tables are freed before matrix is built */
+  inline void setKeepNames(bool value)
+  {
+    keepNames_ = value;
+  }
+  //@}
+
+  /**@name For parallel tasks */
+  //@{
+  /// Tokenizes lines of a block of COLUMNS section
+  void parseColumns(clpMpsColumnsInfo &info) const;
+  //@}
+
+  /**@name Constructors, destructor */
+  //@{
+  /** Constructor - handler and messages used for errors (if handler
+      NULL errors are just counted) */
+  ClpMpsReader(CoinMessageHandler *handler, CoinMessages *messages,
+    double smallElement = 1.0e-14);
+  /** Destructor  */
+  ~ClpMpsReader();
+  //@}
+
+private:
+  /// Not allowed
+  ClpMpsReader(const ClpMpsReader &);
+  ClpMpsReader &operator=(const ClpMpsReader &);
+  /// Frees everything
+  void gutsOfDelete();
+  /// Reads file using given number of threads (-3 redo with one thread)
+  int readFile(const char *fileName, int numberThreads);
+  /** Reads block of COLUMNS section and merges it.  Returns 0 if next
+      line (not simple data) is in line, 1 at end of file, 2 if block was
+      full and -1 if there were errors */
+  int readColumns(CoinFileInput *input, char *line, int numberThreads,
+    bool &integerMarker);
+  /// Reports an error (first few printed)
+  void error(const char *message, const char *name);
+  /** Checks for row (or objective if -1) already in current column
+      and reports it as CoinMpsIO does.  Returns true if duplicate */
+  bool duplicate(int iRow, char **token, int n);
+  /// Frees names and hash tables
+  void freeNames();
+  /// Memory accounting
+  void addMemory(double bytes);
+  /// Makes sure row arrays can take one more
+  void growRows();
+  /// Makes sure column arrays can take one more
+  void growColumns();
+  /// Adds name to names storage - returns start
+  CoinBigIndex addName(char *&names, CoinBigIndex &size, CoinBigIndex &maximum,
+    const char *name);
+  /// Adds element to chunks
+  void addElement(int iRow, double value);
+  /// Hash lookup - returns index or -1
+  int findName(const int *hash, int hashSize, const char *names,
+    const CoinBigIndex *nameStart, const char *name) const;
+  /// Adds index to hash (rebuilding if needed)
+  void addHash(int *&hash, int &hashSize, const char *names,
+    const CoinBigIndex *nameStart, int number, const char *name);
+  /// Row number for name (-1 objective, -2 free row, -3 unknown)
+  int rowNumber(const char *name) const;
+  /// Converts value (and infinities)
+  double value(const char *token, bool &ok) const;
+
+  /**@name Data members */
+  //@{
+  /// Message handler
+  CoinMessageHandler *handler_;
+  /// Messages
+  CoinMessages *messages_;
+  /// Problem name
+  std::string problemName_;
+  /// Objective row name
+  std::string objectiveName_;
+  /// Other free rows (ignored)
+  std::vector< std::string > freeRowNames_;
+  /// Small element value
+  double smallElement_;
+  /// Objective offset
+  double objectiveOffset_;
+  /// Optimization direction
+  double optimizationDirection_;
+  /// Memory now and peak
+  double memory_;
+  double peakMemory_;
+  int numberRows_;
+  int maximumRows_;
+  int numberColumns_;
+  int maximumColumns_;
+  CoinBigIndex numberElements_;
+  int numberIntegers_;
+  int numberErrors_;
+  int lineNumber_;
+  /// Row type (E, L, G) and whether range given
+  char *rowType_;
+  double *rowLower_;
+  double *rowUpper_;
+  double *columnLower_;
+  double *columnUpper_;
+  double *objective_;
+  char *integerType_;
+  CoinBigIndex *columnStart_;
+  /// Element chunks
+  double **elementChunk_;
+  int **indexChunk_;
+  int numberChunks_;
+  int maximumChunks_;
+  /// Names
+  char *rowNames_;
+  CoinBigIndex *rowNameStart_;
+  CoinBigIndex sizeRowNames_;
+  CoinBigIndex maximumRowNames_;
+  char *columnNames_;
+  CoinBigIndex *columnNameStart_;
+  CoinBigIndex sizeColumnNames_;
+  CoinBigIndex maximumColumnNames_;
+  /// Hash tables (open addressing)
+  int *rowHash_;
+  int rowHashSize_;
+  int *columnHash_;
+  int columnHashSize_;
+  /// Last column with entry in row (while reading COLUMNS)
+  int *rowUsed_;
+  /// Last column with objective entry
+  int lastObjective_;
+  /// Buffer for parallel block
+  char *buffer_;
+  CoinBigIndex sizeBuffer_;
+  /// Number of threads
+  int numberThreads_;
+  /// Keep names
+  bool keepNames_;
+  //@}
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -4,10 +4,12 @@
 // This code is licensed under the terms of the Eclipse Public License (EPL).
 
 #include <cstdio>
+#include <cstring>
 
 #include "CoinPragma.hpp"
 #include "CoinIndexedVector.hpp"
 #include "CoinHelperFunctions.hpp"
+#include "ClpHelperFunctions.hpp"
 //#define THREAD
 //#define FAKE_CILK
 #if ABOCA_LITE
@@ -23,6 +25,27 @@
 // at end to get min/max!
 #include "ClpPackedMatrix.hpp"
 #include "ClpMessage.hpp"
+/* transposeTimes, transposeTimesSubset and packDown can be split over
+   threads - with cilk if ABOCA_LITE or with the worker pool if configured
+   with --enable-clp-threads (CLP_THREAD_POOL).  clpPriceThreads(n) is
+   number of chunks to use for n columns (0 means do serially) */
+#if ABOCA_LITE
+#define CLP_PARALLEL_PRICE ABOCA_LITE
+#define clpPriceThreads(n) abcState()
+#elif defined(CLP_THREAD_POOL)
+#define CLP_PARALLEL_PRICE 8
+// not worth waking pool for small numbers of columns
+#ifndef CLP_PARALLEL_PRICE_MINIMUM
+#define CLP_PARALLEL_PRICE_MINIMUM 5000
+#endif
+static inline int clpPriceThreads(int number)
+{
+  int numberThreads = clpParallelThreads();
+  if (numberThreads < 2 || number < CLP_PARALLEL_PRICE_MINIMUM)
+    return 0;
+  return CoinMin(numberThreads, CLP_PARALLEL_PRICE);
+}
+#endif
 #ifdef INTEL_MKL
 #include "mkl_spblas.h"
 #endif
@@ -335,7 +358,7 @@ void ClpPackedMatrix::times(double scalar,
     }
   }
 }
-#if ABOCA_LITE
+#ifdef CLP_PARALLEL_PRICE
 static void
 transposeTimesBit(clpTempInfo &info)
 {
@@ -370,10 +393,10 @@ void ClpPackedMatrix::transposeTimes(double scalar,
   const double *COIN_RESTRICT elementByColumn = matrix_->getElements();
   if (!(flags_ & 2)) {
     if (scalar == -1.0) {
-#if ABOCA_LITE
-      int numberThreads = abcState();
+#ifdef CLP_PARALLEL_PRICE
+      int numberThreads = clpPriceThreads(numberActiveColumns_);
       if (numberThreads) {
-        clpTempInfo info[ABOCA_LITE];
+        clpTempInfo info[CLP_PARALLEL_PRICE];
         int chunk = (numberActiveColumns_ + numberThreads - 1) / numberThreads;
         int n = 0;
         for (int i = 0; i < numberThreads; i++) {
@@ -386,10 +409,7 @@ void ClpPackedMatrix::transposeTimes(double scalar,
           info[i].numberToDo = CoinMin(chunk, numberActiveColumns_ - n);
           n += chunk;
         }
-        for (int i = 0; i < numberThreads; i++) {
-          cilk_spawn transposeTimesBit(info[i]);
-        }
-        cilk_sync;
+        clpParallelFor(transposeTimesBit, info, numberThreads);
       } else {
 #endif
         CoinBigIndex start = columnStart[0];
@@ -404,7 +424,7 @@ void ClpPackedMatrix::transposeTimes(double scalar,
           start = next;
           y[iColumn] = value;
         }
-#if ABOCA_LITE
+#ifdef CLP_PARALLEL_PRICE
       }
 #endif
     } else {
@@ -585,7 +605,7 @@ void ClpPackedMatrix::transposeTimes(double scalar,
     transposeTimes(scalar, x, y);
   }
 }
-#if ABOCA_LITE
+#ifdef CLP_PARALLEL_PRICE
 static void
 transposeTimesSubsetBit(clpTempInfo &info)
 {
@@ -638,10 +658,10 @@ void ClpPackedMatrix::transposeTimesSubset(int number,
         y[iColumn] -= value * columnScale[iColumn];
       }
     } else {
-#if ABOCA_LITE
-      int numberThreads = abcState();
+#ifdef CLP_PARALLEL_PRICE
+      int numberThreads = clpPriceThreads(number);
       if (numberThreads) {
-        clpTempInfo info[ABOCA_LITE];
+        clpTempInfo info[CLP_PARALLEL_PRICE];
         int chunk = (number + numberThreads - 1) / numberThreads;
         int n = 0;
         for (int i = 0; i < numberThreads; i++) {
@@ -655,10 +675,7 @@ void ClpPackedMatrix::transposeTimesSubset(int number,
           info[i].numberToDo = CoinMin(chunk, number - n);
           n += chunk;
         }
-        for (int i = 0; i < numberThreads; i++) {
-          cilk_spawn transposeTimesSubsetBit(info[i]);
-        }
-        cilk_sync;
+        clpParallelFor(transposeTimesSubsetBit, info, numberThreads);
       } else {
 #endif
         for (int jColumn = 0; jColumn < number; jColumn++) {
@@ -673,7 +690,7 @@ void ClpPackedMatrix::transposeTimesSubset(int number,
           }
           y[iColumn] -= value;
         }
-#if ABOCA_LITE
+#ifdef CLP_PARALLEL_PRICE
       }
 #endif
     }
@@ -1668,10 +1685,7 @@ int ClpPackedMatrix::gutsOfTransposeTimesUnscaled(const double *COIN_RESTRICT pi
       info[i].tolerance = zeroTolerance;
       n += chunk;
     }
-    for (int i = 0; i < numberThreads; i++) {
-      cilk_spawn transposeTimesUnscaledBit(info[i]);
-    }
-    cilk_sync;
+    clpParallelFor(transposeTimesUnscaledBit, info, numberThreads);
     for (int i = 0; i < numberThreads; i++)
       numberNonZero += info[i].numberAdded;
     moveAndZero(info, 2, NULL);
@@ -1840,10 +1854,7 @@ int ClpPackedMatrix::gutsOfTransposeTimesUnscaled(const double *COIN_RESTRICT pi
       info[i].dualTolerance = dualTolerance;
       n += chunk;
     }
-    for (int i = 0; i < numberThreads; i++) {
-      cilk_spawn transposeTimesUnscaledBit2(info[i]);
-    }
-    cilk_sync;
+    clpParallelFor(transposeTimesUnscaledBit2, info, numberThreads);
     for (int i = 0; i < numberThreads; i++) {
       numberNonZero += info[i].numberAdded;
       numberRemaining += info[i].numberRemaining;
@@ -2024,7 +2035,7 @@ int ClpPackedMatrix::gutsOfTransposeTimesScaled(const double *COIN_RESTRICT pi,
   }
   return numberNonZero;
 }
-#if ABOCA_LITE
+#ifdef CLP_PARALLEL_PRICE
 static void
 packDownBit(clpTempInfo &info)
 {
@@ -2046,6 +2057,32 @@ packDownBit(clpTempInfo &info)
   }
   info.numberAdded = numberNonZero;
 }
+/* Moves packed chunks from packDownBit together and zeroes what is
+   left behind - returns number nonzero */
+static int
+packDownMerge(clpTempInfo *info, int numberThreads)
+{
+  int numberNonZero = info[0].numberAdded;
+  for (int i = 1; i < numberThreads; i++) {
+    int number = info[i].numberAdded;
+    double *COIN_RESTRICT from = info[i].infeas;
+    double *COIN_RESTRICT to = info[0].infeas + numberNonZero;
+    if (from != to) {
+      memmove(info[0].which + numberNonZero, info[i].which, number * sizeof(int));
+      memmove(to, from, number * sizeof(double));
+    }
+    numberNonZero += number;
+  }
+  // zero any of old chunks not overwritten
+  double *COIN_RESTRICT end = info[0].infeas + numberNonZero;
+  for (int i = 1; i < numberThreads; i++) {
+    double *COIN_RESTRICT start = CoinMax(info[i].infeas, end);
+    double *COIN_RESTRICT last = info[i].infeas + info[i].numberAdded;
+    if (last > start)
+      memset(start, 0, (last - start) * sizeof(double));
+  }
+  return numberNonZero;
+}
 #endif
 // Meat of transposeTimes by row n > K if packed - returns number nonzero
 int ClpPackedMatrix::gutsOfTransposeTimesByRowGEK(const CoinIndexedVector *COIN_RESTRICT piVector,
@@ -2083,10 +2120,10 @@ int ClpPackedMatrix::gutsOfTransposeTimesByRowGEK(const CoinIndexedVector *COIN_
   }
   // get rid of tiny values and count
   int numberNonZero = 0;
-#if ABOCA_LITE
-  int numberThreads = abcState();
+#ifdef CLP_PARALLEL_PRICE
+  int numberThreads = clpPriceThreads(numberColumns);
   if (numberThreads) {
-    clpTempInfo info[ABOCA_LITE];
+    clpTempInfo info[CLP_PARALLEL_PRICE];
     int chunk = (numberColumns + numberThreads - 1) / numberThreads;
     int n = 0;
     for (int i = 0; i < numberThreads; i++) {
@@ -2097,14 +2134,8 @@ int ClpPackedMatrix::gutsOfTransposeTimesByRowGEK(const CoinIndexedVector *COIN_
       info[i].tolerance = tolerance;
       n += chunk;
     }
-    for (int i = 0; i < numberThreads; i++) {
-      cilk_spawn packDownBit(info[i]);
-    }
-    cilk_sync;
-    for (int i = 0; i < numberThreads; i++) {
-      numberNonZero += info[i].numberAdded;
-    }
-    moveAndZero(info, 2, NULL);
+    clpParallelFor(packDownBit, info, numberThreads);
+    numberNonZero = packDownMerge(info, numberThreads);
   } else {
 #endif
     for (int i = 0; i < numberColumns; i++) {
@@ -2117,7 +2148,7 @@ int ClpPackedMatrix::gutsOfTransposeTimesByRowGEK(const CoinIndexedVector *COIN_
         }
       }
     }
-#if ABOCA_LITE
+#ifdef CLP_PARALLEL_PRICE
   }
 #endif
 #ifndef NDEBUG
@@ -2708,10 +2739,7 @@ int ClpPackedMatrix::transposeTimes2(const ClpSimplex *model,
             info[i].numberInfeasibilities = killDjs ? 1 : 0;
             n += chunk;
           }
-          for (int i = 0; i < numberThreads; i++) {
-            cilk_spawn transposeTimes2UnscaledBit(info[i]);
-          }
-          cilk_sync;
+          clpParallelFor(transposeTimes2UnscaledBit, info, numberThreads);
           for (int i = 0; i < numberThreads; i++) {
             numberNonZero += info[i].numberAdded;
           }
@@ -2892,10 +2920,7 @@ int ClpPackedMatrix::transposeTimes2(const ClpSimplex *model,
             info[i].numberInfeasibilities = killDjs ? 1 : 0;
             n += chunk;
           }
-          for (int i = 0; i < numberThreads; i++) {
-            cilk_spawn transposeTimes2ScaledBit(info[i]);
-          }
-          cilk_sync;
+          clpParallelFor(transposeTimes2ScaledBit, info, numberThreads);
           for (int i = 0; i < numberThreads; i++) {
             numberNonZero += info[i].numberAdded;
           }
@@ -6757,6 +6782,10 @@ ClpPackedMatrix3::ClpPackedMatrix3()
   , row_(NULL)
   , element_(NULL)
   , temporary_(NULL)
+#if PRICE_USE_CHUNKS
+  , dualWork_(NULL)
+  , dualIndex_(NULL)
+#endif
   , block_(NULL)
   , ifActive_(0)
   , plusOnes_(0)
@@ -6787,6 +6816,10 @@ ClpPackedMatrix3::ClpPackedMatrix3(ClpSimplex *model, const CoinPackedMatrix *co
   , row_(NULL)
   , element_(NULL)
   , temporary_(NULL)
+#if PRICE_USE_CHUNKS
+  , dualWork_(NULL)
+  , dualIndex_(NULL)
+#endif
   , block_(NULL)
   , ifActive_(0)
   , plusOnes_(0)
@@ -7280,6 +7313,10 @@ ClpPackedMatrix3::~ClpPackedMatrix3()
   delete[] row_;
   delete[] element_;
   delete temporary_;
+#if PRICE_USE_CHUNKS
+  delete[] dualWork_;
+  delete[] dualIndex_;
+#endif
   delete[] block_;
 }
 /* The copy constructor. */
@@ -7299,6 +7336,10 @@ ClpPackedMatrix3::ClpPackedMatrix3(const ClpPackedMatrix3 &rhs)
   , row_(NULL)
   , element_(NULL)
   , temporary_(NULL)
+#if PRICE_USE_CHUNKS
+  , dualWork_(NULL)
+  , dualIndex_(NULL)
+#endif
   , block_(NULL)
   , ifActive_(rhs.ifActive_)
   , plusOnes_(rhs.plusOnes_)
@@ -7342,6 +7383,12 @@ ClpPackedMatrix3::operator=(const ClpPackedMatrix3 &rhs)
     delete[] element_;
     delete temporary_;
     temporary_ = NULL;
+#if PRICE_USE_CHUNKS
+    delete[] dualWork_;
+    dualWork_ = NULL;
+    delete[] dualIndex_;
+    dualIndex_ = NULL;
+#endif
     delete[] block_;
     numberBlocks_ = rhs.numberBlocks_;
     numberColumns_ = rhs.numberColumns_;
@@ -8354,6 +8401,28 @@ void ClpPackedMatrix3::transposeTimes(const ClpSimplex *model,
   }
   output->setNumElements(numberNonZero);
 }
+#if ABOCA_LITE && PRICE_USE_CHUNKS
+// padding for each chunk in parallel dualColumn0 (alignment of AVX stores)
+#define DUAL_CHUNK_EXTRA 16
+typedef struct {
+  const ClpPackedMatrix3 *matrix;
+  const double *pi;
+  const double *reducedCost;
+  double *array;
+  int *index;
+  double *spareArray;
+  int *spareIndex;
+  double zeroTolerance;
+  double dualT;
+  double acceptablePivot;
+  double upperTheta;
+  int firstBlock;
+  int lastBlock;
+  int numberNonZero;
+  int numberRemaining;
+} transposeTimesDualStruct;
+static void transposeTimesDualBit(transposeTimesDualStruct &info);
+#endif
 /* Return <code>x * -1 * A in <code>z</code>.
    Note - x packed and z will be packed mode
    Squashes small elements and knows about ClpSimplex
@@ -8469,9 +8538,91 @@ void ClpPackedMatrix3::transposeTimes(const ClpSimplex *model,
       }
     }
   }
+#if ABOCA_LITE && PRICE_USE_CHUNKS
+  int numberThreads = abcState();
+  if (numberThreads > 1 && numberChunks_ > 1) {
+    /* Each chunk of blocks goes into its own part of work area.
+       Chunks are given out to threads as they become free and are
+       merged in order so result does not depend on number of threads.
+       upperTheta is just minimum of chunk values */
+    if (!dualWork_) {
+      int size = numberColumnsWithGaps_ + 2 * DUAL_CHUNK_EXTRA * numberChunks_;
+      dualWork_ = new double[2 * size];
+      dualIndex_ = new int[2 * size];
+    }
+    transposeTimesDualStruct info[2 * PRICE_USE_CHUNKS];
+    int offset = 0;
+    int offsetCandidate = numberColumnsWithGaps_ + 2 * DUAL_CHUNK_EXTRA * numberChunks_;
+    for (int iChunk = 0; iChunk < numberChunks_; iChunk++) {
+      int firstBlock = endChunk_[iChunk];
+      int lastBlock = endChunk_[iChunk + 1];
+      int size = 0;
+      for (int iBlock = firstBlock; iBlock < lastBlock; iBlock++)
+        size += block_[iBlock].numberInBlock_;
+      info[iChunk].matrix = this;
+      info[iChunk].firstBlock = firstBlock;
+      info[iChunk].lastBlock = lastBlock;
+      info[iChunk].pi = pi;
+      info[iChunk].reducedCost = reducedCost;
+      info[iChunk].zeroTolerance = zeroTolerance;
+      info[iChunk].dualT = dualT;
+      info[iChunk].acceptablePivot = acceptablePivot;
+      info[iChunk].upperTheta = upperTheta;
+      info[iChunk].array = dualWork_ + offset;
+      info[iChunk].index = dualIndex_ + offset;
+      info[iChunk].spareArray = dualWork_ + offsetCandidate;
+      info[iChunk].spareIndex = dualIndex_ + offsetCandidate;
+      offset += size + 2 * DUAL_CHUNK_EXTRA;
+      offsetCandidate += size;
+    }
+    clpParallelFor(transposeTimesDualBit, info, numberChunks_);
+    for (int iChunk = 0; iChunk < numberChunks_; iChunk++) {
+      int n = info[iChunk].numberNonZero;
+      memcpy(array + numberNonZero, info[iChunk].array, n * sizeof(double));
+      memcpy(index + numberNonZero, info[iChunk].index, n * sizeof(int));
+      numberNonZero += n;
+      n = info[iChunk].numberRemaining;
+      memcpy(spareArray + numberRemaining, info[iChunk].spareArray, n * sizeof(double));
+      memcpy(spareIndex + numberRemaining, info[iChunk].spareIndex, n * sizeof(int));
+      numberRemaining += n;
+      upperTheta = CoinMin(upperTheta, info[iChunk].upperTheta);
+    }
+  } else {
+#endif
+    int nMax = transposeTimesDual(0, numberBlocks_, pi, reducedCost,
+      zeroTolerance, dualT, acceptablePivot, upperTheta,
+      array, index, numberNonZero,
+      spareArray, spareIndex, numberRemaining);
+    for (int j = numberNonZero; j < nMax; j++)
+      array[j] = 0.0;
+#if ABOCA_LITE && PRICE_USE_CHUNKS
+  }
+#endif
+  output->setNumElements(numberNonZero);
+  candidate->setNumElements(numberRemaining);
+  model->spareDoubleArray_[0] = upperTheta;
+}
+/* Part of transposeTimes which does dualColumn0 - for blocks
+   firstBlock to lastBlock-1.  Nonzeros are added to array,index and
+   candidates to spareArray,spareIndex (counts updated).
+   Returns end of part of array used (so rest can be zeroed) */
+int ClpPackedMatrix3::transposeTimesDual(int firstBlock, int lastBlock,
+  const double *COIN_RESTRICT pi,
+  const double *COIN_RESTRICT reducedCost,
+  double zeroTolerance, double dualT, double acceptablePivot,
+  double &upperThetaP,
+  double *COIN_RESTRICT array, int *COIN_RESTRICT index,
+  int &numberNonZeroP,
+  double *COIN_RESTRICT spareArray, int *COIN_RESTRICT spareIndex,
+  int &numberRemainingP) const
+{
+  double tentativeTheta = 1.0e15;
+  double upperTheta = upperThetaP;
+  int numberNonZero = numberNonZeroP;
+  int numberRemaining = numberRemainingP;
   int numberOld = numberNonZero;
   int nMax = 0;
-  for (int iBlock = 0; iBlock < numberBlocks_; iBlock++) {
+  for (int iBlock = firstBlock; iBlock < lastBlock; iBlock++) {
     // C) Can do two at a time (if so put odd one into start_)
     // D) can use switch
     blockStruct *block = block_ + iBlock;
@@ -8861,12 +9012,24 @@ void ClpPackedMatrix3::transposeTimes(const ClpSimplex *model,
     }
     numberOld = numberNonZero;
   }
-  for (int j = numberNonZero; j < nMax; j++)
-    array[j] = 0.0;
-  output->setNumElements(numberNonZero);
-  candidate->setNumElements(numberRemaining);
-  model->spareDoubleArray_[0] = upperTheta;
+  upperThetaP = upperTheta;
+  numberNonZeroP = numberNonZero;
+  numberRemainingP = numberRemaining;
+  return nMax;
+}
+#if ABOCA_LITE && PRICE_USE_CHUNKS
+static void
+transposeTimesDualBit(transposeTimesDualStruct &info)
+{
+  info.numberNonZero = 0;
+  info.numberRemaining = 0;
+  info.matrix->transposeTimesDual(info.firstBlock, info.lastBlock,
+    info.pi, info.reducedCost, info.zeroTolerance, info.dualT,
+    info.acceptablePivot, info.upperTheta,
+    info.array, info.index, info.numberNonZero,
+    info.spareArray, info.spareIndex, info.numberRemaining);
 }
+#endif
 static void
 transposeTimes3Bit2Odd(clpTempInfo &info)
 {
@@ -8997,6 +9160,131 @@ transposeTimes3Bit2Odd(clpTempInfo &info)
   info.numberAdded = bestSequence;
 }
 
+#if COIN_AVX2 == 1
+/* Blocked pricing for stock layout (COIN_AVX2 == 1) - each column of
+   a block has nel contiguous entries.  For numberColumns columns computes
+   value = -pi*column and modification = piWeight*column.
+   SIMD versions work across columns (gathers) and keep the same order of
+   operations as the scalar one so results do not depend on cpu.
+   That needs the multiplies and adds rounded separately so contraction
+   into fused multiply-add is switched off for all the kernels (gcc would
+   otherwise fuse the intrinsics and compilers targeting fma can fuse the
+   scalar loop). */
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC push_options
+#pragma GCC optimize("fp-contract=off")
+#define CLP_NO_FP_CONTRACT
+#elif defined(__clang__)
+#define CLP_NO_FP_CONTRACT _Pragma("clang fp contract(off)")
+#else
+#define CLP_NO_FP_CONTRACT
+#endif
+typedef void (*clpBlockPriceFunction)(int numberColumns, int nel,
+  const int *row, const double *element,
+  const double *pi, const double *piWeight,
+  double *value, double *modification);
+static void
+blockPriceScalar(int numberColumns, int nel,
+  const int *COIN_RESTRICT row, const double *COIN_RESTRICT element,
+  const double *COIN_RESTRICT pi, const double *COIN_RESTRICT piWeight,
+  double *COIN_RESTRICT value, double *COIN_RESTRICT modification)
+{
+  CLP_NO_FP_CONTRACT
+  for (int j = 0; j < numberColumns; j++) {
+    double valueJ = 0.0;
+    double modificationJ = 0.0;
+    for (int i = 0; i < nel; i++) {
+      int iRow = row[i];
+      valueJ -= pi[iRow] * element[i];
+      modificationJ += piWeight[iRow] * element[i];
+    }
+    value[j] = valueJ;
+    modification[j] = modificationJ;
+    row += nel;
+    element += nel;
+  }
+}
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(CLP_NO_RUNTIME_AVX)
+#define CLP_RUNTIME_AVX
+__attribute__((target("avx2"))) static void
+blockPriceAvx2(int numberColumns, int nel,
+  const int *COIN_RESTRICT row, const double *COIN_RESTRICT element,
+  const double *COIN_RESTRICT pi, const double *COIN_RESTRICT piWeight,
+  double *COIN_RESTRICT value, double *COIN_RESTRICT modification)
+{
+  CLP_NO_FP_CONTRACT
+  __m128i stride = _mm_setr_epi32(0, nel, 2 * nel, 3 * nel);
+  __m256d zero = _mm256_setzero_pd();
+  int numberDo = numberColumns & ~3;
+  for (int j = 0; j < numberDo; j += 4) {
+    __m256d sumPi = zero;
+    __m256d sumWeight = zero;
+    for (int i = 0; i < nel; i++) {
+      __m128i rows = _mm_i32gather_epi32(row + i, stride, 4);
+      __m256d elements = _mm256_i32gather_pd(element + i, stride, 8);
+      __m256d pis = _mm256_i32gather_pd(pi, rows, 8);
+      __m256d piWeights = _mm256_i32gather_pd(piWeight, rows, 8);
+      sumPi = _mm256_add_pd(sumPi, _mm256_mul_pd(pis, elements));
+      sumWeight = _mm256_add_pd(sumWeight, _mm256_mul_pd(piWeights, elements));
+    }
+    _mm256_storeu_pd(value + j, _mm256_sub_pd(zero, sumPi));
+    _mm256_storeu_pd(modification + j, sumWeight);
+    row += 4 * nel;
+    element += 4 * nel;
+  }
+  blockPriceScalar(numberColumns - numberDo, nel, row, element,
+    pi, piWeight, value + numberDo, modification + numberDo);
+}
+__attribute__((target("avx512f"))) static void
+blockPriceAvx512(int numberColumns, int nel,
+  const int *COIN_RESTRICT row, const double *COIN_RESTRICT element,
+  const double *COIN_RESTRICT pi, const double *COIN_RESTRICT piWeight,
+  double *COIN_RESTRICT value, double *COIN_RESTRICT modification)
+{
+  CLP_NO_FP_CONTRACT
+  __m256i stride = _mm256_setr_epi32(0, nel, 2 * nel, 3 * nel,
+    4 * nel, 5 * nel, 6 * nel, 7 * nel);
+  __m512d zero = _mm512_setzero_pd();
+  int numberDo = numberColumns & ~7;
+  for (int j = 0; j < numberDo; j += 8) {
+    __m512d sumPi = zero;
+    __m512d sumWeight = zero;
+    for (int i = 0; i < nel; i++) {
+      __m256i rows = _mm256_i32gather_epi32(row + i, stride, 4);
+      __m512d elements = _mm512_i32gather_pd(stride, element + i, 8);
+      __m512d pis = _mm512_i32gather_pd(rows, pi, 8);
+      __m512d piWeights = _mm512_i32gather_pd(rows, piWeight, 8);
+      sumPi = _mm512_add_pd(sumPi, _mm512_mul_pd(pis, elements));
+      sumWeight = _mm512_add_pd(sumWeight, _mm512_mul_pd(piWeights, elements));
+    }
+    _mm512_storeu_pd(value + j, _mm512_sub_pd(zero, sumPi));
+    _mm512_storeu_pd(modification + j, sumWeight);
+    row += 8 * nel;
+    element += 8 * nel;
+  }
+  blockPriceAvx2(numberColumns - numberDo, nel, row, element,
+    pi, piWeight, value + numberDo, modification + numberDo);
+}
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC pop_options
+#endif
+#undef CLP_NO_FP_CONTRACT
+// Chooses kernel from what cpu can do
+static clpBlockPriceFunction
+chooseBlockPrice()
+{
+#ifdef CLP_RUNTIME_AVX
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f"))
+    return blockPriceAvx512;
+  else if (__builtin_cpu_supports("avx2"))
+    return blockPriceAvx2;
+#endif
+  return blockPriceScalar;
+}
+static clpBlockPriceFunction clpBlockPrice = chooseBlockPrice();
+#endif
 static void
 transposeTimes3Bit2(clpTempInfo &info)
 {
@@ -9429,22 +9717,19 @@ transposeTimes3Bit2(clpTempInfo &info)
     const int *COIN_RESTRICT row = rowBlock + block->startRows_;
     const double *COIN_RESTRICT element = elementBlock + block->startElements_;
     const int *COIN_RESTRICT column = columnBlock + block->startIndices_;
-    int numberDo = roundDown(numberPrice);
-    for (int j = 0; j < numberPrice; j++) {
-      double value = 0.0;
-      double modification = 0.0;
-      for (int i = 0; i < nel; i++) {
-        //assert (element+i*COIN_AVX2<tempArray);
-        int iRow = row[i * COIN_AVX2];
-        value -= pi[iRow] * element[i * COIN_AVX2];
-        modification += piWeight[iRow] * element[i * COIN_AVX2];
-      }
+    // do COIN_AVX2_CHUNK at a time so kernel can use gathers
+    for (int kColumn = 0; kColumn < numberPrice; kColumn += COIN_AVX2_CHUNK) {
+      int numberDo = CoinMin(numberPrice - kColumn, COIN_AVX2_CHUNK);
+      clpBlockPrice(numberDo, nel, row, element, pi, piWeight, work2, work);
+      for (int j = 0; j < numberDo; j++) {
+        double value = work2[j];
+        double modification = work[j];
 // common coding
 #include "ClpPackedMatrix.hpp"
-      row += nel;
-      element += nel;
+      }
+      row += numberDo * nel;
+      element += numberDo * nel;
     }
-    int n = numberPrice;
   }
 #endif
   info.numberAdded = bestSequence;
@@ -9604,13 +9889,11 @@ void ClpPackedMatrix3::transposeTimes2(const ClpSimplex *model,
   info[ODD_INFO + 1].numberToDo = numberBlocks_ + 1;
 #if ABOCA_LITE
   if (abcState() > 1) {
-    cilk_spawn transposeTimes3Bit2Odd(info[ODD_INFO]);
-    for (int iBlock = 0; iBlock < numberChunks_; iBlock++) {
-      cilk_spawn transposeTimes3Bit2(info[iBlock]);
-    }
+    // odd ones are few so do first
+    transposeTimes3Bit2Odd(info[ODD_INFO]);
+    clpParallelFor(transposeTimes3Bit2, info, numberChunks_);
     if (infeas)
       transposeTimes3BitSlacks(info[ODD_INFO + 1]);
-    cilk_sync;
   } else {
     transposeTimes3Bit2Odd(info[ODD_INFO]);
     for (int iBlock = 0; iBlock < numberChunks_; iBlock++) {
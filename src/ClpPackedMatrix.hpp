@@ -624,6 +624,15 @@ public:
     CoinIndexedVector *output,
     CoinIndexedVector *candidate,
     const CoinIndexedVector *rowArray) const;
+  /** Part of above for blocks firstBlock to lastBlock-1.
+      Nonzeros are added to array/index and candidates to
+      spareArray/spareIndex (counts and upperTheta updated).
+      Returns end of area of array used (so can be zeroed) */
+  int transposeTimesDual(int firstBlock, int lastBlock,
+    const double *pi, const double *reducedCost,
+    double zeroTolerance, double dualT, double acceptablePivot,
+    double &upperTheta, double *array, int *index, int &numberNonZero,
+    double *spareArray, int *spareIndex, int &numberRemaining) const;
   void transposeTimes2(const ClpSimplex *model,
     const double *pi, CoinIndexedVector *dj1,
     const double *piWeight,
@@ -708,6 +717,10 @@ protected:
 #if PRICE_USE_CHUNKS
   /// Chunk ends (could have more than cpus)
   int endChunk_[2 * PRICE_USE_CHUNKS + 1];
+  /// Work area for chunks in parallel dualColumn0 (allocated when needed)
+  mutable double *dualWork_;
+  /// Indices for chunks in parallel dualColumn0
+  mutable int *dualIndex_;
 #endif
   /// Blocks (ordinary start at 0 and go to first block)
   blockStruct *block_;
@@ -0,0 +1,1296 @@
+/* $Id$ */
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CoinPragma.hpp"
+
+#include <cassert>
+#include <cmath>
+
+#include "CoinFinite.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinIndexedVector.hpp"
+#include "ClpHelperFunctions.hpp"
+#include "ClpParallelFactorization.hpp"
+
+// Columns in a panel of dense nucleus
+#define PARALLEL_PANEL 32
+// Fewest trailing columns for a task
+#define PARALLEL_MIN_COLUMNS 16
+// Default for hyperSparseRatio_
+#define PARALLEL_HYPER_RATIO 20
+// Most right hand sides done together by updateColumns
+#define PARALLEL_RHS_BLOCK 8
+
+//-------------------------------------------------------------------
+// Default Constructor
+//-------------------------------------------------------------------
+ClpParallelFactorization::ClpParallelFactorization()
+  : CoinOtherFactorization()
+  , indices_(NULL)
+  , pivotRowStep_(NULL)
+  , pivotColumnStep_(NULL)
+  , pivotInverse_(NULL)
+  , startL_(NULL)
+  , indexL_(NULL)
+  , elementL_(NULL)
+  , startU_(NULL)
+  , indexU_(NULL)
+  , elementU_(NULL)
+  , stepOfRow_(NULL)
+  , startLT_(NULL)
+  , indexLT_(NULL)
+  , elementLT_(NULL)
+  , startUT_(NULL)
+  , indexUT_(NULL)
+  , elementUT_(NULL)
+  , mark_(NULL)
+  , stack_(NULL)
+  , list_(NULL)
+  , markStamp_(0)
+  , startEta_(NULL)
+  , pivotEta_(NULL)
+  , pivotValueEta_(NULL)
+  , indexEta_(NULL)
+  , elementEta_(NULL)
+  , maximumRowsSpace_(0)
+  , maximumElementSpace_(0)
+  , maximumEtaSpace_(0)
+  , maximumEtas_(0)
+  , maximumDense_(5000)
+  , numberInNucleus_(0)
+  , numberThreads_(0)
+  , hyperSparseRatio_(PARALLEL_HYPER_RATIO)
+{
+  numberHyperSparse_[0] = 0;
+  numberHyperSparse_[1] = 0;
+  // input areas are allocated here
+  elements_ = NULL;
+  pivotRow_ = NULL;
+  workArea_ = NULL;
+}
+
+//-------------------------------------------------------------------
+// Copy constructor
+//-------------------------------------------------------------------
+ClpParallelFactorization::ClpParallelFactorization(const ClpParallelFactorization &rhs)
+  : CoinOtherFactorization()
+  , indices_(NULL)
+  , pivotRowStep_(NULL)
+  , pivotColumnStep_(NULL)
+  , pivotInverse_(NULL)
+  , startL_(NULL)
+  , indexL_(NULL)
+  , elementL_(NULL)
+  , startU_(NULL)
+  , indexU_(NULL)
+  , elementU_(NULL)
+  , stepOfRow_(NULL)
+  , startLT_(NULL)
+  , indexLT_(NULL)
+  , elementLT_(NULL)
+  , startUT_(NULL)
+  , indexUT_(NULL)
+  , elementUT_(NULL)
+  , mark_(NULL)
+  , stack_(NULL)
+  , list_(NULL)
+  , markStamp_(0)
+  , startEta_(NULL)
+  , pivotEta_(NULL)
+  , pivotValueEta_(NULL)
+  , indexEta_(NULL)
+  , elementEta_(NULL)
+  , maximumRowsSpace_(0)
+  , maximumElementSpace_(0)
+  , maximumEtaSpace_(0)
+  , maximumEtas_(0)
+{
+  numberHyperSparse_[0] = 0;
+  numberHyperSparse_[1] = 0;
+  elements_ = NULL;
+  pivotRow_ = NULL;
+  workArea_ = NULL;
+  gutsOfCopy(rhs);
+}
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+ClpParallelFactorization::~ClpParallelFactorization()
+{
+  gutsOfDestructor();
+}
+
+//----------------------------------------------------------------
+// Assignment operator
+//-------------------------------------------------------------------
+ClpParallelFactorization &
+ClpParallelFactorization::operator=(const ClpParallelFactorization &rhs)
+{
+  if (this != &rhs) {
+    gutsOfDestructor();
+    gutsOfCopy(rhs);
+  }
+  return *this;
+}
+// Clone
+CoinOtherFactorization *
+ClpParallelFactorization::clone() const
+{
+  return new ClpParallelFactorization(*this);
+}
+// Frees factors
+void ClpParallelFactorization::freeFactors()
+{
+  delete[] pivotRowStep_;
+  delete[] pivotColumnStep_;
+  delete[] pivotInverse_;
+  delete[] stepOfRow_;
+  delete[] startLT_;
+  delete[] indexLT_;
+  delete[] elementLT_;
+  delete[] startUT_;
+  delete[] indexUT_;
+  delete[] elementUT_;
+  delete[] mark_;
+  delete[] stack_;
+  delete[] list_;
+  delete[] startL_;
+  delete[] indexL_;
+  delete[] elementL_;
+  delete[] startU_;
+  delete[] indexU_;
+  delete[] elementU_;
+  delete[] startEta_;
+  delete[] pivotEta_;
+  delete[] pivotValueEta_;
+  delete[] indexEta_;
+  delete[] elementEta_;
+  pivotRowStep_ = NULL;
+  pivotColumnStep_ = NULL;
+  pivotInverse_ = NULL;
+  stepOfRow_ = NULL;
+  startLT_ = NULL;
+  indexLT_ = NULL;
+  elementLT_ = NULL;
+  startUT_ = NULL;
+  indexUT_ = NULL;
+  elementUT_ = NULL;
+  mark_ = NULL;
+  stack_ = NULL;
+  list_ = NULL;
+  markStamp_ = 0;
+  startL_ = NULL;
+  indexL_ = NULL;
+  elementL_ = NULL;
+  startU_ = NULL;
+  indexU_ = NULL;
+  elementU_ = NULL;
+  startEta_ = NULL;
+  pivotEta_ = NULL;
+  pivotValueEta_ = NULL;
+  indexEta_ = NULL;
+  elementEta_ = NULL;
+  maximumEtaSpace_ = 0;
+  maximumEtas_ = 0;
+}
+// Frees everything
+void ClpParallelFactorization::gutsOfDestructor()
+{
+  freeFactors();
+  delete[] elements_;
+  delete[] pivotRow_;
+  delete[] workArea_;
+  delete[] indices_;
+  elements_ = NULL;
+  pivotRow_ = NULL;
+  workArea_ = NULL;
+  indices_ = NULL;
+  maximumRowsSpace_ = 0;
+  maximumElementSpace_ = 0;
+}
+// Copies everything except input areas
+void ClpParallelFactorization::gutsOfCopy(const ClpParallelFactorization &rhs)
+{
+  pivotTolerance(rhs.pivotTolerance());
+  zeroTolerance(rhs.zeroTolerance());
+  maximumPivots(rhs.maximumPivots());
+  setSolveMode(rhs.solveMode());
+  numberRows_ = rhs.numberRows_;
+  numberColumns_ = rhs.numberColumns_;
+  numberGoodU_ = rhs.numberGoodU_;
+  numberPivots_ = rhs.numberPivots_;
+  status_ = rhs.status_;
+  maximumDense_ = rhs.maximumDense_;
+  numberInNucleus_ = rhs.numberInNucleus_;
+  numberThreads_ = rhs.numberThreads_;
+  hyperSparseRatio_ = rhs.hyperSparseRatio_;
+  numberHyperSparse_[0] = rhs.numberHyperSparse_[0];
+  numberHyperSparse_[1] = rhs.numberHyperSparse_[1];
+  if (rhs.startL_) {
+    int numberSteps = rhs.numberGoodU_;
+    pivotRowStep_ = CoinCopyOfArray(rhs.pivotRowStep_, numberRows_);
+    pivotColumnStep_ = CoinCopyOfArray(rhs.pivotColumnStep_, numberRows_);
+    pivotInverse_ = CoinCopyOfArray(rhs.pivotInverse_, numberRows_);
+    stepOfRow_ = CoinCopyOfArray(rhs.stepOfRow_, numberRows_);
+    startL_ = CoinCopyOfArray(rhs.startL_, numberRows_ + 1);
+    indexL_ = CoinCopyOfArray(rhs.indexL_, rhs.startL_[numberSteps]);
+    elementL_ = CoinCopyOfArray(rhs.elementL_, rhs.startL_[numberSteps]);
+    startU_ = CoinCopyOfArray(rhs.startU_, numberRows_ + 1);
+    indexU_ = CoinCopyOfArray(rhs.indexU_, rhs.startU_[numberSteps]);
+    elementU_ = CoinCopyOfArray(rhs.elementU_, rhs.startU_[numberSteps]);
+    maximumEtas_ = rhs.maximumEtas_;
+    maximumEtaSpace_ = rhs.maximumEtaSpace_;
+    startEta_ = CoinCopyOfArray(rhs.startEta_, maximumEtas_ + 1);
+    pivotEta_ = CoinCopyOfArray(rhs.pivotEta_, maximumEtas_);
+    pivotValueEta_ = CoinCopyOfArray(rhs.pivotValueEta_, maximumEtas_);
+    indexEta_ = CoinCopyOfArrayPartial(rhs.indexEta_, maximumEtaSpace_,
+      rhs.startEta_[numberPivots_]);
+    elementEta_ = CoinCopyOfArrayPartial(rhs.elementEta_, maximumEtaSpace_,
+      rhs.startEta_[numberPivots_]);
+  }
+}
+// Get rid of all memory
+void ClpParallelFactorization::clearArrays()
+{
+  gutsOfDestructor();
+}
+// Gets space for a factorization
+void ClpParallelFactorization::getAreas(int numberOfRows,
+  int numberOfColumns,
+  CoinBigIndex,
+  CoinBigIndex maximumU)
+{
+  numberRows_ = numberOfRows;
+  numberColumns_ = numberOfColumns;
+  if (numberRows_ > maximumRowsSpace_) {
+    delete[] pivotRow_;
+    delete[] workArea_;
+    maximumRowsSpace_ = numberRows_;
+    // starts go in pivotRow_ and counts in workArea_ - allow for big starts
+    pivotRow_ = new int[2 * (maximumRowsSpace_ + 1) * (sizeof(CoinBigIndex) / sizeof(int))];
+    workArea_ = new CoinFactorizationDouble[2 * maximumRowsSpace_ + 2];
+  }
+  if (maximumU > maximumElementSpace_) {
+    delete[] elements_;
+    delete[] indices_;
+    maximumElementSpace_ = maximumU;
+    elements_ = new CoinFactorizationDouble[maximumElementSpace_];
+    indices_ = new int[maximumElementSpace_];
+  }
+}
+// PreProcesses column ordered copy of basis
+void ClpParallelFactorization::preProcess()
+{
+  // nothing to do - factor works from column copy
+}
+// Makes sure index and element arrays can take needed more
+static void growFactor(int *&index, double *&element, CoinBigIndex &maximum,
+  CoinBigIndex number, CoinBigIndex needed)
+{
+  if (number + needed > maximum) {
+    CoinBigIndex newMaximum = CoinMax(2 * maximum, number + needed);
+    int *newIndex = new int[newMaximum];
+    double *newElement = new double[newMaximum];
+    CoinMemcpyN(index, number, newIndex);
+    CoinMemcpyN(element, number, newElement);
+    delete[] index;
+    delete[] element;
+    index = newIndex;
+    element = newElement;
+    maximum = newMaximum;
+  }
+}
+typedef struct {
+  double *dense;
+  const int *pivotLocal;
+  const CoinBigIndex *start;
+  const int *index;
+  const double *element;
+  int numberRows;
+  int firstStep;
+  int lastStep;
+  int firstColumn;
+  int lastColumn;
+} clpNucleusInfo;
+/* Applies elimination steps firstStep to lastStep-1 to columns
+   firstColumn to lastColumn-1 of dense nucleus (column by column so
+   each column sees steps in same order whatever number of tasks) */
+static void nucleusBit(clpNucleusInfo &info)
+{
+  const CoinBigIndex *start = info.start;
+  const int *index = info.index;
+  const double *element = info.element;
+  for (int iColumn = info.firstColumn; iColumn < info.lastColumn; iColumn++) {
+    double *column = info.dense + static_cast< size_t >(iColumn) * info.numberRows;
+    for (int iStep = info.firstStep; iStep < info.lastStep; iStep++) {
+      int iPivot = info.pivotLocal[iStep];
+      if (iPivot < 0)
+        continue;
+      double value = column[iPivot];
+      if (value) {
+        for (CoinBigIndex j = start[iStep]; j < start[iStep + 1]; j++)
+          column[index[j]] -= element[j] * value;
+      }
+    }
+  }
+}
+/* Does most of factorization returning status
+   0 - OK
+   -98 - nucleus too big for dense code
+   -1 - singular - use numberGoodColumns and redo */
+int ClpParallelFactorization::factor()
+{
+  freeFactors();
+  numberPivots_ = 0;
+  numberGoodU_ = 0;
+  numberInNucleus_ = 0;
+  status_ = 0;
+  int numberRows = numberRows_;
+  int numberColumns = numberColumns_;
+  const CoinBigIndex *startColumn = starts();
+  const int *numberInColumn = this->numberInColumn();
+  const CoinFactorizationDouble *element = elements_;
+  const int *indexRow = indices_;
+  double tolerance = zeroTolerance_;
+  // row copy and counts
+  CoinBigIndex *startRow = new CoinBigIndex[numberRows + 1];
+  int *rowCount = new int[numberRows];
+  int *columnCount = new int[numberColumns + 1];
+  CoinZeroN(rowCount, numberRows);
+  CoinBigIndex numberElements = 0;
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    int n = 0;
+    for (CoinBigIndex j = startColumn[iColumn]; j < startColumn[iColumn] + numberInColumn[iColumn]; j++) {
+      if (fabs(element[j]) > tolerance) {
+        rowCount[indexRow[j]]++;
+        n++;
+      }
+    }
+    columnCount[iColumn] = n;
+    numberElements += n;
+  }
+  startRow[0] = 0;
+  for (int iRow = 0; iRow < numberRows; iRow++)
+    startRow[iRow + 1] = startRow[iRow] + rowCount[iRow];
+  int *columnInRow = new int[numberElements + 1];
+  double *elementInRow = new double[numberElements + 1];
+  {
+    CoinBigIndex *put = CoinCopyOfArray(startRow, numberRows);
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+      for (CoinBigIndex j = startColumn[iColumn]; j < startColumn[iColumn] + numberInColumn[iColumn]; j++) {
+        if (fabs(element[j]) > tolerance) {
+          int iRow = indexRow[j];
+          columnInRow[put[iRow]] = iColumn;
+          elementInRow[put[iRow]++] = element[j];
+        }
+      }
+    }
+    delete[] put;
+  }
+  stepOfRow_ = new int[numberRows];
+  int *stepOfRow = stepOfRow_;
+  int *stepOfColumn = new int[numberColumns + 1];
+  for (int iRow = 0; iRow < numberRows; iRow++)
+    stepOfRow[iRow] = -1;
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+    stepOfColumn[iColumn] = -1;
+  pivotRowStep_ = new int[numberRows];
+  pivotColumnStep_ = new int[numberRows];
+  pivotInverse_ = new double[numberRows];
+  startL_ = new CoinBigIndex[numberRows + 1];
+  startU_ = new CoinBigIndex[numberRows + 1];
+  CoinBigIndex maximumL = numberElements + numberRows;
+  indexL_ = new int[maximumL];
+  elementL_ = new double[maximumL];
+  startL_[0] = 0;
+  int numberSteps = 0;
+  int *stack = new int[numberRows + 2 * numberColumns + 1];
+  int numberStack = 0;
+  // column singletons (slacks first as at start)
+  for (int iColumn = numberColumns - 1; iColumn >= 0; iColumn--) {
+    if (columnCount[iColumn] == 1)
+      stack[numberStack++] = iColumn;
+  }
+  while (numberStack) {
+    int iColumn = stack[--numberStack];
+    if (stepOfColumn[iColumn] >= 0 || columnCount[iColumn] != 1)
+      continue;
+    int pivotRow = -1;
+    double pivotValue = 0.0;
+    for (CoinBigIndex j = startColumn[iColumn]; j < startColumn[iColumn] + numberInColumn[iColumn]; j++) {
+      int iRow = indexRow[j];
+      if (stepOfRow[iRow] < 0 && fabs(element[j]) > tolerance) {
+        pivotRow = iRow;
+        pivotValue = element[j];
+        break;
+      }
+    }
+    assert(pivotRow >= 0);
+    pivotRowStep_[numberSteps] = pivotRow;
+    pivotColumnStep_[numberSteps] = iColumn;
+    pivotInverse_[numberSteps] = 1.0 / pivotValue;
+    stepOfRow[pivotRow] = numberSteps;
+    stepOfColumn[iColumn] = numberSteps;
+    numberSteps++;
+    startL_[numberSteps] = startL_[numberSteps - 1];
+    // row goes - other columns in it lose one
+    for (CoinBigIndex j = startRow[pivotRow]; j < startRow[pivotRow + 1]; j++) {
+      int jColumn = columnInRow[j];
+      if (stepOfColumn[jColumn] < 0) {
+        columnCount[jColumn]--;
+        if (columnCount[jColumn] == 1)
+          stack[numberStack++] = jColumn;
+      }
+    }
+  }
+  // row singletons if pivot acceptable
+  for (int iRow = numberRows - 1; iRow >= 0; iRow--) {
+    if (stepOfRow[iRow] < 0) {
+      // recount as columns have gone
+      int n = 0;
+      for (CoinBigIndex j = startRow[iRow]; j < startRow[iRow + 1]; j++) {
+        if (stepOfColumn[columnInRow[j]] < 0)
+          n++;
+      }
+      rowCount[iRow] = n;
+      if (n == 1)
+        stack[numberStack++] = iRow;
+    }
+  }
+  while (numberStack) {
+    int pivotRow = stack[--numberStack];
+    if (stepOfRow[pivotRow] >= 0 || rowCount[pivotRow] != 1)
+      continue;
+    int iColumn = -1;
+    double pivotValue = 0.0;
+    for (CoinBigIndex j = startRow[pivotRow]; j < startRow[pivotRow + 1]; j++) {
+      if (stepOfColumn[columnInRow[j]] < 0) {
+        iColumn = columnInRow[j];
+        pivotValue = elementInRow[j];
+        break;
+      }
+    }
+    assert(iColumn >= 0);
+    double largest = 0.0;
+    for (CoinBigIndex j = startColumn[iColumn]; j < startColumn[iColumn] + numberInColumn[iColumn]; j++) {
+      if (stepOfRow[indexRow[j]] < 0)
+        largest = CoinMax(largest, fabs(element[j]));
+    }
+    if (fabs(pivotValue) < pivotTolerance_ * largest)
+      continue; // leave to nucleus
+    double pivotInverse = 1.0 / pivotValue;
+    pivotRowStep_[numberSteps] = pivotRow;
+    pivotColumnStep_[numberSteps] = iColumn;
+    pivotInverse_[numberSteps] = pivotInverse;
+    stepOfRow[pivotRow] = numberSteps;
+    stepOfColumn[iColumn] = numberSteps;
+    CoinBigIndex put = startL_[numberSteps];
+    growFactor(indexL_, elementL_, maximumL, put, columnCount[iColumn]);
+    for (CoinBigIndex j = startColumn[iColumn]; j < startColumn[iColumn] + numberInColumn[iColumn]; j++) {
+      int iRow = indexRow[j];
+      if (stepOfRow[iRow] < 0 && fabs(element[j]) > tolerance) {
+        indexL_[put] = iRow;
+        elementL_[put++] = element[j] * pivotInverse;
+        rowCount[iRow]--;
+        if (rowCount[iRow] == 1)
+          stack[numberStack++] = iRow;
+      }
+    }
+    numberSteps++;
+    startL_[numberSteps] = put;
+  }
+  int firstNucleus = numberSteps;
+  // nucleus
+  int *rowOfLocal = stack; // stack finished with
+  int *columnOfLocal = stack + numberRows;
+  int numberLocalRows = 0;
+  int numberLocalColumns = 0;
+  int *localRow = rowCount; // counts finished with
+  for (int iRow = 0; iRow < numberRows; iRow++) {
+    if (stepOfRow[iRow] < 0) {
+      localRow[iRow] = numberLocalRows;
+      rowOfLocal[numberLocalRows++] = iRow;
+    } else {
+      localRow[iRow] = -1;
+    }
+  }
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    if (stepOfColumn[iColumn] < 0)
+      columnOfLocal[numberLocalColumns++] = iColumn;
+  }
+  numberInNucleus_ = numberLocalRows;
+  double *dense = NULL;
+  int *pivotLocal = NULL;
+  CoinBigIndex *startLocal = NULL;
+  int *indexLocal = NULL;
+  double *elementLocal = NULL;
+  if (numberLocalRows > maximumDense_) {
+    status_ = -98;
+  } else if (numberLocalRows && numberLocalColumns) {
+    size_t numberDense = static_cast< size_t >(numberLocalRows) * numberLocalColumns;
+    dense = new double[numberDense];
+    CoinZeroN(dense, numberDense);
+    for (int iLocal = 0; iLocal < numberLocalColumns; iLocal++) {
+      int iColumn = columnOfLocal[iLocal];
+      double *column = dense + static_cast< size_t >(iLocal) * numberLocalRows;
+      for (CoinBigIndex j = startColumn[iColumn]; j < startColumn[iColumn] + numberInColumn[iColumn]; j++) {
+        int iRow = localRow[indexRow[j]];
+        if (iRow >= 0 && fabs(element[j]) > tolerance)
+          column[iRow] += element[j];
+      }
+    }
+    pivotLocal = new int[numberLocalColumns];
+    startLocal = new CoinBigIndex[numberLocalColumns + 1];
+    CoinBigIndex maximumLocal = 4 * numberLocalRows + 100;
+    indexLocal = new int[maximumLocal];
+    elementLocal = new double[maximumLocal];
+    startLocal[0] = 0;
+    char *pivoted = new char[numberLocalRows];
+    memset(pivoted, 0, numberLocalRows);
+    int numberThreads = numberThreads_ ? numberThreads_ : clpParallelThreads();
+    clpNucleusInfo *info = new clpNucleusInfo[CoinMax(numberThreads, 1)];
+    for (int i = 0; i < CoinMax(numberThreads, 1); i++) {
+      info[i].dense = dense;
+      info[i].pivotLocal = pivotLocal;
+      info[i].numberRows = numberLocalRows;
+    }
+    for (int firstPanel = 0; firstPanel < numberLocalColumns; firstPanel += PARALLEL_PANEL) {
+      int lastPanel = CoinMin(firstPanel + PARALLEL_PANEL, numberLocalColumns);
+      for (int iLocal = firstPanel; iLocal < lastPanel; iLocal++) {
+        // bring column up to date with earlier columns of panel
+        info[0].start = startLocal;
+        info[0].index = indexLocal;
+        info[0].element = elementLocal;
+        info[0].firstStep = firstPanel;
+        info[0].lastStep = iLocal;
+        info[0].firstColumn = iLocal;
+        info[0].lastColumn = iLocal + 1;
+        nucleusBit(info[0]);
+        // partial pivoting
+        double *column = dense + static_cast< size_t >(iLocal) * numberLocalRows;
+        double largest = 0.0;
+        int iPivot = -1;
+        for (int iRow = 0; iRow < numberLocalRows; iRow++) {
+          if (!pivoted[iRow] && fabs(column[iRow]) > largest) {
+            largest = fabs(column[iRow]);
+            iPivot = iRow;
+          }
+        }
+        CoinBigIndex put = startLocal[iLocal];
+        if (largest > tolerance) {
+          pivoted[iPivot] = 1;
+          double pivotInverse = 1.0 / column[iPivot];
+          growFactor(indexLocal, elementLocal, maximumLocal, put, numberLocalRows);
+          for (int iRow = 0; iRow < numberLocalRows; iRow++) {
+            if (!pivoted[iRow] && fabs(column[iRow]) > tolerance) {
+              indexLocal[put] = iRow;
+              elementLocal[put++] = column[iRow] * pivotInverse;
+            }
+          }
+        } else {
+          // singular column
+          iPivot = -1;
+        }
+        pivotLocal[iLocal] = iPivot;
+        startLocal[iLocal + 1] = put;
+      }
+      // update columns to right of panel
+      int numberRight = numberLocalColumns - lastPanel;
+      if (numberRight) {
+        int numberTasks = CoinMax(1, CoinMin(numberThreads, numberRight / PARALLEL_MIN_COLUMNS));
+        for (int i = 0; i < numberTasks; i++) {
+          info[i].start = startLocal;
+          info[i].index = indexLocal;
+          info[i].element = elementLocal;
+          info[i].firstStep = firstPanel;
+          info[i].lastStep = lastPanel;
+          info[i].firstColumn = lastPanel + (i * numberRight) / numberTasks;
+          info[i].lastColumn = lastPanel + ((i + 1) * numberRight) / numberTasks;
+        }
+        if (numberTasks > 1)
+          clpParallelFor(nucleusBit, info, numberTasks);
+        else
+          nucleusBit(info[0]);
+      }
+    }
+    delete[] info;
+    delete[] pivoted;
+    // steps from nucleus
+    for (int iLocal = 0; iLocal < numberLocalColumns; iLocal++) {
+      int iPivot = pivotLocal[iLocal];
+      if (iPivot < 0)
+        continue;
+      int pivotRow = rowOfLocal[iPivot];
+      int iColumn = columnOfLocal[iLocal];
+      pivotRowStep_[numberSteps] = pivotRow;
+      pivotColumnStep_[numberSteps] = iColumn;
+      pivotInverse_[numberSteps] = 1.0 / dense[static_cast< size_t >(iLocal) * numberLocalRows + iPivot];
+      stepOfRow[pivotRow] = numberSteps;
+      stepOfColumn[iColumn] = numberSteps;
+      CoinBigIndex put = startL_[numberSteps];
+      CoinBigIndex n = startLocal[iLocal + 1] - startLocal[iLocal];
+      growFactor(indexL_, elementL_, maximumL, put, n);
+      for (CoinBigIndex j = startLocal[iLocal]; j < startLocal[iLocal + 1]; j++) {
+        indexL_[put] = rowOfLocal[indexLocal[j]];
+        elementL_[put++] = elementLocal[j];
+      }
+      numberSteps++;
+      startL_[numberSteps] = put;
+    }
+  }
+  numberGoodU_ = numberSteps;
+  if (status_ != -98) {
+    // U - rows pivoted earlier in each pivot column
+    CoinBigIndex maximumU = numberElements + 1;
+    if (dense)
+      maximumU += static_cast< CoinBigIndex >(numberLocalRows) * (numberLocalRows + 1) / 2;
+    indexU_ = new int[maximumU];
+    elementU_ = new double[maximumU];
+    CoinBigIndex put = 0;
+    startU_[0] = 0;
+    int iLocal = 0;
+    for (int iStep = 0; iStep < numberSteps; iStep++) {
+      int iColumn = pivotColumnStep_[iStep];
+      int lastPeel = CoinMin(iStep, firstNucleus);
+      for (CoinBigIndex j = startColumn[iColumn]; j < startColumn[iColumn] + numberInColumn[iColumn]; j++) {
+        int iRow = indexRow[j];
+        int kStep = stepOfRow[iRow];
+        if (kStep >= 0 && kStep < lastPeel && fabs(element[j]) > tolerance) {
+          growFactor(indexU_, elementU_, maximumU, put, 1);
+          indexU_[put] = iRow;
+          elementU_[put++] = element[j];
+        }
+      }
+      if (iStep >= firstNucleus) {
+        // find dense column (nucleus steps are in column order)
+        while (columnOfLocal[iLocal] != iColumn)
+          iLocal++;
+        const double *column = dense + static_cast< size_t >(iLocal) * numberLocalRows;
+        growFactor(indexU_, elementU_, maximumU, put, iStep - firstNucleus);
+        for (int kStep = firstNucleus; kStep < iStep; kStep++) {
+          int iRow = pivotRowStep_[kStep];
+          double value = column[localRow[iRow]];
+          if (fabs(value) > tolerance) {
+            indexU_[put] = iRow;
+            elementU_[put++] = value;
+          }
+        }
+      }
+      startU_[iStep + 1] = put;
+    }
+    if (numberSteps < numberRows)
+      status_ = -1;
+    // etas
+    maximumEtas_ = maximumPivots_;
+    startEta_ = new CoinBigIndex[maximumEtas_ + 1];
+    pivotEta_ = new int[maximumEtas_ + 1];
+    pivotValueEta_ = new double[maximumEtas_ + 1];
+    startEta_[0] = 0;
+    maximumEtaSpace_ = 4 * numberRows + 1000;
+    indexEta_ = new int[maximumEtaSpace_];
+    elementEta_ = new double[maximumEtaSpace_];
+  } else {
+    freeFactors();
+  }
+  delete[] dense;
+  delete[] pivotLocal;
+  delete[] startLocal;
+  delete[] indexLocal;
+  delete[] elementLocal;
+  delete[] stack;
+  delete[] stepOfColumn;
+  delete[] columnInRow;
+  delete[] elementInRow;
+  delete[] startRow;
+  delete[] rowCount;
+  delete[] columnCount;
+  return status_;
+}
+// Does post processing on valid factorization - putting variables on correct rows
+void ClpParallelFactorization::postProcess(const int *sequence, int *pivotVariable)
+{
+  for (int iStep = 0; iStep < numberGoodU_; iStep++)
+    pivotVariable[pivotRowStep_[iStep]] = sequence[pivotColumnStep_[iStep]];
+}
+// Makes a non-singular basis by replacing variables
+void ClpParallelFactorization::makeNonSingular(int *sequence, int numberColumns)
+{
+  // slacks of rows without pivots replace columns without pivots
+  char *rowUsed = new char[numberRows_];
+  char *columnUsed = new char[numberRows_];
+  memset(rowUsed, 0, numberRows_);
+  memset(columnUsed, 0, numberRows_);
+  for (int iStep = 0; iStep < numberGoodU_; iStep++) {
+    rowUsed[pivotRowStep_[iStep]] = 1;
+    columnUsed[pivotColumnStep_[iStep]] = 1;
+  }
+  int lastRow = 0;
+  for (int iColumn = 0; iColumn < numberRows_; iColumn++) {
+    if (columnUsed[iColumn])
+      continue;
+    while (rowUsed[lastRow])
+      lastRow++;
+    sequence[iColumn] = lastRow + numberColumns;
+    lastRow++;
+  }
+  delete[] rowUsed;
+  delete[] columnUsed;
+}
+// Makes sure there is room for one more eta of given length
+void ClpParallelFactorization::growEtas(CoinBigIndex numberNeeded)
+{
+  growFactor(indexEta_, elementEta_, maximumEtaSpace_,
+    startEta_[numberPivots_], numberNeeded);
+}
+/* Replaces one Column to basis,
+   returns 0=OK, 1=Probably OK, 2=singular, 3=no room
+   regionSparse is tableau column */
+int ClpParallelFactorization::replaceColumn(CoinIndexedVector *regionSparse,
+  int pivotRow,
+  double pivotCheck,
+  bool,
+  double)
+{
+  if (numberPivots_ >= maximumPivots_ || numberPivots_ >= maximumEtas_)
+    return 3;
+  double *region = regionSparse->denseVector();
+  int *regionIndex = regionSparse->getIndices();
+  int numberNonZero = regionSparse->getNumElements();
+  bool packed = regionSparse->packedMode();
+  double pivotValue = 0.0;
+  if (packed) {
+    for (int i = 0; i < numberNonZero; i++) {
+      if (regionIndex[i] == pivotRow) {
+        pivotValue = region[i];
+        break;
+      }
+    }
+  } else {
+    pivotValue = region[pivotRow];
+  }
+  if (fabs(pivotValue) < zeroTolerance_)
+    return 2;
+  growEtas(numberNonZero);
+  CoinBigIndex put = startEta_[numberPivots_];
+  for (int i = 0; i < numberNonZero; i++) {
+    int iRow = regionIndex[i];
+    double value = packed ? region[i] : region[iRow];
+    if (iRow != pivotRow && fabs(value) > zeroTolerance_) {
+      indexEta_[put] = iRow;
+      elementEta_[put++] = value;
+    }
+  }
+  pivotEta_[numberPivots_] = pivotRow;
+  pivotValueEta_[numberPivots_] = pivotValue;
+  numberPivots_++;
+  startEta_[numberPivots_] = put;
+  // check against value from row
+  if (pivotCheck && fabs(1.0 - pivotValue / pivotCheck) > 1.0e-7)
+    return 1;
+  return 0;
+}
+// Forward solve on dense region indexed by row - result by pivot row
+void ClpParallelFactorization::solve(double *region) const
+{
+  int numberSteps = numberGoodU_;
+  for (int iStep = 0; iStep < numberSteps; iStep++) {
+    double value = region[pivotRowStep_[iStep]];
+    if (value) {
+      for (CoinBigIndex j = startL_[iStep]; j < startL_[iStep + 1]; j++)
+        region[indexL_[j]] -= elementL_[j] * value;
+    }
+  }
+  for (int iStep = numberSteps - 1; iStep >= 0; iStep--) {
+    int iRow = pivotRowStep_[iStep];
+    double value = region[iRow];
+    if (value) {
+      value *= pivotInverse_[iStep];
+      region[iRow] = value;
+      for (CoinBigIndex j = startU_[iStep]; j < startU_[iStep + 1]; j++)
+        region[indexU_[j]] -= elementU_[j] * value;
+    }
+  }
+  for (int iPivot = 0; iPivot < numberPivots_; iPivot++) {
+    int iRow = pivotEta_[iPivot];
+    double value = region[iRow];
+    if (value) {
+      value /= pivotValueEta_[iPivot];
+      region[iRow] = value;
+      for (CoinBigIndex j = startEta_[iPivot]; j < startEta_[iPivot + 1]; j++)
+        region[indexEta_[j]] -= elementEta_[j] * value;
+    }
+  }
+}
+// Transpose solve on dense region indexed by pivot row - result by row
+void ClpParallelFactorization::solveTranspose(double *region) const
+{
+  int numberSteps = numberGoodU_;
+  for (int iPivot = numberPivots_ - 1; iPivot >= 0; iPivot--) {
+    int iRow = pivotEta_[iPivot];
+    double value = region[iRow];
+    for (CoinBigIndex j = startEta_[iPivot]; j < startEta_[iPivot + 1]; j++)
+      value -= elementEta_[j] * region[indexEta_[j]];
+    region[iRow] = value / pivotValueEta_[iPivot];
+  }
+  for (int iStep = 0; iStep < numberSteps; iStep++) {
+    int iRow = pivotRowStep_[iStep];
+    double value = region[iRow];
+    for (CoinBigIndex j = startU_[iStep]; j < startU_[iStep + 1]; j++)
+      value -= elementU_[j] * region[indexU_[j]];
+    region[iRow] = value * pivotInverse_[iStep];
+  }
+  for (int iStep = numberSteps - 1; iStep >= 0; iStep--) {
+    int iRow = pivotRowStep_[iStep];
+    double value = region[iRow];
+    for (CoinBigIndex j = startL_[iStep]; j < startL_[iStep + 1]; j++)
+      value -= elementL_[j] * region[indexL_[j]];
+    region[iRow] = value;
+  }
+}
+// Forward solve on numberRhs dense regions interleaved by row
+void ClpParallelFactorization::solveBlock(double *block, int numberRhs) const
+{
+  int numberSteps = numberGoodU_;
+  for (int iStep = 0; iStep < numberSteps; iStep++) {
+    const double *pivot = block + pivotRowStep_[iStep] * numberRhs;
+    bool nonZero = false;
+    for (int k = 0; k < numberRhs; k++) {
+      if (pivot[k])
+        nonZero = true;
+    }
+    if (!nonZero)
+      continue;
+    for (CoinBigIndex j = startL_[iStep]; j < startL_[iStep + 1]; j++) {
+      double *put = block + indexL_[j] * numberRhs;
+      double multiplier = elementL_[j];
+      for (int k = 0; k < numberRhs; k++)
+        put[k] -= multiplier * pivot[k];
+    }
+  }
+  for (int iStep = numberSteps - 1; iStep >= 0; iStep--) {
+    double *pivot = block + pivotRowStep_[iStep] * numberRhs;
+    double pivotInverse = pivotInverse_[iStep];
+    bool nonZero = false;
+    for (int k = 0; k < numberRhs; k++) {
+      if (pivot[k]) {
+        pivot[k] *= pivotInverse;
+        nonZero = true;
+      }
+    }
+    if (!nonZero)
+      continue;
+    for (CoinBigIndex j = startU_[iStep]; j < startU_[iStep + 1]; j++) {
+      double *put = block + indexU_[j] * numberRhs;
+      double multiplier = elementU_[j];
+      for (int k = 0; k < numberRhs; k++)
+        put[k] -= multiplier * pivot[k];
+    }
+  }
+  for (int iPivot = 0; iPivot < numberPivots_; iPivot++) {
+    double *pivot = block + pivotEta_[iPivot] * numberRhs;
+    double pivotValue = pivotValueEta_[iPivot];
+    bool nonZero = false;
+    for (int k = 0; k < numberRhs; k++) {
+      if (pivot[k]) {
+        pivot[k] /= pivotValue;
+        nonZero = true;
+      }
+    }
+    if (!nonZero)
+      continue;
+    for (CoinBigIndex j = startEta_[iPivot]; j < startEta_[iPivot + 1]; j++) {
+      double *put = block + indexEta_[j] * numberRhs;
+      double multiplier = elementEta_[j];
+      for (int k = 0; k < numberRhs; k++)
+        put[k] -= multiplier * pivot[k];
+    }
+  }
+}
+/* Rows reached from input in graph given by step - result in
+   topological order in list_ from returned position to numberRows_ */
+int ClpParallelFactorization::reach(const CoinBigIndex *start, const int *index,
+  const int *input, int numberInput) const
+{
+  if (markStamp_ == COIN_INT_MAX) {
+    CoinZeroN(mark_, numberRows_);
+    markStamp_ = 0;
+  }
+  int stamp = ++markStamp_;
+  // stack_ has row then position
+  int *stackRow = stack_;
+  CoinBigIndex *stackPosition = reinterpret_cast< CoinBigIndex * >(stack_ + numberRows_);
+  int put = numberRows_;
+  for (int i = 0; i < numberInput; i++) {
+    int iRow = input[i];
+    if (mark_[iRow] == stamp)
+      continue;
+    mark_[iRow] = stamp;
+    int nStack = 0;
+    stackRow[0] = iRow;
+    stackPosition[0] = start[stepOfRow_[iRow]];
+    while (nStack >= 0) {
+      int kRow = stackRow[nStack];
+      CoinBigIndex j = stackPosition[nStack];
+      CoinBigIndex end = start[stepOfRow_[kRow] + 1];
+      while (j < end && mark_[index[j]] == stamp)
+        j++;
+      if (j < end) {
+        int jRow = index[j];
+        stackPosition[nStack] = j + 1;
+        mark_[jRow] = stamp;
+        nStack++;
+        stackRow[nStack] = jRow;
+        stackPosition[nStack] = start[stepOfRow_[jRow]];
+      } else {
+        // all successors done
+        list_[--put] = kRow;
+        nStack--;
+      }
+    }
+  }
+  return put;
+}
+// Makes row copies of L and U (and work areas) if not there
+void ClpParallelFactorization::makeTransposes() const
+{
+  if (!mark_) {
+    mark_ = new int[numberRows_];
+    CoinZeroN(mark_, numberRows_);
+    markStamp_ = 0;
+    // room for row and CoinBigIndex position
+    stack_ = new int[numberRows_ * (1 + sizeof(CoinBigIndex) / sizeof(int))];
+    list_ = new int[numberRows_];
+  }
+  if (!startLT_) {
+    int numberSteps = numberGoodU_;
+    startLT_ = new CoinBigIndex[numberSteps + 1];
+    startUT_ = new CoinBigIndex[numberSteps + 1];
+    CoinZeroN(startLT_, numberSteps + 1);
+    CoinZeroN(startUT_, numberSteps + 1);
+    // count by step of row and make into ends
+    for (CoinBigIndex j = 0; j < startL_[numberSteps]; j++)
+      startLT_[stepOfRow_[indexL_[j]]]++;
+    for (CoinBigIndex j = 0; j < startU_[numberSteps]; j++)
+      startUT_[stepOfRow_[indexU_[j]]]++;
+    for (int iStep = 0; iStep < numberSteps; iStep++) {
+      startLT_[iStep + 1] += startLT_[iStep];
+      startUT_[iStep + 1] += startUT_[iStep];
+    }
+    startLT_[numberSteps] = startL_[numberSteps];
+    startUT_[numberSteps] = startU_[numberSteps];
+    indexLT_ = new int[startL_[numberSteps] + 1];
+    elementLT_ = new double[startL_[numberSteps] + 1];
+    indexUT_ = new int[startU_[numberSteps] + 1];
+    elementUT_ = new double[startU_[numberSteps] + 1];
+    // fill backwards so starts end up right
+    for (int iStep = numberSteps - 1; iStep >= 0; iStep--) {
+      int iRow = pivotRowStep_[iStep];
+      for (CoinBigIndex j = startL_[iStep]; j < startL_[iStep + 1]; j++) {
+        CoinBigIndex put = --startLT_[stepOfRow_[indexL_[j]]];
+        indexLT_[put] = iRow;
+        elementLT_[put] = elementL_[j];
+      }
+      for (CoinBigIndex j = startU_[iStep]; j < startU_[iStep + 1]; j++) {
+        CoinBigIndex put = --startUT_[stepOfRow_[indexU_[j]]];
+        indexUT_[put] = iRow;
+        elementUT_[put] = elementU_[j];
+      }
+    }
+  }
+}
+/* Hyper-sparse forward solve - index has rows with nonzeros on
+   input and output */
+void ClpParallelFactorization::solveSparse(double *region, int *index, int &number) const
+{
+  // L
+  int first = reach(startL_, indexL_, index, number);
+  for (int i = first; i < numberRows_; i++) {
+    int iRow = list_[i];
+    double value = region[iRow];
+    if (value) {
+      int iStep = stepOfRow_[iRow];
+      for (CoinBigIndex j = startL_[iStep]; j < startL_[iStep + 1]; j++)
+        region[indexL_[j]] -= elementL_[j] * value;
+    }
+  }
+  number = numberRows_ - first;
+  CoinMemcpyN(list_ + first, number, index);
+  // U
+  first = reach(startU_, indexU_, index, number);
+  for (int i = first; i < numberRows_; i++) {
+    int iRow = list_[i];
+    double value = region[iRow];
+    if (value) {
+      int iStep = stepOfRow_[iRow];
+      value *= pivotInverse_[iStep];
+      region[iRow] = value;
+      for (CoinBigIndex j = startU_[iStep]; j < startU_[iStep + 1]; j++)
+        region[indexU_[j]] -= elementU_[j] * value;
+    }
+  }
+  number = numberRows_ - first;
+  CoinMemcpyN(list_ + first, number, index);
+  // etas - rows in index are marked
+  int stamp = markStamp_;
+  for (int iPivot = 0; iPivot < numberPivots_; iPivot++) {
+    int iRow = pivotEta_[iPivot];
+    double value = region[iRow];
+    if (value) {
+      value /= pivotValueEta_[iPivot];
+      region[iRow] = value;
+      for (CoinBigIndex j = startEta_[iPivot]; j < startEta_[iPivot + 1]; j++) {
+        int jRow = indexEta_[j];
+        if (mark_[jRow] != stamp) {
+          mark_[jRow] = stamp;
+          index[number++] = jRow;
+        }
+        region[jRow] -= elementEta_[j] * value;
+      }
+    }
+  }
+}
+// Hyper-sparse transpose solve
+void ClpParallelFactorization::solveTransposeSparse(double *region, int *index, int &number) const
+{
+  // etas
+  if (numberPivots_) {
+    if (markStamp_ == COIN_INT_MAX) {
+      CoinZeroN(mark_, numberRows_);
+      markStamp_ = 0;
+    }
+    int stamp = ++markStamp_;
+    for (int i = 0; i < number; i++)
+      mark_[index[i]] = stamp;
+    for (int iPivot = numberPivots_ - 1; iPivot >= 0; iPivot--) {
+      int iRow = pivotEta_[iPivot];
+      double value = region[iRow];
+      for (CoinBigIndex j = startEta_[iPivot]; j < startEta_[iPivot + 1]; j++)
+        value -= elementEta_[j] * region[indexEta_[j]];
+      value /= pivotValueEta_[iPivot];
+      region[iRow] = value;
+      if (value && mark_[iRow] != stamp) {
+        mark_[iRow] = stamp;
+        index[number++] = iRow;
+      }
+    }
+  }
+  // U
+  int first = reach(startUT_, indexUT_, index, number);
+  for (int i = first; i < numberRows_; i++) {
+    int iRow = list_[i];
+    double value = region[iRow];
+    if (value) {
+      int iStep = stepOfRow_[iRow];
+      value *= pivotInverse_[iStep];
+      region[iRow] = value;
+      for (CoinBigIndex j = startUT_[iStep]; j < startUT_[iStep + 1]; j++)
+        region[indexUT_[j]] -= elementUT_[j] * value;
+    }
+  }
+  number = numberRows_ - first;
+  CoinMemcpyN(list_ + first, number, index);
+  // L
+  first = reach(startLT_, indexLT_, index, number);
+  for (int i = first; i < numberRows_; i++) {
+    int iRow = list_[i];
+    double value = region[iRow];
+    if (value) {
+      int iStep = stepOfRow_[iRow];
+      for (CoinBigIndex j = startLT_[iStep]; j < startLT_[iStep + 1]; j++)
+        region[indexLT_[j]] -= elementLT_[j] * value;
+    }
+  }
+  number = numberRows_ - first;
+  CoinMemcpyN(list_ + first, number, index);
+}
+// Common code for FTRAN (transpose false) and BTRAN
+int ClpParallelFactorization::update(CoinIndexedVector *regionSparse,
+  CoinIndexedVector *regionSparse2, bool transpose) const
+{
+  double *region2 = regionSparse2->denseVector();
+  int *regionIndex = regionSparse2->getIndices();
+  int numberNonZero = regionSparse2->getNumElements();
+  bool packed = regionSparse2->packedMode();
+  double *region = region2;
+  if (packed) {
+    region = regionSparse->denseVector();
+    for (int i = 0; i < numberNonZero; i++) {
+      region[regionIndex[i]] = region2[i];
+      region2[i] = 0.0;
+    }
+  }
+  double tolerance = zeroTolerance_;
+  if (numberGoodU_ == numberRows_ && numberNonZero * hyperSparseRatio_ < numberRows_) {
+    // work depends on size of result
+    makeTransposes();
+    if (transpose)
+      solveTransposeSparse(region, regionIndex, numberNonZero);
+    else
+      solveSparse(region, regionIndex, numberNonZero);
+    numberHyperSparse_[transpose ? 1 : 0]++;
+    int number = numberNonZero;
+    numberNonZero = 0;
+    for (int i = 0; i < number; i++) {
+      int iRow = regionIndex[i];
+      double value = region[iRow];
+      if (packed)
+        region[iRow] = 0.0;
+      if (fabs(value) > tolerance) {
+        if (packed)
+          region2[numberNonZero] = value;
+        regionIndex[numberNonZero++] = iRow;
+      } else {
+        region[iRow] = 0.0;
+      }
+    }
+    regionSparse2->setNumElements(numberNonZero);
+    if (!numberNonZero)
+      regionSparse2->setPackedMode(false);
+    return numberNonZero;
+  }
+  if (transpose)
+    solveTranspose(region);
+  else
+    solve(region);
+  numberNonZero = 0;
+  if (packed) {
+    for (int iRow = 0; iRow < numberRows_; iRow++) {
+      double value = region[iRow];
+      if (value) {
+        region[iRow] = 0.0;
+        if (fabs(value) > tolerance) {
+          region2[numberNonZero] = value;
+          regionIndex[numberNonZero++] = iRow;
+        }
+      }
+    }
+  } else {
+    for (int iRow = 0; iRow < numberRows_; iRow++) {
+      double value = region[iRow];
+      if (value) {
+        if (fabs(value) > tolerance)
+          regionIndex[numberNonZero++] = iRow;
+        else
+          region[iRow] = 0.0;
+      }
+    }
+  }
+  regionSparse2->setNumElements(numberNonZero);
+  if (!numberNonZero)
+    regionSparse2->setPackedMode(false);
+  return numberNonZero;
+}
+/* Updates one column (FTRAN) from regionSparse2
+   regionSparse starts as zero and is zero at end */
+int ClpParallelFactorization::updateColumnFT(CoinIndexedVector *regionSparse,
+  CoinIndexedVector *regionSparse2,
+  bool)
+{
+  return update(regionSparse, regionSparse2, false);
+}
+/* This version has same effect as above with FTUpdate==false
+   so number returned is always >=0 */
+int ClpParallelFactorization::updateColumn(CoinIndexedVector *regionSparse,
+  CoinIndexedVector *regionSparse2,
+  bool) const
+{
+  return update(regionSparse, regionSparse2, false);
+}
+// does FTRAN on two columns
+int ClpParallelFactorization::updateTwoColumnsFT(CoinIndexedVector *regionSparse1,
+  CoinIndexedVector *regionSparse2,
+  CoinIndexedVector *regionSparse3,
+  bool)
+{
+  int returnCode = update(regionSparse1, regionSparse2, false);
+  update(regionSparse1, regionSparse3, false);
+  return returnCode;
+}
+/* Updates one column (BTRAN) from regionSparse2
+   regionSparse starts as zero and is zero at end */
+int ClpParallelFactorization::updateColumnTranspose(CoinIndexedVector *regionSparse,
+  CoinIndexedVector *regionSparse2) const
+{
+  return update(regionSparse, regionSparse2, true);
+}
+/* Updates numberRhs columns (FTRAN) returning total number of
+   elements.  Hyper-sparse ones are done one by one, the others a
+   block at a time with regions interleaved by row so factors are
+   gone through once for each block.
+   regionSparse starts as zero and is zero at end */
+int ClpParallelFactorization::updateColumns(CoinIndexedVector *regionSparse,
+  int numberRhs, CoinIndexedVector **regionSparse2) const
+{
+  int numberRows = numberRows_;
+  int total = 0;
+  int *dense = new int[numberRhs];
+  int numberDense = 0;
+  for (int iRhs = 0; iRhs < numberRhs; iRhs++) {
+    int number = regionSparse2[iRhs]->getNumElements();
+    if (numberRhs == 1 || (numberGoodU_ == numberRows && number * hyperSparseRatio_ < numberRows))
+      total += update(regionSparse, regionSparse2[iRhs], false);
+    else
+      dense[numberDense++] = iRhs;
+  }
+  if (numberDense) {
+    double tolerance = zeroTolerance_;
+    int blockSize = CoinMin(numberDense, PARALLEL_RHS_BLOCK);
+    double *block = new double[numberRows * blockSize];
+    CoinZeroN(block, numberRows * blockSize);
+    for (int first = 0; first < numberDense; first += blockSize) {
+      int n = CoinMin(blockSize, numberDense - first);
+      for (int k = 0; k < n; k++) {
+        CoinIndexedVector *vector = regionSparse2[dense[first + k]];
+        double *array = vector->denseVector();
+        const int *index = vector->getIndices();
+        int number = vector->getNumElements();
+        if (vector->packedMode()) {
+          for (int i = 0; i < number; i++) {
+            block[index[i] * n + k] = array[i];
+            array[i] = 0.0;
+          }
+        } else {
+          for (int i = 0; i < number; i++) {
+            int iRow = index[i];
+            block[iRow * n + k] = array[iRow];
+            array[iRow] = 0.0;
+          }
+        }
+      }
+      solveBlock(block, n);
+      for (int k = 0; k < n; k++) {
+        CoinIndexedVector *vector = regionSparse2[dense[first + k]];
+        double *array = vector->denseVector();
+        int *index = vector->getIndices();
+        bool packed = vector->packedMode();
+        int numberNonZero = 0;
+        for (int iRow = 0; iRow < numberRows; iRow++) {
+          double value = block[iRow * n + k];
+          if (value) {
+            block[iRow * n + k] = 0.0;
+            if (fabs(value) > tolerance) {
+              if (packed)
+                array[numberNonZero] = value;
+              else
+                array[iRow] = value;
+              index[numberNonZero++] = iRow;
+            }
+          }
+        }
+        vector->setNumElements(numberNonZero);
+        if (!numberNonZero)
+          vector->setPackedMode(false);
+        total += numberNonZero;
+      }
+    }
+    delete[] block;
+  }
+  delete[] dense;
+  return total;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,292 @@
+/* $Id$ */
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef ClpParallelFactorization_H
+#define ClpParallelFactorization_H
+
+#include "CoinPragma.hpp"
+#include "CoinOtherFactorization.hpp"
+#include "ClpConfig.h"
+
+class CoinIndexedVector;
+
+/** LU factorization for ClpFactorization using several threads.
+
+    Triangular parts of basis are found serially - column singletons
+    (which include slacks) then row singletons which pass the pivot
+    tolerance.  What is left (the nucleus) is factorized as a dense
+    matrix with partial pivoting.  Pivots are found a panel of columns
+    at a time and the Schur complement update for the columns to the
+    right of the panel is done in parallel (by columns so result does
+    not depend on number of threads).
+
+    Updates are product form (so tableau column is wanted).
+    Very sparse right hand sides are done by finding the rows they
+    reach (depth first search as Gilbert and Peierls) so work depends
+    on size of result not number of rows.  Row copies of L and U for
+    the transpose solves are made on first use and kept until next
+    factorization, and visited marks use a counter so they are never
+    cleared.  These hyper-sparse solves are only in this class so they
+    are only used after forceOtherFactorization(5) - the default
+    CoinFactorization does not have them.
+    If nucleus is bigger than maximumDense() factor sets status -98
+    and ClpFactorization does that factorization with CoinFactorization,
+    trying this class again at the next factorization.
+
+    Limits - this is not a general sparse LU.  There is no Markowitz
+    (sparse) nucleus so fill in the nucleus is not controlled - nucleus
+    is stored dense, which costs n*n doubles and n*n*n/3 flops for a
+    nucleus of n (default limit 5000 is 200MB).  So it only pays when
+    bases are mostly triangular with a small dense kernel; otherwise
+    CoinFactorization is used each time.  Updates are product form
+    etas, not Forrest-Tomlin, so solves slow down more quickly as
+    updates build up than with CoinFactorization.
+
+    Selected by ClpFactorization::forceOtherFactorization(5).
+*/
+
+class CLPLIB_EXPORT ClpParallelFactorization : public CoinOtherFactorization {
+
+public:
+  /**@name Constructors, destructor */
+  //@{
+  /** Default constructor. */
+  ClpParallelFactorization();
+  /** Copy constructor. */
+  ClpParallelFactorization(const ClpParallelFactorization &rhs);
+  /** Destructor */
+  virtual ~ClpParallelFactorization();
+  /** Assignment operator */
+  ClpParallelFactorization &operator=(const ClpParallelFactorization &rhs);
+  /// Clone
+  virtual CoinOtherFactorization *clone() const;
+  //@}
+
+  /**@name Do factorization - public */
+  //@{
+  /// Gets space for a factorization
+  virtual void getAreas(int numberRows,
+    int numberColumns,
+    CoinBigIndex maximumL,
+    CoinBigIndex maximumU);
+  /// PreProcesses column ordered copy of basis
+  virtual void preProcess();
+  /** Does most of factorization returning status
+         0 - OK
+         -99 - needs more memory
+         -98 - nucleus too big for dense code
+         -1 - singular - use numberGoodColumns and redo
+     */
+  virtual int factor();
+  /// Does post processing on valid factorization - putting variables on correct rows
+  virtual void postProcess(const int *sequence, int *pivotVariable);
+  /// Makes a non-singular basis by replacing variables
+  virtual void makeNonSingular(int *sequence, int numberColumns);
+  //@}
+
+  /**@name general stuff such as status */
+  //@{
+  /// Total number of elements in factorization
+  virtual inline int numberElements() const
+  {
+    return static_cast< int >(startL_ ? startL_[numberGoodU_] + startU_[numberGoodU_] + startEta_[numberPivots_] : 0);
+  }
+  /// Returns array to put basis indices in
+  virtual inline int *indices() const
+  {
+    return indices_;
+  }
+  /// Returns permute in (none as results are in pivot row order)
+  virtual inline int *permute() const
+  {
+    return NULL;
+  }
+  /// Product form so wants tableau column
+  virtual inline bool wantsTableauColumn() const
+  {
+    return true;
+  }
+  /// Get rid of all memory
+  virtual void clearArrays();
+  /// Largest nucleus done with dense code
+  inline int maximumDense() const
+  {
+    return maximumDense_;
+  }
+  /// Set largest nucleus done with dense code
+  inline void setMaximumDense(int value)
+  {
+    maximumDense_ = value;
+  }
+  /// Number of threads (0 means use clpParallelThreads())
+  inline int numberThreads() const
+  {
+    return numberThreads_;
+  }
+  /// Set number of threads (0 means use clpParallelThreads())
+  inline void setNumberThreads(int value)
+  {
+    numberThreads_ = value;
+  }
+  /// Size of nucleus at last factorization
+  inline int numberInNucleus() const
+  {
+    return numberInNucleus_;
+  }
+  /// Hyper-sparse solves are used if number in input * this < number rows
+  inline int hyperSparseRatio() const
+  {
+    return hyperSparseRatio_;
+  }
+  /// Set ratio for hyper-sparse solves (0 switches off)
+  inline void setHyperSparseRatio(int value)
+  {
+    hyperSparseRatio_ = value;
+  }
+  /// Number of FTRANs (0) and BTRANs (1) done hyper-sparse
+  inline int numberHyperSparse(int which) const
+  {
+    return numberHyperSparse_[which];
+  }
+  //@}
+
+  /**@name rank one updates which do exist */
+  //@{
+  /** Replaces one Column to basis,
+      returns 0=OK, 1=Probably OK, 2=singular, 3=no room
+      regionSparse is tableau column */
+  virtual int replaceColumn(CoinIndexedVector *regionSparse,
+    int pivotRow,
+    double pivotCheck,
+    bool checkBeforeModifying = false,
+    double acceptablePivot = 1.0e-8);
+  //@}
+
+  /**@name various uses of factorization (return code number elements)
+      Results are in pivot row order.  noPermute is ignored as there
+      is no permutation */
+  //@{
+  /** Updates one column (FTRAN) from regionSparse2
+      regionSparse starts as zero and is zero at end */
+  virtual int updateColumnFT(CoinIndexedVector *regionSparse,
+    CoinIndexedVector *regionSparse2,
+    bool noPermute = false);
+  /** This version has same effect as above with FTUpdate==false
+      so number returned is always >=0 */
+  virtual int updateColumn(CoinIndexedVector *regionSparse,
+    CoinIndexedVector *regionSparse2,
+    bool noPermute = false) const;
+  /// does FTRAN on two columns
+  virtual int updateTwoColumnsFT(CoinIndexedVector *regionSparse1,
+    CoinIndexedVector *regionSparse2,
+    CoinIndexedVector *regionSparse3,
+    bool noPermute = false);
+  /** Updates one column (BTRAN) from regionSparse2
+      regionSparse starts as zero and is zero at end */
+  virtual int updateColumnTranspose(CoinIndexedVector *regionSparse,
+    CoinIndexedVector *regionSparse2) const;
+  /** Updates numberRhs columns (FTRAN) returning total number of
+      elements.  Hyper-sparse ones are done one by one, the others a
+      block at a time with regions interleaved by row so factors are
+      gone through once for each block.
+      regionSparse starts as zero and is zero at end */
+  int updateColumns(CoinIndexedVector *regionSparse, int numberRhs,
+    CoinIndexedVector **regionSparse2) const;
+  //@}
+
+private:
+  /**@name private functions */
+  //@{
+  /// Frees everything
+  void gutsOfDestructor();
+  /// Copies everything except input areas
+  void gutsOfCopy(const ClpParallelFactorization &rhs);
+  /// Frees factors
+  void freeFactors();
+  /// Makes sure there is room for one more eta of given length
+  void growEtas(CoinBigIndex numberNeeded);
+  /// Forward solve on dense region indexed by row - result by pivot row
+  void solve(double *region) const;
+  /// Transpose solve on dense region indexed by pivot row - result by row
+  void solveTranspose(double *region) const;
+  /// Forward solve on numberRhs dense regions interleaved by row
+  void solveBlock(double *block, int numberRhs) const;
+  /// Common code for FTRAN (transpose false) and BTRAN
+  int update(CoinIndexedVector *regionSparse,
+    CoinIndexedVector *regionSparse2, bool transpose) const;
+  /** Rows reached from input in graph given by step - result in
+      topological order in list_ from returned position to numberRows_ */
+  int reach(const CoinBigIndex *start, const int *index,
+    const int *input, int numberInput) const;
+  /// Makes row copies of L and U (and work areas) if not there
+  void makeTransposes() const;
+  /** Hyper-sparse forward solve - index has rows with nonzeros on
+      input and output */
+  void solveSparse(double *region, int *index, int &number) const;
+  /// Hyper-sparse transpose solve
+  void solveTransposeSparse(double *region, int *index, int &number) const;
+  //@}
+
+  /**@name data */
+  //@{
+  /// Row indices of basis (elements, starts and counts are in base class)
+  int *indices_;
+  /// Row and column pivoted at each step
+  int *pivotRowStep_;
+  int *pivotColumnStep_;
+  /// Inverse of pivot at each step
+  double *pivotInverse_;
+  /// L by step - multipliers of pivot row
+  CoinBigIndex *startL_;
+  int *indexL_;
+  double *elementL_;
+  /// U by step - rows pivoted earlier in pivot column
+  CoinBigIndex *startU_;
+  int *indexU_;
+  double *elementU_;
+  /// Step at which each row was pivoted
+  int *stepOfRow_;
+  /// Row copies by step of L and U for transpose solves
+  mutable CoinBigIndex *startLT_;
+  mutable int *indexLT_;
+  mutable double *elementLT_;
+  mutable CoinBigIndex *startUT_;
+  mutable int *indexUT_;
+  mutable double *elementUT_;
+  /// Work areas for hyper-sparse solves (mark_ uses markStamp_)
+  mutable int *mark_;
+  mutable int *stack_;
+  mutable int *list_;
+  mutable int markStamp_;
+  /// Product form etas
+  CoinBigIndex *startEta_;
+  int *pivotEta_;
+  double *pivotValueEta_;
+  int *indexEta_;
+  double *elementEta_;
+  /// Space in input areas
+  int maximumRowsSpace_;
+  CoinBigIndex maximumElementSpace_;
+  /// Space for eta elements
+  CoinBigIndex maximumEtaSpace_;
+  /// Number of etas allowed for
+  int maximumEtas_;
+  /// Largest nucleus done with dense code
+  int maximumDense_;
+  /// Size of nucleus at last factorization
+  int numberInNucleus_;
+  /// Number of threads (0 means use clpParallelThreads())
+  int numberThreads_;
+  /// Hyper-sparse solves are used if number in input * this < number rows
+  int hyperSparseRatio_;
+  /// Number of FTRANs (0) and BTRANs (1) done hyper-sparse
+  mutable int numberHyperSparse_[2];
+  //@}
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -17,6 +17,7 @@ Method
 #include "CoinDenseVector.hpp"
 #include "ClpPdco.hpp"
 #include "ClpPdcoBase.hpp"
+#include "ClpPdcoMatrix.hpp"
 #include "CoinHelperFunctions.hpp"
 #include "ClpHelperFunctions.hpp"
 #include "ClpLsqr.hpp"
@@ -202,6 +203,10 @@ int ClpPdco::pdco(ClpPdcoBase *stuff, Options &options, Info &info, Outfo &outfo
 
   // Save stuff so available elsewhere
   pdcoStuff_ = stuff;
+  // matrix may have changed since last solve - so no old row copy or factors
+  ClpPdcoMatrix *pdcoMatrix = dynamic_cast< ClpPdcoMatrix * >(stuff);
+  if (pdcoMatrix)
+    pdcoMatrix->clearCopies();
 
   double normb = b.infNorm();
   double normx0 = x.infNorm();
@@ -598,7 +603,7 @@ int ClpPdco::pdco(ClpPdcoBase *stuff, Options &options, Info &info, Outfo &outfo
           rhs[n + k] = r1_elts[k] * (1.0 / d2);
         double damp = 0;
 
-        if (precon) { // Construct diagonal preconditioner for LSQR
+        if (precon) { // Construct preconditioner for LSQR
           matPrecon(d2, Pr, D);
         }
         /*
@@ -627,7 +632,7 @@ int ClpPdco::pdco(ClpPdcoBase *stuff, Options &options, Info &info, Outfo &outfo
         thisLsqr.do_lsqr(rhs, damp, atol, btol, conlim, itnlim,
           show, info, dy, &istop, &itncg, &outfo, precon, Pr);
         if (precon)
-          dy = dy * Pr;
+          matPreconApply(1, dy, Pr);
 
         if (!precon && itncg > 999999)
           precon = true;
@@ -980,6 +985,10 @@ void ClpPdco::matPrecon(double delta, CoinDenseVector< double > *x, CoinDenseVec
   matPrecon(delta, x_elts, y_elts);
   return;
 }
+void ClpPdco::matPreconApply(int mode, CoinDenseVector< double > &x, CoinDenseVector< double > &Pr)
+{
+  pdcoStuff_->matPreconApply(this, mode, x.getElements(), Pr.getElements());
+}
 void ClpPdco::getBoundTypes(int *nlow, int *nupp, int *nfix, int **bptrs)
 {
   *nlow = numberColumns_;
@@ -65,6 +65,8 @@ public:
   void matPrecon(double, CoinDenseVector< double > &, CoinDenseVector< double > &);
 
   void matPrecon(double, CoinDenseVector< double > *, CoinDenseVector< double > *);
+  /// Applies preconditioner in Pr to x (mode 1 inverse(R), 2 inverse(R'))
+  void matPreconApply(int mode, CoinDenseVector< double > &x, CoinDenseVector< double > &Pr);
   //@}
 };
 #endif
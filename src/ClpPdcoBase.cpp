@@ -54,6 +54,13 @@ ClpPdcoBase::operator=(const ClpPdcoBase &rhs)
   }
   return *this;
 }
+// Applies (diagonal) preconditioner
+void ClpPdcoBase::matPreconApply(ClpInterior *model, int /*mode*/, double *x, const double *pr) const
+{
+  int nrow = model->numberRows();
+  for (int k = 0; k < nrow; k++)
+    x[k] *= pr[k];
+}
 
 /* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
 */
@@ -38,6 +38,13 @@ public:
 
   virtual void matPrecon(ClpInterior *model, double delta, double *x, double *y) const = 0;
 
+  //@}
+  /**@name Virtual methods with defaults */
+  //@{
+  /** Applies preconditioner computed by matPrecon (pr) to x in place.
+      mode 1 is x = inverse(R)*x, mode 2 is x = inverse(R')*x where R is
+      right preconditioner for LSQR.  Default is diagonal so both are x = pr.*x */
+  virtual void matPreconApply(ClpInterior *model, int mode, double *x, const double *pr) const;
   //@}
   //@{
   ///@name Other
@@ -0,0 +1,392 @@
+/* $Id$ */
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CoinPragma.hpp"
+
+#include <math.h>
+
+#include "CoinHelperFunctions.hpp"
+#include "ClpHelperFunctions.hpp"
+#include "ClpPdcoMatrix.hpp"
+#include "ClpPackedMatrix.hpp"
+#include "ClpInterior.hpp"
+
+// Rows or columns per task before splitting is worthwhile
+#define PDCO_CHUNK 2048
+// Largest block for block Jacobi
+#define PDCO_MAX_BLOCK 256
+
+//#############################################################################
+// Constructors / Destructor / Assignment
+//#############################################################################
+
+//-------------------------------------------------------------------
+// Default Constructor
+//-------------------------------------------------------------------
+ClpPdcoMatrix::ClpPdcoMatrix(double d1, double d2, int blockSize)
+  : ClpPdcoBase()
+  , rowCopy_(NULL)
+  , blockFactor_(NULL)
+  , numberRows_(0)
+  , blockSize_(1)
+  , numberThreads_(0)
+{
+  d1_ = d1;
+  d2_ = d2;
+  type_ = 1;
+  setBlockSize(blockSize);
+}
+
+//-------------------------------------------------------------------
+// Copy constructor
+//-------------------------------------------------------------------
+ClpPdcoMatrix::ClpPdcoMatrix(const ClpPdcoMatrix &rhs)
+  : ClpPdcoBase(rhs)
+  , rowCopy_(NULL)
+  , blockFactor_(NULL)
+  , numberRows_(0)
+  , blockSize_(rhs.blockSize_)
+  , numberThreads_(rhs.numberThreads_)
+{
+}
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+ClpPdcoMatrix::~ClpPdcoMatrix()
+{
+  clearCopies();
+}
+
+//----------------------------------------------------------------
+// Assignment operator
+//-------------------------------------------------------------------
+ClpPdcoMatrix &
+ClpPdcoMatrix::operator=(const ClpPdcoMatrix &rhs)
+{
+  if (this != &rhs) {
+    ClpPdcoBase::operator=(rhs);
+    clearCopies();
+    blockSize_ = rhs.blockSize_;
+    numberThreads_ = rhs.numberThreads_;
+  }
+  return *this;
+}
+//-------------------------------------------------------------------
+// Clone
+//-------------------------------------------------------------------
+ClpPdcoBase *ClpPdcoMatrix::clone() const
+{
+  return new ClpPdcoMatrix(*this);
+}
+// Set block size for block Jacobi preconditioner
+void ClpPdcoMatrix::setBlockSize(int value)
+{
+  value = CoinMax(1, CoinMin(PDCO_MAX_BLOCK, value));
+  if (value != blockSize_) {
+    delete[] blockFactor_;
+    blockFactor_ = NULL;
+    numberRows_ = 0;
+    blockSize_ = value;
+  }
+}
+// Throws away row copy and factors
+void ClpPdcoMatrix::clearCopies()
+{
+  delete rowCopy_;
+  rowCopy_ = NULL;
+  delete[] blockFactor_;
+  blockFactor_ = NULL;
+  numberRows_ = 0;
+}
+// Number of tasks to use for count items
+int ClpPdcoMatrix::numberTasks(int count) const
+{
+  int numberThreads = numberThreads_ ? numberThreads_ : clpParallelThreads();
+  return CoinMax(1, CoinMin(numberThreads, count / PDCO_CHUNK));
+}
+// Makes row copy if needed (thrown away at start of each pdco)
+const CoinPackedMatrix *ClpPdcoMatrix::rowCopy(ClpInterior *model) const
+{
+  ClpPackedMatrix *clpMatrix = dynamic_cast< ClpPackedMatrix * >(model->clpMatrix());
+  if (!clpMatrix)
+    return NULL;
+  if (rowCopy_ && (rowCopy_->getMajorDim() != model->numberRows() || rowCopy_->getMinorDim() != model->numberColumns())) {
+    delete rowCopy_;
+    rowCopy_ = NULL;
+  }
+  if (!rowCopy_) {
+    rowCopy_ = new CoinPackedMatrix();
+    rowCopy_->setExtraGap(0.0);
+    rowCopy_->setExtraMajor(0.0);
+    rowCopy_->reverseOrderedCopyOf(*clpMatrix->matrix());
+  }
+  return rowCopy_;
+}
+// Used by matVecMult
+typedef struct {
+  const CoinBigIndex *start;
+  const int *length;
+  const int *index;
+  const double *element;
+  const double *y;
+  double *x;
+  int first;
+  int last;
+} clpPdcoTimesInfo;
+// x[i] += sum over vector i of element*y[index]
+static void pdcoTimesBit(clpPdcoTimesInfo &info)
+{
+  const CoinBigIndex *start = info.start;
+  const int *length = info.length;
+  const int *index = info.index;
+  const double *element = info.element;
+  const double *y = info.y;
+  double *x = info.x;
+  for (int i = info.first; i < info.last; i++) {
+    double value = 0.0;
+    for (CoinBigIndex j = start[i]; j < start[i] + length[i]; j++)
+      value += element[j] * y[index[j]];
+    x[i] += value;
+  }
+}
+// mode 1 x += A*y, mode 2 x += A'*y
+void ClpPdcoMatrix::matVecMult(ClpInterior *model, int mode, double *x, double *y) const
+{
+  const CoinPackedMatrix *matrix = NULL;
+  if (mode == 1)
+    matrix = rowCopy(model);
+  else if (dynamic_cast< ClpPackedMatrix * >(model->clpMatrix()))
+    matrix = model->matrix();
+  if (!matrix) {
+    // use as operator
+    if (mode == 1)
+      model->clpMatrix()->times(1.0, y, x);
+    else
+      model->clpMatrix()->transposeTimes(1.0, y, x);
+    return;
+  }
+  int numberMajor = matrix->getMajorDim();
+  int nTasks = numberTasks(numberMajor);
+  clpPdcoTimesInfo *info = new clpPdcoTimesInfo[nTasks];
+  for (int i = 0; i < nTasks; i++) {
+    info[i].start = matrix->getVectorStarts();
+    info[i].length = matrix->getVectorLengths();
+    info[i].index = matrix->getIndices();
+    info[i].element = matrix->getElements();
+    info[i].y = y;
+    info[i].x = x;
+    info[i].first = static_cast< int >((static_cast< double >(numberMajor) * i) / nTasks);
+    info[i].last = static_cast< int >((static_cast< double >(numberMajor) * (i + 1)) / nTasks);
+  }
+  if (nTasks > 1)
+    clpParallelFor(pdcoTimesBit, info, nTasks);
+  else
+    pdcoTimesBit(info[0]);
+  delete[] info;
+}
+// Gradient of c'x is c
+void ClpPdcoMatrix::getGrad(ClpInterior *model, CoinDenseVector< double > &x, CoinDenseVector< double > &grad) const
+{
+  int ncol = model->numberColumns();
+  const double *cost = model->objective();
+  double *g_elts = grad.getElements();
+  for (int k = 0; k < ncol; k++)
+    g_elts[k] = cost[k];
+}
+// Hessian of c'x is zero
+void ClpPdcoMatrix::getHessian(ClpInterior *model, CoinDenseVector< double > &x, CoinDenseVector< double > &H) const
+{
+  int ncol = model->numberColumns();
+  double *h_elts = H.getElements();
+  for (int k = 0; k < ncol; k++)
+    h_elts[k] = 0.0;
+}
+double ClpPdcoMatrix::getObj(ClpInterior *model, CoinDenseVector< double > &x) const
+{
+  int ncol = model->numberColumns();
+  const double *cost = model->objective();
+  double *x_elts = x.getElements();
+  double obj = 0.0;
+  for (int k = 0; k < ncol; k++)
+    obj += cost[k] * x_elts[k];
+  return obj;
+}
+// Used by matPrecon
+typedef struct {
+  const CoinPackedMatrix *rowCopy;
+  const CoinPackedMatrix *columnCopy;
+  const double *d;
+  double *factor;
+  double *diagonal;
+  double delta2;
+  int numberRows;
+  int blockSize;
+  int first;
+  int last;
+} clpPdcoBlockInfo;
+/* Forms blocks of A*D*D*A' + delta2*I for blocks first..last-1
+   and factorizes them.  Puts original diagonal in diagonal */
+static void pdcoBlockBit(clpPdcoBlockInfo &info)
+{
+  const CoinBigIndex *rowStart = info.rowCopy->getVectorStarts();
+  const int *rowLength = info.rowCopy->getVectorLengths();
+  const int *column = info.rowCopy->getIndices();
+  const double *rowElement = info.rowCopy->getElements();
+  const CoinBigIndex *columnStart = info.columnCopy->getVectorStarts();
+  const int *columnLength = info.columnCopy->getVectorLengths();
+  const int *row = info.columnCopy->getIndices();
+  const double *element = info.columnCopy->getElements();
+  const double *d = info.d;
+  int blockSize = info.blockSize;
+  for (int iBlock = info.first; iBlock < info.last; iBlock++) {
+    int firstRow = iBlock * blockSize;
+    int lastRow = CoinMin(info.numberRows, firstRow + blockSize);
+    int n = lastRow - firstRow;
+    double *block = info.factor + firstRow * blockSize;
+    CoinZeroN(block, blockSize * blockSize);
+    // lower triangle (column major)
+    for (int iRow = firstRow; iRow < lastRow; iRow++) {
+      int i = iRow - firstRow;
+      for (CoinBigIndex j = rowStart[iRow]; j < rowStart[iRow] + rowLength[iRow]; j++) {
+        int iColumn = column[j];
+        double value = rowElement[j] * d[iColumn] * d[iColumn];
+        for (CoinBigIndex k = columnStart[iColumn]; k < columnStart[iColumn] + columnLength[iColumn]; k++) {
+          int kRow = row[k];
+          if (kRow >= iRow && kRow < lastRow)
+            block[i * blockSize + kRow - firstRow] += value * element[k];
+        }
+      }
+      block[i * blockSize + i] += info.delta2;
+      info.diagonal[iRow] = block[i * blockSize + i];
+    }
+    // Cholesky - if it fails just use diagonal
+    bool ok = true;
+    for (int i = 0; i < n && ok; i++) {
+      double *columnI = block + i * blockSize;
+      for (int k = 0; k < i; k++) {
+        double *columnK = block + k * blockSize;
+        double multiplier = columnK[i];
+        if (multiplier) {
+          for (int j = i; j < n; j++)
+            columnI[j] -= multiplier * columnK[j];
+        }
+      }
+      double pivot = columnI[i];
+      if (pivot <= 1.0e-12 * info.diagonal[firstRow + i]) {
+        ok = false;
+      } else {
+        pivot = sqrt(pivot);
+        columnI[i] = pivot;
+        pivot = 1.0 / pivot;
+        for (int j = i + 1; j < n; j++)
+          columnI[j] *= pivot;
+      }
+    }
+    if (!ok) {
+      CoinZeroN(block, blockSize * blockSize);
+      for (int i = 0; i < n; i++)
+        block[i * blockSize + i] = sqrt(info.diagonal[firstRow + i]);
+    }
+  }
+}
+// Preconditioner for A*D*D*A' + delta*delta*I
+void ClpPdcoMatrix::matPrecon(ClpInterior *model, double delta, double *x, double *y) const
+{
+  int nrow = model->numberRows();
+  int ncol = model->numberColumns();
+  double delta2 = delta * delta;
+  const CoinPackedMatrix *rowMatrix = rowCopy(model);
+  if (!rowMatrix) {
+    // operator only - no information
+    for (int k = 0; k < nrow; k++)
+      x[k] = 1.0 / sqrt(1.0 + delta2);
+    return;
+  }
+  if (blockSize_ == 1) {
+    // diagonal from row copy
+    double *d2 = new double[ncol];
+    for (int k = 0; k < ncol; k++)
+      d2[k] = y[k] * y[k];
+    const CoinBigIndex *rowStart = rowMatrix->getVectorStarts();
+    const int *rowLength = rowMatrix->getVectorLengths();
+    const int *column = rowMatrix->getIndices();
+    const double *element = rowMatrix->getElements();
+    for (int iRow = 0; iRow < nrow; iRow++) {
+      double value = delta2;
+      for (CoinBigIndex j = rowStart[iRow]; j < rowStart[iRow] + rowLength[iRow]; j++)
+        value += element[j] * element[j] * d2[column[j]];
+      x[iRow] = 1.0 / sqrt(value);
+    }
+    delete[] d2;
+    return;
+  }
+  if (numberRows_ != nrow) {
+    delete[] blockFactor_;
+    numberRows_ = nrow;
+    int numberBlocks = (nrow + blockSize_ - 1) / blockSize_;
+    blockFactor_ = new double[numberBlocks * blockSize_ * blockSize_];
+  }
+  int numberBlocks = (nrow + blockSize_ - 1) / blockSize_;
+  int nTasks = numberTasks(nrow);
+  clpPdcoBlockInfo *info = new clpPdcoBlockInfo[nTasks];
+  for (int i = 0; i < nTasks; i++) {
+    info[i].rowCopy = rowMatrix;
+    info[i].columnCopy = model->matrix();
+    info[i].d = y;
+    info[i].factor = blockFactor_;
+    info[i].diagonal = x;
+    info[i].delta2 = delta2;
+    info[i].numberRows = nrow;
+    info[i].blockSize = blockSize_;
+    info[i].first = static_cast< int >((static_cast< double >(numberBlocks) * i) / nTasks);
+    info[i].last = static_cast< int >((static_cast< double >(numberBlocks) * (i + 1)) / nTasks);
+  }
+  if (nTasks > 1)
+    clpParallelFor(pdcoBlockBit, info, nTasks);
+  else
+    pdcoBlockBit(info[0]);
+  delete[] info;
+  // x is diagonal scaling as in base class
+  for (int k = 0; k < nrow; k++)
+    x[k] = 1.0 / sqrt(x[k]);
+}
+// Block triangular solves if blocks, otherwise diagonal
+void ClpPdcoMatrix::matPreconApply(ClpInterior *model, int mode, double *x, const double *pr) const
+{
+  int nrow = model->numberRows();
+  if (blockSize_ == 1 || numberRows_ != nrow || !blockFactor_) {
+    ClpPdcoBase::matPreconApply(model, mode, x, pr);
+    return;
+  }
+  // R is L' so inverse(R) is back substitution with L'
+  for (int firstRow = 0; firstRow < nrow; firstRow += blockSize_) {
+    int n = CoinMin(nrow - firstRow, blockSize_);
+    const double *block = blockFactor_ + firstRow * blockSize_;
+    double *region = x + firstRow;
+    if (mode == 2) {
+      // L
+      for (int i = 0; i < n; i++) {
+        const double *columnI = block + i * blockSize_;
+        double value = region[i] / columnI[i];
+        region[i] = value;
+        for (int j = i + 1; j < n; j++)
+          region[j] -= value * columnI[j];
+      }
+    } else {
+      // L'
+      for (int i = n - 1; i >= 0; i--) {
+        const double *columnI = block + i * blockSize_;
+        double value = region[i];
+        for (int j = i + 1; j < n; j++)
+          value -= columnI[j] * region[j];
+        region[i] = value / columnI[i];
+      }
+    }
+  }
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,111 @@
+/* $Id$ */
+// Copyright (C) 2026, International Business Machines
+// Corporation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef ClpPdcoMatrix_H
+#define ClpPdcoMatrix_H
+
+#include "ClpPdcoBase.hpp"
+
+/** Pdco stuff for a linear objective using matrix of model.
+
+    Objective is c'x from model so with d1 and d2 this gives regularized
+    LP and least squares problems.
+
+    If model matrix is a ClpPackedMatrix then A*x and A'*y are done
+    in parallel (fixed partition so results do not depend on number
+    of threads) and matPrecon can do block Jacobi on A*D*D*A'.
+    Otherwise the matrix is used as an operator - only times and
+    transposeTimes of ClpMatrixBase are called so a matrix-free
+    ClpMatrixBase can be given to model.  In that case preconditioner
+    is identity unless a derived class overrides matPrecon.
+*/
+
+class CLPLIB_EXPORT ClpPdcoMatrix : public ClpPdcoBase {
+
+public:
+  /**@name Virtual methods */
+  //@{
+  /// mode 1 x += A*y, mode 2 x += A'*y
+  virtual void matVecMult(ClpInterior *model, int mode, double *x, double *y) const;
+
+  virtual void getGrad(ClpInterior *model, CoinDenseVector< double > &x, CoinDenseVector< double > &grad) const;
+
+  virtual void getHessian(ClpInterior *model, CoinDenseVector< double > &x, CoinDenseVector< double > &H) const;
+
+  virtual double getObj(ClpInterior *model, CoinDenseVector< double > &x) const;
+
+  /** Preconditioner for A*D*D*A' + delta*delta*I with D given in y.
+         x gets inverse of square root of diagonal.  If block size > 1
+         also factorizes diagonal blocks */
+  virtual void matPrecon(ClpInterior *model, double delta, double *x, double *y) const;
+
+  /// Block triangular solves if blocks, otherwise diagonal
+  virtual void matPreconApply(ClpInterior *model, int mode, double *x, const double *pr) const;
+  //@}
+
+  /**@name Gets and sets */
+  //@{
+  /// Block size for block Jacobi preconditioner (1 is diagonal)
+  inline int blockSize() const
+  {
+    return blockSize_;
+  }
+  /// Set block size for block Jacobi preconditioner (1 is diagonal)
+  void setBlockSize(int value);
+  /// Number of threads (0 means use clpParallelThreads())
+  inline int numberThreads() const
+  {
+    return numberThreads_;
+  }
+  /// Set number of threads (0 means use clpParallelThreads())
+  inline void setNumberThreads(int value)
+  {
+    numberThreads_ = value;
+  }
+  /** Throws away row copy and factors (e.g. if matrix changed).
+      Done at start of each ClpPdco::pdco so copies are only kept
+      within one solve */
+  void clearCopies();
+  //@}
+
+  /**@name Constructors, destructor */
+  //@{
+  /** Constructor */
+  ClpPdcoMatrix(double d1 = 1.0e-4, double d2 = 1.0e-4, int blockSize = 1);
+  /** Destructor */
+  virtual ~ClpPdcoMatrix();
+  /// Copy
+  ClpPdcoMatrix(const ClpPdcoMatrix &);
+  /// Assignment
+  ClpPdcoMatrix &operator=(const ClpPdcoMatrix &);
+  /// Clone
+  virtual ClpPdcoBase *clone() const;
+  //@}
+
+private:
+  /// Number of tasks to use for count items
+  int numberTasks(int count) const;
+  /// Makes row copy if needed and returns it (NULL if not packed)
+  const CoinPackedMatrix *rowCopy(ClpInterior *model) const;
+
+  /**@name Data members */
+  //@{
+  /// Row copy of packed matrix
+  mutable CoinPackedMatrix *rowCopy_;
+  /// Factors of diagonal blocks (each block size*size column major)
+  mutable double *blockFactor_;
+  /// Number of rows factors are for
+  mutable int numberRows_;
+  /// Block size
+  int blockSize_;
+  /// Number of threads
+  int numberThreads_;
+  //@}
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
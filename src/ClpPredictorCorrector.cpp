@@ -64,12 +64,12 @@ void ClpPredictorCorrector::saveSolution(std::string fileName)
 }
 #endif
 // Could change on CLP_LONG_CHOLESKY or COIN_LONG_WORK?
-static CoinWorkDouble eScale = 1.0e27;
-static CoinWorkDouble eBaseCaution = 1.0e-12;
-static CoinWorkDouble eBase = 1.0e-12;
-static CoinWorkDouble eDiagonal = 1.0e25;
-static CoinWorkDouble eDiagonalCaution = 1.0e18;
-static CoinWorkDouble eExtra = 1.0e-12;
+static const CoinWorkDouble eScale = 1.0e27;
+static const CoinWorkDouble eBaseCaution = 1.0e-12;
+static const CoinWorkDouble eBase = 1.0e-12;
+static const CoinWorkDouble eDiagonal = 1.0e25;
+static const CoinWorkDouble eDiagonalCaution = 1.0e18;
+static const CoinWorkDouble eExtra = 1.0e-12;
 
 // main function
 
@@ -137,8 +137,17 @@ int ClpPredictorCorrector::solve()
 
   //bool firstTime=true;
   //firstFactorization(true);
-  int returnCode = cholesky_->order(this);
-  if (returnCode || cholesky_->symbolic()) {
+  // If same sparsity as last solve then keep ordering and symbolic
+  int returnCode = 0;
+  if (cholesky_->reuseSymbolic(this)) {
+    cholesky_->setStructureHash(0);
+    returnCode = cholesky_->order(this);
+    if (!returnCode)
+      returnCode = cholesky_->symbolic();
+    if (!returnCode)
+      cholesky_->setStructureHash(ClpCholeskyBase::computeStructureHash(this));
+  }
+  if (returnCode) {
     COIN_DETAIL_PRINT(printf("Error return from symbolic - probably not enough memory\n"));
     problemStatus_ = 4;
     //delete all temporary regions
@@ -155,11 +164,23 @@ int ClpPredictorCorrector::solve()
     }
     return -1;
   }
+  // Number of centrality correctors (Gondzio).  If -1 more if
+  // factorization expensive relative to solve - average column count
+  // is rough ratio
+  int maximumCorrectors = maximumCorrectors_;
+  if (maximumCorrectors < 0) {
+    double averageCount = static_cast< double >(cholesky_->size()) / CoinMax(numberRows_, 1);
+    maximumCorrectors = 5;
+    if (averageCount > 50.0)
+      maximumCorrectors = CoinMin(9, 5 + static_cast< int >((averageCount - 50.0) / 50.0));
+  }
   mu_ = 1.0e10;
   diagonalScaleFactor_ = 1.0;
   //set iterations
   numberIterations_ = -1;
   int numberTotal = numberRows_ + numberColumns_;
+  // warm start keeps duals
+  bool doingWarmStart = warmStart_ != NULL;
   //initialize solution here
   if (createSolution() < 0) {
     COIN_DETAIL_PRINT(printf("Not enough memory\n"));
@@ -176,7 +197,8 @@ int ClpPredictorCorrector::solve()
   CoinWorkDouble *dualArray = reinterpret_cast< CoinWorkDouble * >(dual_);
   // Could try centering steps without any original step i.e. just center
   //firstFactorization(false);
-  CoinZeroN(dualArray, numberRows_);
+  if (!doingWarmStart)
+    CoinZeroN(dualArray, numberRows_);
   multiplyAdd(solution_ + numberColumns_, numberRows_, -1.0, errorRegion_, 0.0);
   matrix_->times(1.0, solution_, errorRegion_);
   maximumRHSError_ = maximumAbsElement(errorRegion_, numberRows_);
@@ -826,7 +848,7 @@ int ClpPredictorCorrector::solve()
       goodMove = false; // don't bother
     if ((modeSwitch & 1) != 0)
       goodMove = false;
-    while (goodMove && numberTries < 5) {
+    while (goodMove && numberTries < maximumCorrectors) {
       goodMove = false;
       numberTries++;
       CoinMemcpyN(deltaX_, numberTotal, saveX);
@@ -2011,35 +2033,47 @@ int ClpPredictorCorrector::createSolution()
   if (rhsNorm_ < 1.0) {
     rhsNorm_ = 1.0;
   }
-  int *rowsDropped = new int[numberRows_];
-  int returnCode = cholesky_->factorize(diagonal_, rowsDropped);
-  if (returnCode == -1) {
-    COIN_DETAIL_PRINT(printf("Out of memory\n"));
-    problemStatus_ = 4;
-    return -1;
-  }
-  if (cholesky_->status()) {
-    std::cout << "singular on initial cholesky?" << std::endl;
-    cholesky_->resetRowsDropped();
-    //cholesky_->factorize(rowDropped_);
-    //if (cholesky_->status()) {
-    //std::cout << "bad cholesky??? (after retry)" <<std::endl;
-    //abort();
-    //}
-  }
-  delete[] rowsDropped;
-  if (cholesky_->type() < 20) {
-    // not KKT
-    cholesky_->solve(errorRegion_);
-    //create information for solution
-    multiplyAdd(errorRegion_, numberRows_, -1.0, deltaX_ + numberColumns_, 0.0);
-    CoinZeroN(deltaX_, numberColumns_);
-    matrix_->transposeTimes(1.0, errorRegion_, deltaX_);
+  CoinWorkDouble *dualArray = reinterpret_cast< CoinWorkDouble * >(dual_);
+  // dj from warm start duals (A'y not including cost)
+  CoinWorkDouble *warmDj = NULL;
+  if (!warmStart_) {
+    int *rowsDropped = new int[numberRows_];
+    int returnCode = cholesky_->factorize(diagonal_, rowsDropped);
+    if (returnCode == -1) {
+      COIN_DETAIL_PRINT(printf("Out of memory\n"));
+      problemStatus_ = 4;
+      return -1;
+    }
+    if (cholesky_->status()) {
+      std::cout << "singular on initial cholesky?" << std::endl;
+      cholesky_->resetRowsDropped();
+      //cholesky_->factorize(rowDropped_);
+      //if (cholesky_->status()) {
+      //std::cout << "bad cholesky??? (after retry)" <<std::endl;
+      //abort();
+      //}
+    }
+    delete[] rowsDropped;
+    if (cholesky_->type() < 20) {
+      // not KKT
+      cholesky_->solve(errorRegion_);
+      //create information for solution
+      multiplyAdd(errorRegion_, numberRows_, -1.0, deltaX_ + numberColumns_, 0.0);
+      CoinZeroN(deltaX_, numberColumns_);
+      matrix_->transposeTimes(1.0, errorRegion_, deltaX_);
+    } else {
+      // KKT
+      // reverse sign on solution
+      multiplyAdd(NULL, numberRows_ + numberColumns_, 0.0, solution_, -1.0);
+      solveSystem(deltaX_, errorRegion_, solution_, NULL, NULL, NULL, false);
+    }
   } else {
-    // KKT
-    // reverse sign on solution
-    multiplyAdd(NULL, numberRows_ + numberColumns_, 0.0, solution_, -1.0);
-    solveSystem(deltaX_, errorRegion_, solution_, NULL, NULL, NULL, false);
+    // warm start - scale previous solution into deltaX_ and dual
+    scaleWarmStart(deltaX_, dualArray);
+    warmDj = workArray_;
+    CoinZeroN(warmDj, numberColumns_);
+    matrix_->transposeTimes(-1.0, dualArray, warmDj);
+    CoinMemcpyN(dualArray, numberRows_, warmDj + numberColumns_);
   }
   CoinWorkDouble initialValue = 1.0e2;
   if (rhsNorm_ * 1.0e-2 > initialValue) {
@@ -2062,9 +2096,10 @@ int ClpPredictorCorrector::createSolution()
     }
   }
   solutionNorm_ = 1.0e-12;
-  handler_->message(CLP_BARRIER_SAFE, messages_)
-    << static_cast< double >(initialValue) << static_cast< double >(objectiveNorm_)
-    << CoinMessageEol;
+  if (!warmStart_)
+    handler_->message(CLP_BARRIER_SAFE, messages_)
+      << static_cast< double >(initialValue) << static_cast< double >(objectiveNorm_)
+      << CoinMessageEol;
   CoinWorkDouble extra = 1.0e-10;
   CoinWorkDouble largeGap = 1.0e15;
   //CoinWorkDouble safeObjectiveValue=2.0*objectiveNorm_;
@@ -2078,12 +2113,62 @@ int ClpPredictorCorrector::createSolution()
   // safeObjectiveValue,initialValue);
   CoinWorkDouble zwLarge = 1.0e2 * initialValue;
   //zwLarge=1.0e40;
-  if (cholesky_->choleskyCondition() < 0.0 && cholesky_->type() < 20) {
+  if (!warmStart_ && cholesky_->choleskyCondition() < 0.0 && cholesky_->type() < 20) {
     // looks bad - play safe
     initialValue *= 10.0;
     safeObjectiveValue *= 10.0;
     safeFree *= 10.0;
   }
+  if (warmStart_) {
+    // Shift previous point into interior (as Mehrotra) - start with
+    // small shifts and then balance using complementarity
+    CoinWorkDouble primalNorm = 0.0;
+    CoinWorkDouble dualNorm = 0.0;
+    CoinWorkDouble sumGap = 0.0;
+    CoinWorkDouble sumPrimal = 0.0;
+    CoinWorkDouble sumDual = 0.0;
+    int numberPairs = 0;
+    for (iColumn = 0; iColumn < numberTotal; iColumn++) {
+      if (!flagged(iColumn)) {
+        CoinWorkDouble primalValue = fakeSolution[iColumn];
+        CoinWorkDouble reducedCost = cost_[iColumn] + warmDj[iColumn];
+        primalNorm = CoinMax(primalNorm, CoinAbs(primalValue));
+        dualNorm = CoinMax(dualNorm, CoinAbs(reducedCost));
+        if (lowerBound(iColumn)) {
+          CoinWorkDouble s = CoinMax(primalValue - lower_[iColumn], 0.0);
+          CoinWorkDouble z = CoinMax(reducedCost, 0.0);
+          sumGap += s * z;
+          sumPrimal += s;
+          sumDual += z;
+          numberPairs++;
+        }
+        if (upperBound(iColumn)) {
+          CoinWorkDouble t = CoinMax(upper_[iColumn] - primalValue, 0.0);
+          CoinWorkDouble w = CoinMax(-reducedCost, 0.0);
+          sumGap += t * w;
+          sumPrimal += t;
+          sumDual += w;
+          numberPairs++;
+        }
+      }
+    }
+    CoinWorkDouble primalShift = 1.0e-3 * CoinMax(1.0, primalNorm);
+    CoinWorkDouble dualShift = 1.0e-3 * CoinMax(1.0, dualNorm);
+    if (numberPairs) {
+      CoinWorkDouble gap = sumGap + dualShift * sumPrimal + primalShift * sumDual
+        + numberPairs * primalShift * dualShift;
+      CoinWorkDouble newPrimalShift = primalShift + 0.5 * gap / (sumDual + numberPairs * dualShift);
+      dualShift += 0.5 * gap / (sumPrimal + numberPairs * primalShift);
+      primalShift = newPrimalShift;
+    }
+    handler_->message(CLP_BARRIER_WARM, messages_)
+      << static_cast< double >(primalShift) << static_cast< double >(dualShift)
+      << CoinMessageEol;
+    initialValue = primalShift;
+    safeObjectiveValue = dualShift;
+    safeFree = 0.0;
+    zwLarge = COIN_DBL_MAX;
+  }
   CoinWorkDouble gamma2 = gamma_ * gamma_; // gamma*gamma will be added to diagonal
   // First do primal side
   for (iColumn = 0; iColumn < numberTotal; iColumn++) {
@@ -2175,6 +2260,8 @@ int ClpPredictorCorrector::createSolution()
       CoinWorkDouble upperValue = upper_[iColumn];
       // Do dj
       CoinWorkDouble reducedCost = cost_[iColumn];
+      if (warmDj)
+        reducedCost += warmDj[iColumn];
       if (lowerBound(iColumn)) {
         reducedCost += linearPerturbation_;
       }
@@ -2335,6 +2422,9 @@ int ClpPredictorCorrector::createSolution()
      }
      exit(66);
 #endif
+  // warm start only used once
+  delete[] warmStart_;
+  warmStart_ = NULL;
   return 0;
 }
 // complementarityGap.  Computes gap
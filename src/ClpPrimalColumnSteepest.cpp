@@ -19,6 +19,7 @@
 #include "ClpEventHandler.hpp"
 #include "ClpPackedMatrix.hpp"
 #include "CoinHelperFunctions.hpp"
+#include "ClpHelperFunctions.hpp"
 #include <stdio.h>
 #if ABOCA_LITE
 #undef ALT_UPDATE_WEIGHTS
@@ -209,6 +210,232 @@ pivotColumnBit(clpTempInfo &info)
   info.primalRatio = bestDj;
   info.numberAdded = bestSequence;
 }
+#if ABOCA_LITE
+// Size of chunk for parallel partial pricing
+#define PARTIAL_PRICE_CHUNK 1024
+// Minimum size of update before going parallel
+#define MINIMUM_PARALLEL_UPDATE 4096
+// Most candidates recorded per chunk before chunk is redone serially
+#define PARTIAL_PRICE_RECORDS 64
+typedef struct {
+  const double *infeas;
+  const double *weights;
+  const unsigned char *status;
+  const int *index;
+  double tolerance;
+  double startDj;
+  int start[4];
+  // number of candidates (value > tolerance) in chunk
+  int numberCandidates;
+  // -1 if too many records
+  int numberRecords;
+  // candidate count before each record
+  int position[PARTIAL_PRICE_RECORDS];
+  int sequence[PARTIAL_PRICE_RECORDS];
+} clpPartialPriceInfo;
+/* For partial pricing - scans up to two ranges using serial test
+   but starting from startDj.  Any candidate (flagged or not) which would
+   beat best so far is recorded so that merge can replay chunk with true
+   best and true count of wanted */
+static void
+partialPricingBit(clpPartialPriceInfo &info)
+{
+  const double *COIN_RESTRICT weights = info.weights;
+  const unsigned char *COIN_RESTRICT status = info.status;
+  const double *COIN_RESTRICT infeas = info.infeas;
+  const int *COIN_RESTRICT index = info.index;
+  double tolerance = info.tolerance;
+  double bestDj = info.startDj;
+  int numberCandidates = 0;
+  int numberRecords = 0;
+  for (int k = 0; k < 4; k += 2) {
+    for (int i = info.start[k]; i < info.start[k + 1]; i++) {
+      int iSequence = index[i];
+      double value = infeas[iSequence];
+      if (value > tolerance) {
+        if (value > bestDj * weights[iSequence]) {
+          if (numberRecords < PARTIAL_PRICE_RECORDS) {
+            info.position[numberRecords] = numberCandidates;
+            info.sequence[numberRecords] = iSequence;
+            numberRecords++;
+          } else {
+            numberRecords = -1;
+            break;
+          }
+          if ((status[iSequence] & 64) == 0)
+            bestDj = value / weights[iSequence];
+        }
+        numberCandidates++;
+      }
+    }
+    if (numberRecords < 0)
+      break;
+  }
+  info.numberCandidates = numberCandidates;
+  info.numberRecords = numberRecords;
+}
+typedef struct {
+  CoinIndexedVector *infeasible;
+  double *reducedCost;
+  double *weights; // NULL if weights already done
+  const unsigned int *reference;
+  const unsigned char *status;
+  const int *index;
+  double *updateBy;
+  double *updateBy2;
+  int *added;
+  double scaleFactor;
+  double devex;
+  double tolerance;
+  double referenceIn;
+  int numberToDo;
+  int numberAdded;
+  int killDjs;
+} steepestUpdateInfo;
+/* Updates djs (and devex weights) for part of packed update.
+   New infeasibilities are put in dense array and indices saved in
+   added so they can be put in infeasible in order afterwards */
+static void
+updateDjsBit(steepestUpdateInfo &info)
+{
+  CoinIndexedVector *infeasible = info.infeasible;
+  double *COIN_RESTRICT infeas = infeasible->denseVector();
+  double *COIN_RESTRICT reducedCost = info.reducedCost;
+  double *COIN_RESTRICT weight = info.weights;
+  const unsigned int *COIN_RESTRICT reference = info.reference;
+  const unsigned char *COIN_RESTRICT status = info.status;
+  const int *COIN_RESTRICT index = info.index;
+  double *COIN_RESTRICT updateBy = info.updateBy;
+  int *COIN_RESTRICT added = info.added;
+  double scaleFactor = info.scaleFactor;
+  double devex = info.devex;
+  double tolerance = info.tolerance;
+  int numberAdded = 0;
+  for (int j = 0; j < info.numberToDo; j++) {
+    int iSequence = index[j];
+    double value = reducedCost[iSequence];
+    double value2 = updateBy[j];
+    updateBy[j] = 0.0;
+    value -= value2;
+    reducedCost[iSequence] = value;
+    ClpSimplex::Status iStatus = static_cast< ClpSimplex::Status >(status[iSequence] & 7);
+    if (iStatus == ClpSimplex::basic || iStatus == ClpSimplex::isFixed) {
+      if (weight && iStatus == ClpSimplex::basic)
+        infeasible->zero(iSequence);
+      continue;
+    }
+    if (weight) {
+      double pivot = value2 * scaleFactor;
+      double value3 = pivot * pivot * devex;
+      if (((reference[iSequence >> 5] >> (iSequence & 31)) & 1) != 0)
+        value3 += 1.0;
+      weight[iSequence] = CoinMax(0.99 * weight[iSequence], value3);
+    }
+    bool infeasibility;
+    if (iStatus == ClpSimplex::atUpperBound) {
+      infeasibility = value > tolerance;
+    } else if (iStatus == ClpSimplex::atLowerBound) {
+      infeasibility = value < -tolerance;
+    } else {
+      infeasibility = fabs(value) > FREE_ACCEPT * tolerance;
+      // we are going to bias towards free (but only if reasonable)
+      value *= FREE_BIAS;
+    }
+    if (infeasibility) {
+      // store square in list
+      if (!infeas[iSequence])
+        added[numberAdded++] = iSequence;
+      infeas[iSequence] = value * value;
+    } else {
+      infeasible->zero(iSequence);
+    }
+  }
+  info.numberAdded = numberAdded;
+}
+// Steepest weights for part of tableau row (as in transposeTimes2)
+static void
+updateWeightsBit(steepestUpdateInfo &info)
+{
+  double *COIN_RESTRICT weight = info.weights;
+  const unsigned int *COIN_RESTRICT reference = info.reference;
+  const unsigned char *COIN_RESTRICT status = info.status;
+  const int *COIN_RESTRICT index = info.index;
+  double *COIN_RESTRICT updateBy = info.updateBy;
+  double *COIN_RESTRICT updateBy2 = info.updateBy2;
+  double scaleFactor = info.scaleFactor;
+  double devex = info.devex;
+  double referenceIn = info.referenceIn;
+  for (int j = 0; j < info.numberToDo; j++) {
+    int iSequence = index[j];
+    double value2 = updateBy[j];
+    if (info.killDjs)
+      updateBy[j] = 0.0;
+    double modification = updateBy2[j];
+    updateBy2[j] = 0.0;
+    ClpSimplex::Status iStatus = static_cast< ClpSimplex::Status >(status[iSequence] & 7);
+    if (iStatus != ClpSimplex::basic && iStatus != ClpSimplex::isFixed) {
+      double thisWeight = weight[iSequence];
+      double pivot = value2 * scaleFactor;
+      double pivotSquared = pivot * pivot;
+      thisWeight += pivotSquared * devex + pivot * modification;
+      if (thisWeight < TRY_NORM) {
+        if (referenceIn < 0.0) {
+          // steepest
+          thisWeight = CoinMax(TRY_NORM, ADD_ONE + pivotSquared);
+        } else {
+          // exact
+          thisWeight = referenceIn * pivotSquared;
+          if (((reference[iSequence >> 5] >> (iSequence & 31)) & 1) != 0)
+            thisWeight += 1.0;
+          thisWeight = CoinMax(thisWeight, TRY_NORM);
+        }
+      }
+      weight[iSequence] = thisWeight;
+    }
+  }
+}
+/* Does column part of update in parallel - added is work array
+   at least as long as update */
+static void
+parallelUpdateDjs(int numberThreads, CoinIndexedVector *infeasible,
+  CoinIndexedVector *update, int *added,
+  double *reducedCost, double *weights,
+  const unsigned int *reference, const unsigned char *status,
+  double scaleFactor, double devex, double tolerance)
+{
+  steepestUpdateInfo info[ABOCA_LITE];
+  numberThreads = CoinMin(numberThreads, ABOCA_LITE);
+  int number = update->getNumElements();
+  const int *index = update->getIndices();
+  double *updateBy = update->denseVector();
+  int chunk = (number + numberThreads - 1) / numberThreads;
+  int n = 0;
+  for (int i = 0; i < numberThreads; i++) {
+    info[i].infeasible = infeasible;
+    info[i].reducedCost = reducedCost;
+    info[i].weights = weights;
+    info[i].reference = reference;
+    info[i].status = status;
+    info[i].index = index + n;
+    info[i].updateBy = updateBy + n;
+    info[i].added = added + n;
+    info[i].scaleFactor = scaleFactor;
+    info[i].devex = devex;
+    info[i].tolerance = tolerance;
+    info[i].numberToDo = CoinMax(CoinMin(chunk, number - n), 0);
+    n += chunk;
+  }
+  clpParallelFor(updateDjsBit, info, numberThreads);
+  // put in list in same order as serial code
+  double *infeas = infeasible->denseVector();
+  for (int i = 0; i < numberThreads; i++) {
+    for (int j = 0; j < info[i].numberAdded; j++) {
+      int iSequence = info[i].added[j];
+      infeasible->quickAdd(iSequence, infeas[iSequence]);
+    }
+  }
+}
+#endif
 // Returns pivot column, -1 if none
 /*      The Packed CoinIndexedVector updates has cost updates - for normal LP
 	that is just +-weight where a feasibility changed.  It also has
@@ -595,7 +822,103 @@ int ClpPrimalColumnSteepest::pivotColumn(CoinIndexedVector *updates,
     double dstart = static_cast< double >(number) * model_->randomNumberGenerator()->randomDouble();
     start[0] = static_cast< int >(dstart);
     start[3] = start[0];
-    for (iPass = 0; iPass < 2; iPass++) {
+    int firstPass = 0;
+#if ABOCA_LITE
+    int numberThreads = CoinMin(abcState(), ABOCA_LITE);
+    if (numberThreads > 1 && switchType < 5 && number > 4 * PARTIAL_PRICE_CHUNK && numberWanted > 0) {
+      /* Look at fixed size chunks (in same order as below) a wave at a time.
+         Each chunk records the candidates which could change best or count
+         and chunks are then replayed in order with the serial rule - so
+         answer is same as serial and does not depend on number of threads */
+      clpPartialPriceInfo info[ABOCA_LITE];
+      int chunk = CoinMax(PARTIAL_PRICE_CHUNK, (number + 63) >> 6);
+      double startDj = bestDj;
+      int position = 0;
+      while (position < number && numberWanted > 0) {
+        int numberChunks = 0;
+        while (numberChunks < numberThreads && position < number) {
+          clpPartialPriceInfo &infoC = info[numberChunks++];
+          int *startC = infoC.start;
+          int first = position + start[0];
+          int last = CoinMin(position + chunk, number) + start[0];
+          position += chunk;
+          if (first >= number) {
+            startC[0] = first - number;
+            startC[1] = last - number;
+            startC[2] = 0;
+            startC[3] = 0;
+          } else if (last <= number) {
+            startC[0] = first;
+            startC[1] = last;
+            startC[2] = 0;
+            startC[3] = 0;
+          } else {
+            startC[0] = first;
+            startC[1] = number;
+            startC[2] = 0;
+            startC[3] = last - number;
+          }
+          infoC.startDj = startDj;
+          infoC.weights = weights_;
+          infoC.infeas = infeas;
+          infoC.index = index;
+          infoC.status = model_->statusArray();
+          infoC.tolerance = tolerance;
+        }
+        clpParallelFor(partialPricingBit, info, numberChunks);
+        for (int iChunk = 0; iChunk < numberChunks && numberWanted > 0; iChunk++) {
+          clpPartialPriceInfo &infoC = info[iChunk];
+          if (infoC.numberRecords >= 0) {
+            // replay - numberWanted only changes at candidates
+            int numberExtra = 0;
+            for (int j = 0; j < infoC.numberRecords; j++) {
+              int stopAt = numberWanted + numberExtra - 1;
+              if (infoC.position[j] > stopAt)
+                break;
+              iSequence = infoC.sequence[j];
+              double value = infeas[iSequence];
+              if (value > bestDj * weights_[iSequence]) {
+                if (!model_->flagged(iSequence)) {
+                  bestDj = value / weights_[iSequence];
+                  bestSequence = iSequence;
+                } else {
+                  numberExtra++;
+                  continue;
+                }
+              }
+              if (infoC.position[j] == stopAt)
+                break;
+            }
+            numberWanted = CoinMax(numberWanted - infoC.numberCandidates + numberExtra, 0);
+          } else {
+            // too many records - do serially
+            for (int k = 0; k < 4 && numberWanted; k += 2) {
+              for (i = infoC.start[k]; i < infoC.start[k + 1]; i++) {
+                iSequence = index[i];
+                double value = infeas[iSequence];
+                double weight = weights_[iSequence];
+                if (value > tolerance) {
+                  if (value > bestDj * weight) {
+                    if (!model_->flagged(iSequence)) {
+                      bestDj = value / weight;
+                      bestSequence = iSequence;
+                    } else {
+                      numberWanted++;
+                    }
+                  }
+                  numberWanted--;
+                }
+                if (!numberWanted)
+                  break;
+              }
+            }
+          }
+        }
+      }
+      firstPass = 2;
+    }
+#endif
+    for (iPass = firstPass; iPass < 2; iPass++) {
       int end = start[2 * iPass + 1];
       if (switchType < 5) {
         for (i = start[2 * iPass]; i < end; i++) {
@@ -686,10 +1009,7 @@ int ClpPrimalColumnSteepest::pivotColumn(CoinIndexedVector *updates,
     if (numberThreads == 1) {
       pivotColumnBit(info[0]);
     } else {
-      for (int i = 0; i < numberThreads; i++) {
-        cilk_spawn pivotColumnBit(info[i]);
-      }
-      cilk_sync;
+      clpParallelFor(pivotColumnBit, info, numberThreads);
     }
     for (int i = 0; i < numberThreads; i++) {
       double bestDjX = info[i].primalRatio;
@@ -1025,6 +1345,15 @@ void ClpPrimalColumnSteepest::djsAndDevex(CoinIndexedVector *updates,
   updateBy = spareColumn1->denseVector();
 
   // Devex
+#if ABOCA_LITE
+  int numberThreads = abcState();
+  if (numberThreads > 1 && number > MINIMUM_PARALLEL_UPDATE) {
+    parallelUpdateDjs(numberThreads, infeasible_, spareColumn1,
+      spareColumn2->getIndices(), reducedCost, weight, reference_,
+      model_->statusArray(), scaleFactor, devex_, tolerance);
+    number = 0;
+  }
+#endif
 
   for (j = 0; j < number; j++) {
     double thisWeight;
@@ -1380,6 +1709,16 @@ void ClpPrimalColumnSteepest::djsAndSteepest(CoinIndexedVector *updates,
     }
   } else if (returnCode == 0) {
     reducedCost = model_->djRegion(1);
+#if ABOCA_LITE
+    int numberThreads = abcState();
+    if (numberThreads > 1 && number > MINIMUM_PARALLEL_UPDATE) {
+      // weights done in transposeTimes2
+      parallelUpdateDjs(numberThreads, infeasible_, spareColumn1,
+        spareColumn2->getIndices(), reducedCost, NULL, reference_,
+        model_->statusArray(), scaleFactor, devex_, tolerance);
+      number = 0;
+    }
+#endif
 
     for (j = 0; j < number; j++) {
       int iSequence = index[j];
@@ -2012,6 +2351,31 @@ int ClpPrimalColumnSteepest::transposeTimes2(const CoinIndexedVector *pi1, CoinI
     const int *index = dj1->getIndices();
     double *updateBy = dj1->denseVector();
     double *updateBy2 = dj2->denseVector();
+#if ABOCA_LITE
+    int numberThreads = CoinMin(abcState(), ABOCA_LITE);
+    if (numberThreads > 1 && number > MINIMUM_PARALLEL_UPDATE) {
+      // each entry independent so just split
+      steepestUpdateInfo info[ABOCA_LITE];
+      int chunk = (number + numberThreads - 1) / numberThreads;
+      int n = 0;
+      for (int i = 0; i < numberThreads; i++) {
+        info[i].weights = weight;
+        info[i].reference = reference_;
+        info[i].status = model_->statusArray();
+        info[i].index = index + n;
+        info[i].updateBy = updateBy + n;
+        info[i].updateBy2 = updateBy2 + n;
+        info[i].scaleFactor = scaleFactor;
+        info[i].devex = devex_;
+        info[i].referenceIn = referenceIn;
+        info[i].killDjs = killDjs ? 1 : 0;
+        info[i].numberToDo = CoinMax(CoinMin(chunk, number - n), 0);
+        n += chunk;
+      }
+      clpParallelFor(updateWeightsBit, info, numberThreads);
+      number = 0;
+    }
+#endif
 
     for (int j = 0; j < number; j++) {
       double thisWeight;
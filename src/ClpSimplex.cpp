@@ -18,6 +18,7 @@
 #include "ClpSimplex.hpp"
 #include "ClpFactorization.hpp"
 #include "ClpPackedMatrix.hpp"
+#include "ClpMappedModel.hpp"
 #include "CoinIndexedVector.hpp"
 #include "ClpDualRowDantzig.hpp"
 #include "ClpDualRowSteepest.hpp"
@@ -30,6 +31,7 @@
 #include "ClpEventHandler.hpp"
 #include "ClpLinearObjective.hpp"
 #include "ClpHelperFunctions.hpp"
+#include "CoinTime.hpp"
 #include "CoinModel.hpp"
 #include "CoinLpIO.hpp"
 #include <cfloat>
@@ -2008,7 +2010,11 @@ int ClpSimplex::internalFactorize(int solveType)
 	   numberOutside,sumOutside,numberOutsideLarge,
 	   numberInside,sumInside,numberInsideLarge);
 #endif
+  // time factorization if refactorizing from measured times
+  double factorizeStart = ((moreSpecialOptions_ & 33554432) != 0) ? CoinGetTimeOfDay() : 0.0;
   int status = factorization_->factorize(this, solveType, valuesPass);
+  if (factorizeStart)
+    factorization_->setFactorizeTime(CoinGetTimeOfDay() - factorizeStart);
   if (status) {
     handler_->message(CLP_SIMPLEX_BADFACTOR, messages_)
       << status
@@ -2264,7 +2270,13 @@ int ClpSimplex::housekeeping(double objectiveChange)
   int maximumPivots = factorization_->maximumPivots();
   int numberDense = factorization_->numberDense();
   bool dontInvert = ((specialOptions_ & 16384) != 0 && numberIterations_ * 3 > 2 * maximumIterations());
-  if (numberPivots == maximumPivots || maximumPivots < 2) {
+  // see if measured times say refactorize (-1 if not being used)
+  int timeSays = -1;
+  if ((moreSpecialOptions_ & 33554432) != 0) {
+    timeSays = factorization_->timeIteration();
+    maximumPivots = factorization_->adaptivePivots();
+  }
+  if (numberPivots >= maximumPivots || maximumPivots < 2) {
     // If dense then increase
     if (maximumPivots > 100 && numberDense > 1.5 * maximumPivots
       && false) {
@@ -2280,8 +2292,15 @@ int ClpSimplex::housekeeping(double objectiveChange)
 #if CLP_FACTORIZATION_NEW_TIMING > 1
     factorization_->statsRefactor('M');
 #endif
+    // count limit - so not an adaptive refactorization
+    if (timeSays >= 0)
+      factorization_->adjustAdaptivePivots(false);
+    return 1;
+  } else if (timeSays > 0 && !dontInvert) {
+    factorization_->adjustAdaptivePivots(true);
+    eventHandler_->event(ClpEventHandler::adaptiveRefactorization);
     return 1;
-  } else if ((factorization_->timeToRefactorize() && !dontInvert)
+  } else if ((timeSays < 0 && factorization_->timeToRefactorize() && !dontInvert)
     || invertNow) {
     //printf("ret after %d pivots\n",factorization_->pivots());
 #if CLP_FACTORIZATION_NEW_TIMING > 1
@@ -6225,6 +6244,17 @@ int ClpSimplex::readBasis(const char *filename)
 {
   return static_cast< ClpSimplexOther * >(this)->readBasis(filename);
 }
+// Write a binary snapshot of basis
+int ClpSimplex::writeBinaryBasis(const char *filename,
+  bool writeValues) const
+{
+  return static_cast< const ClpSimplexOther * >(this)->writeBinaryBasis(filename, writeValues);
+}
+// Read a binary basis snapshot
+int ClpSimplex::readBinaryBasis(const char *filename)
+{
+  return static_cast< ClpSimplexOther * >(this)->readBinaryBasis(filename);
+}
 #include "ClpSimplexNonlinear.hpp"
 /* Solves nonlinear problem using SLP - may be used as crash
    for other algorithms when number of iterations small
@@ -6744,6 +6774,23 @@ int ClpSimplex::strongBranching(int numberVariables, const int *variables,
     stopOnFirstInfeasible,
     alwaysFinish, startFinishOptions);
 }
+// Parallel version of strongBranching
+int ClpSimplex::parallelStrongBranching(int numberThreads,
+  int numberVariables, const int *variables,
+  double *newLower, double *newUpper,
+  double **outputSolution,
+  int *outputStatus, int *outputIterations,
+  bool stopOnFirstInfeasible,
+  bool alwaysFinish,
+  int startFinishOptions)
+{
+  return static_cast< ClpSimplexDual * >(this)->parallelStrongBranching(numberThreads,
+    numberVariables, variables,
+    newLower, newUpper, outputSolution,
+    outputStatus, outputIterations,
+    stopOnFirstInfeasible,
+    alwaysFinish, startFinishOptions);
+}
 #endif
 /* Borrow model.  This is so we dont have to copy large amounts
    of data around.  It assumes a derived class wants to overwrite
@@ -6807,31 +6854,95 @@ typedef struct {
   int matrixStorageChoice;
 } Clp_scalars;
 #ifndef SLIM_NOIO
-int outDoubleArray(double *array, int length, FILE *fp)
+/* Model file is page aligned so it can be mapped (see ClpMappedFile).
+   Header (with scalars and table of sections) then each array
+   at an aligned offset.  Older files (no header) can still be read */
+#define CLP_MODEL_MAGIC "ClpModel"
+#define CLP_MODEL_VERSION 2
+#define CLP_MODEL_ALIGN 4096
+#define CLP_MODEL_ENDIAN 0x01020304
+enum {
+  CLP_SECTION_STRINGS = 0,
+  CLP_SECTION_ROW_ACTIVITY,
+  CLP_SECTION_COLUMN_ACTIVITY,
+  CLP_SECTION_DUAL,
+  CLP_SECTION_REDUCED_COST,
+  CLP_SECTION_ROW_LOWER,
+  CLP_SECTION_ROW_UPPER,
+  CLP_SECTION_OBJECTIVE,
+  CLP_SECTION_ROW_OBJECTIVE,
+  CLP_SECTION_COLUMN_LOWER,
+  CLP_SECTION_COLUMN_UPPER,
+  CLP_SECTION_RAY,
+  CLP_SECTION_STATUS,
+  CLP_SECTION_ROW_NAMES,
+  CLP_SECTION_COLUMN_NAMES,
+  CLP_SECTION_INTEGER,
+  CLP_SECTION_ELEMENTS,
+  CLP_SECTION_INDICES,
+  CLP_SECTION_STARTS,
+  CLP_SECTION_LENGTHS,
+  CLP_NUMBER_SECTIONS
+};
+typedef struct {
+  CoinInt64 offset;
+  CoinInt64 length; // in bytes
+} Clp_section;
+typedef struct {
+  char magic[8];
+  int version;
+  int endian;
+  int sizeScalars;
+  int sizeBigIndex;
+  int alignment;
+  int numberSections;
+  Clp_section section[CLP_NUMBER_SECTIONS];
+  Clp_scalars scalars;
+} Clp_header;
+// Pads file to alignment
+static bool alignModelFile(FILE *fp, CoinInt64 &position)
+{
+  static const char zeros[CLP_MODEL_ALIGN] = { 0 };
+  size_t extra = static_cast< size_t >((CLP_MODEL_ALIGN - position % CLP_MODEL_ALIGN) % CLP_MODEL_ALIGN);
+  if (extra && fwrite(zeros, 1, extra, fp) != extra)
+    return false;
+  position += extra;
+  return true;
+}
+// Writes a section at aligned position
+static bool outSection(FILE *fp, const void *array, CoinInt64 length,
+  CoinInt64 &position, Clp_section &section)
 {
-  size_t numberWritten;
-  if (array && length) {
-    numberWritten = fwrite(&length, sizeof(int), 1, fp);
-    if (numberWritten != 1)
-      return 1;
-    numberWritten = fwrite(array, sizeof(double), length, fp);
+  if (!alignModelFile(fp, position))
+    return false;
+  section.offset = position;
+  section.length = array ? length : 0;
+  if (section.length) {
+    size_t numberWritten = fwrite(array, 1, static_cast< size_t >(length), fp);
     if (numberWritten != static_cast< size_t >(length))
-      return 1;
-  } else {
-    length = 0;
-    numberWritten = fwrite(&length, sizeof(int), 1, fp);
-    if (numberWritten != 1)
-      return 1;
+      return false;
+    position += length;
   }
-  return 0;
+  return true;
 }
 // Save model to file, returns 0 if success
 int ClpSimplex::saveModel(const char *fileName)
 {
-  FILE *fp = fopen(fileName, "wb");
+  // write to temporary file and rename so a model mapping old file is safe
+  std::string tempName = std::string(fileName) + ".tmp";
+  FILE *fp = fopen(tempName.c_str(), "wb");
   if (fp) {
-    Clp_scalars scalars;
-    size_t numberWritten;
+    Clp_header header;
+    memset(&header, 0, sizeof(Clp_header));
+    memcpy(header.magic, CLP_MODEL_MAGIC, 8);
+    header.version = CLP_MODEL_VERSION;
+    header.endian = CLP_MODEL_ENDIAN;
+    header.sizeScalars = static_cast< int >(sizeof(Clp_scalars));
+    header.sizeBigIndex = static_cast< int >(sizeof(CoinBigIndex));
+    header.alignment = CLP_MODEL_ALIGN;
+    header.numberSections = CLP_NUMBER_SECTIONS;
+    Clp_scalars &scalars = header.scalars;
+    Clp_section *section = header.section;
     // Fill in scalars
     scalars.optimizationDirection = optimizationDirection_;
     CoinMemcpyN(dblParam_, ClpLastDblParam, scalars.dblParam);
@@ -6861,142 +6972,121 @@ int ClpSimplex::saveModel(const char *fileName)
     scalars.primalPivotChoice = primalColumnPivot_->type();
     scalars.matrixStorageChoice = matrix_->type();
 
-    // put out scalars
-    numberWritten = fwrite(&scalars, sizeof(Clp_scalars), 1, fp);
-    if (numberWritten != 1)
-      return 1;
-    size_t length;
-#ifndef CLP_NO_STD
-    int i;
+    // header is written again at end with sections filled in
+    bool ok = fwrite(&header, sizeof(Clp_header), 1, fp) == 1;
+    CoinInt64 position = sizeof(Clp_header);
     // strings
-    for (i = 0; i < ClpLastStrParam; i++) {
-      length = strParam_[i].size();
-      numberWritten = fwrite(&length, sizeof(int), 1, fp);
-      if (numberWritten != 1)
-        return 1;
-      if (length) {
-        numberWritten = fwrite(strParam_[i].c_str(), length, 1, fp);
-        if (numberWritten != 1)
-          return 1;
-      }
-    }
-#endif
-    // arrays - in no particular order
-    if (outDoubleArray(rowActivity_, numberRows_, fp))
-      return 1;
-    if (outDoubleArray(columnActivity_, numberColumns_, fp))
-      return 1;
-    if (outDoubleArray(dual_, numberRows_, fp))
-      return 1;
-    if (outDoubleArray(reducedCost_, numberColumns_, fp))
-      return 1;
-    if (outDoubleArray(rowLower_, numberRows_, fp))
-      return 1;
-    if (outDoubleArray(rowUpper_, numberRows_, fp))
-      return 1;
-    if (outDoubleArray(objective(), numberColumns_, fp))
-      return 1;
-    if (outDoubleArray(rowObjective_, numberRows_, fp))
-      return 1;
-    if (outDoubleArray(columnLower_, numberColumns_, fp))
-      return 1;
-    if (outDoubleArray(columnUpper_, numberColumns_, fp))
-      return 1;
-    if (ray_) {
-      if (problemStatus_ == 1) {
-        if (outDoubleArray(ray_, numberRows_, fp))
-          return 1;
-      } else if (problemStatus_ == 2) {
-        if (outDoubleArray(ray_, numberColumns_, fp))
-          return 1;
-      } else {
-        if (outDoubleArray(NULL, 0, fp))
-          return 1;
-      }
-    } else {
-      if (outDoubleArray(NULL, 0, fp))
-        return 1;
-    }
-    if (status_ && (numberRows_ + numberColumns_) > 0) {
-      length = numberRows_ + numberColumns_;
-      numberWritten = fwrite(&length, sizeof(int), 1, fp);
-      if (numberWritten != 1)
-        return 1;
-      numberWritten = fwrite(status_, sizeof(char), length, fp);
-      if (numberWritten != length)
-        return 1;
-    } else {
-      length = 0;
-      numberWritten = fwrite(&length, sizeof(int), 1, fp);
-      if (numberWritten != 1)
-        return 1;
-    }
+    std::string strings;
 #ifndef CLP_NO_STD
-    if (lengthNames_) {
+    for (int i = 0; i < ClpLastStrParam; i++) {
+      int length = static_cast< int >(strParam_[i].size());
+      strings.append(reinterpret_cast< const char * >(&length), sizeof(int));
+      strings += strParam_[i];
+    }
+#endif
+    ok = ok && outSection(fp, strings.c_str(), strings.size(), position, section[CLP_SECTION_STRINGS]);
+    // arrays
+    CoinInt64 rowBytes = static_cast< CoinInt64 >(numberRows_) * sizeof(double);
+    CoinInt64 columnBytes = static_cast< CoinInt64 >(numberColumns_) * sizeof(double);
+    ok = ok && outSection(fp, rowActivity_, rowBytes, position, section[CLP_SECTION_ROW_ACTIVITY]);
+    ok = ok && outSection(fp, columnActivity_, columnBytes, position, section[CLP_SECTION_COLUMN_ACTIVITY]);
+    ok = ok && outSection(fp, dual_, rowBytes, position, section[CLP_SECTION_DUAL]);
+    ok = ok && outSection(fp, reducedCost_, columnBytes, position, section[CLP_SECTION_REDUCED_COST]);
+    ok = ok && outSection(fp, rowLower_, rowBytes, position, section[CLP_SECTION_ROW_LOWER]);
+    ok = ok && outSection(fp, rowUpper_, rowBytes, position, section[CLP_SECTION_ROW_UPPER]);
+    ok = ok && outSection(fp, objective(), columnBytes, position, section[CLP_SECTION_OBJECTIVE]);
+    ok = ok && outSection(fp, rowObjective_, rowBytes, position, section[CLP_SECTION_ROW_OBJECTIVE]);
+    ok = ok && outSection(fp, columnLower_, columnBytes, position, section[CLP_SECTION_COLUMN_LOWER]);
+    ok = ok && outSection(fp, columnUpper_, columnBytes, position, section[CLP_SECTION_COLUMN_UPPER]);
+    if (problemStatus_ == 1)
+      ok = ok && outSection(fp, ray_, rowBytes, position, section[CLP_SECTION_RAY]);
+    else if (problemStatus_ == 2)
+      ok = ok && outSection(fp, ray_, columnBytes, position, section[CLP_SECTION_RAY]);
+    ok = ok && outSection(fp, status_, numberRows_ + numberColumns_, position, section[CLP_SECTION_STATUS]);
+#ifndef CLP_NO_STD
+    if (lengthNames_ && ok) {
       char *array = new char[CoinMax(numberRows_, numberColumns_) * (lengthNames_ + 1)];
       char *put = array;
       CoinAssert(numberRows_ == static_cast< int >(rowNames_.size()));
-      for (i = 0; i < numberRows_; i++) {
+      for (int i = 0; i < numberRows_; i++) {
         assert(static_cast< int >(rowNames_[i].size()) <= lengthNames_);
-        strcpy(put, rowNames_[i].c_str());
+        strncpy(put, rowNames_[i].c_str(), lengthNames_ + 1);
         put += lengthNames_ + 1;
       }
-      numberWritten = fwrite(array, lengthNames_ + 1, numberRows_, fp);
-      if (numberWritten != static_cast< size_t >(numberRows_))
-        return 1;
+      ok = outSection(fp, array, static_cast< CoinInt64 >(numberRows_) * (lengthNames_ + 1),
+        position, section[CLP_SECTION_ROW_NAMES]);
       put = array;
       CoinAssert(numberColumns_ == static_cast< int >(columnNames_.size()));
-      for (i = 0; i < numberColumns_; i++) {
+      for (int i = 0; i < numberColumns_; i++) {
         assert(static_cast< int >(columnNames_[i].size()) <= lengthNames_);
-        strcpy(put, columnNames_[i].c_str());
+        strncpy(put, columnNames_[i].c_str(), lengthNames_ + 1);
         put += lengthNames_ + 1;
       }
-      numberWritten = fwrite(array, lengthNames_ + 1, numberColumns_, fp);
-      if (numberWritten != static_cast< size_t >(numberColumns_)) {
-        delete[] array;
-        return 1;
-      }
+      ok = ok && outSection(fp, array, static_cast< CoinInt64 >(numberColumns_) * (lengthNames_ + 1),
+        position, section[CLP_SECTION_COLUMN_NAMES]);
+      delete[] array;
     }
 #endif
-    // integers
-    if (integerType_) {
-      int marker = 1;
-      numberWritten = fwrite(&marker, sizeof(int), 1, fp);
-      numberWritten = fwrite(integerType_, 1, numberColumns_, fp);
-      if (numberWritten != static_cast< size_t >(numberColumns_))
-        return 1;
-    } else {
-      int marker = 0;
-      numberWritten = fwrite(&marker, sizeof(int), 1, fp);
-    }
+    ok = ok && outSection(fp, integerType_, numberColumns_, position, section[CLP_SECTION_INTEGER]);
     // just standard type at present
     assert(matrix_->type() == 1);
     CoinAssert(matrix_->getNumCols() == numberColumns_);
     CoinAssert(matrix_->getNumRows() == numberRows_);
-    // we are going to save with gaps
-    length = matrix_->getVectorStarts()[numberColumns_ - 1]
-      + matrix_->getVectorLengths()[numberColumns_ - 1];
-    numberWritten = fwrite(&length, sizeof(int), 1, fp);
-    if (numberWritten != 1)
-      return 1;
-    numberWritten = fwrite(matrix_->getElements(),
-      sizeof(double), length, fp);
-    if (numberWritten != length)
-      return 1;
-    numberWritten = fwrite(matrix_->getIndices(),
-      sizeof(int), length, fp);
-    if (numberWritten != length)
-      return 1;
-    numberWritten = fwrite(matrix_->getVectorStarts(),
-      sizeof(int), numberColumns_ + 1, fp);
-    if (numberWritten != static_cast< size_t >(numberColumns_) + 1)
-      return 1;
-    numberWritten = fwrite(matrix_->getVectorLengths(),
-      sizeof(int), numberColumns_, fp);
-    if (numberWritten != static_cast< size_t >(numberColumns_))
-      return 1;
+    // save without gaps so can be used as it is
+    const double *elements = matrix_->getElements();
+    const int *indices = matrix_->getIndices();
+    const CoinBigIndex *starts = matrix_->getVectorStarts();
+    const int *lengths = matrix_->getVectorLengths();
+    CoinBigIndex numberElements = matrix_->getNumElements();
+    if (starts[numberColumns_] == numberElements) {
+      ok = ok && outSection(fp, elements, static_cast< CoinInt64 >(numberElements) * sizeof(double),
+        position, section[CLP_SECTION_ELEMENTS]);
+      ok = ok && outSection(fp, indices, static_cast< CoinInt64 >(numberElements) * sizeof(int),
+        position, section[CLP_SECTION_INDICES]);
+      ok = ok && outSection(fp, starts, static_cast< CoinInt64 >(numberColumns_ + 1) * sizeof(CoinBigIndex),
+        position, section[CLP_SECTION_STARTS]);
+    } else {
+      double *newElements = new double[numberElements];
+      int *newIndices = new int[numberElements];
+      CoinBigIndex *newStarts = new CoinBigIndex[numberColumns_ + 1];
+      CoinBigIndex n = 0;
+      for (int i = 0; i < numberColumns_; i++) {
+        newStarts[i] = n;
+        CoinMemcpyN(elements + starts[i], lengths[i], newElements + n);
+        CoinMemcpyN(indices + starts[i], lengths[i], newIndices + n);
+        n += lengths[i];
+      }
+      newStarts[numberColumns_] = n;
+      ok = ok && outSection(fp, newElements, static_cast< CoinInt64 >(n) * sizeof(double),
+        position, section[CLP_SECTION_ELEMENTS]);
+      ok = ok && outSection(fp, newIndices, static_cast< CoinInt64 >(n) * sizeof(int),
+        position, section[CLP_SECTION_INDICES]);
+      ok = ok && outSection(fp, newStarts, static_cast< CoinInt64 >(numberColumns_ + 1) * sizeof(CoinBigIndex),
+        position, section[CLP_SECTION_STARTS]);
+      delete[] newElements;
+      delete[] newIndices;
+      delete[] newStarts;
+    }
+    ok = ok && outSection(fp, lengths, static_cast< CoinInt64 >(numberColumns_) * sizeof(int),
+      position, section[CLP_SECTION_LENGTHS]);
+    // pad so last section is whole pages
+    ok = ok && alignModelFile(fp, position);
+    // header again with sections
+    ok = ok && !fseek(fp, 0, SEEK_SET);
+    ok = ok && fwrite(&header, sizeof(Clp_header), 1, fp) == 1;
     // finished
-    fclose(fp);
+    if (fclose(fp))
+      ok = false;
+#if defined(_MSC_VER) || defined(__MINGW32__)
+    if (ok)
+      remove(fileName);
+#endif
+    if (ok && rename(tempName.c_str(), fileName))
+      ok = false;
+    if (!ok) {
+      remove(tempName.c_str());
+      return 1;
+    }
     return 0;
   } else {
     return -1;
@@ -7021,12 +7111,153 @@ int inDoubleArray(double *&array, int length, FILE *fp)
   }
   return 0;
 }
+// Checks header and sections of mapped model file
+static bool goodModelFile(const ClpMappedFile *file)
+{
+  if (file->size() < sizeof(Clp_header))
+    return false;
+  const Clp_header *header = reinterpret_cast< const Clp_header * >(file->data());
+  if (header->version != CLP_MODEL_VERSION || header->endian != CLP_MODEL_ENDIAN
+    || header->sizeScalars != static_cast< int >(sizeof(Clp_scalars))
+    || header->sizeBigIndex != static_cast< int >(sizeof(CoinBigIndex))
+    || header->numberSections != CLP_NUMBER_SECTIONS)
+    return false;
+  CoinInt64 size = static_cast< CoinInt64 >(file->size());
+  for (int i = 0; i < CLP_NUMBER_SECTIONS; i++) {
+    const Clp_section &section = header->section[i];
+    if (section.offset < 0 || section.length < 0
+      || section.offset + section.length > size
+      || (section.offset % sizeof(double)))
+      return false;
+  }
+  return true;
+}
+/* Array from section of mapped model file (NULL if empty).
+   Copied if copy true, otherwise points into file */
+template < class T >
+static T *mappedArray(ClpMappedFile *file, const Clp_section &section,
+  CoinBigIndex length, bool copy, bool &ok)
+{
+  if (!section.length)
+    return NULL;
+  if (section.length != static_cast< CoinInt64 >(length) * static_cast< CoinInt64 >(sizeof(T))) {
+    ok = false;
+    return NULL;
+  }
+  T *array = reinterpret_cast< T * >(file->data() + section.offset);
+  return copy ? CoinCopyOfArray(array, length) : array;
+}
+/* Arrays from mapped model file.  Bounds and matrix stay in file,
+   everything else is copied.  Model takes reference to file */
+int ClpSimplex::restoreMappedArrays(ClpMappedFile *file)
+{
+  mappedFile_ = file;
+  const Clp_section *section = reinterpret_cast< const Clp_header * >(file->data())->section;
+  bool ok = true;
+#ifndef CLP_NO_STD
+  // strings
+  const char *get = file->data() + section[CLP_SECTION_STRINGS].offset;
+  const char *end = get + section[CLP_SECTION_STRINGS].length;
+  for (int i = 0; i < ClpLastStrParam && get < end; i++) {
+    int length;
+    if (get + sizeof(int) > end)
+      return 1;
+    memcpy(&length, get, sizeof(int));
+    get += sizeof(int);
+    if (length < 0 || get + length > end)
+      return 1;
+    strParam_[i] = std::string(get, length);
+    get += length;
+  }
+#endif
+  // arrays
+  rowActivity_ = mappedArray< double >(file, section[CLP_SECTION_ROW_ACTIVITY], numberRows_, true, ok);
+  columnActivity_ = mappedArray< double >(file, section[CLP_SECTION_COLUMN_ACTIVITY], numberColumns_, true, ok);
+  dual_ = mappedArray< double >(file, section[CLP_SECTION_DUAL], numberRows_, true, ok);
+  reducedCost_ = mappedArray< double >(file, section[CLP_SECTION_REDUCED_COST], numberColumns_, true, ok);
+  rowLower_ = mappedArray< double >(file, section[CLP_SECTION_ROW_LOWER], numberRows_, false, ok);
+  rowUpper_ = mappedArray< double >(file, section[CLP_SECTION_ROW_UPPER], numberRows_, false, ok);
+  const double *objective = mappedArray< double >(file, section[CLP_SECTION_OBJECTIVE], numberColumns_, false, ok);
+  delete objective_;
+  objective_ = new ClpLinearObjective(objective, numberColumns_);
+  rowObjective_ = mappedArray< double >(file, section[CLP_SECTION_ROW_OBJECTIVE], numberRows_, true, ok);
+  columnLower_ = mappedArray< double >(file, section[CLP_SECTION_COLUMN_LOWER], numberColumns_, false, ok);
+  columnUpper_ = mappedArray< double >(file, section[CLP_SECTION_COLUMN_UPPER], numberColumns_, false, ok);
+  if (problemStatus_ == 1)
+    ray_ = mappedArray< double >(file, section[CLP_SECTION_RAY], numberRows_, true, ok);
+  else if (problemStatus_ == 2)
+    ray_ = mappedArray< double >(file, section[CLP_SECTION_RAY], numberColumns_, true, ok);
+  else if (section[CLP_SECTION_RAY].length)
+    return 2;
+  status_ = mappedArray< unsigned char >(file, section[CLP_SECTION_STATUS], numberRows_ + numberColumns_, true, ok);
+#ifndef CLP_NO_STD
+  if (lengthNames_) {
+    int width = lengthNames_ + 1;
+    const char *names = mappedArray< char >(file, section[CLP_SECTION_ROW_NAMES], numberRows_ * width, false, ok);
+    rowNames_ = std::vector< std::string >();
+    if (names) {
+      rowNames_.reserve(numberRows_);
+      for (int i = 0; i < numberRows_; i++) {
+        const char *name = names + i * width;
+        int length = 0;
+        while (length < width && name[length])
+          length++;
+        rowNames_.push_back(std::string(name, length));
+      }
+    }
+    names = mappedArray< char >(file, section[CLP_SECTION_COLUMN_NAMES], numberColumns_ * width, false, ok);
+    columnNames_ = std::vector< std::string >();
+    if (names) {
+      columnNames_.reserve(numberColumns_);
+      for (int i = 0; i < numberColumns_; i++) {
+        const char *name = names + i * width;
+        int length = 0;
+        while (length < width && name[length])
+          length++;
+        columnNames_.push_back(std::string(name, length));
+      }
+    }
+  }
+#endif
+  // integers
+  integerType_ = mappedArray< char >(file, section[CLP_SECTION_INTEGER], numberColumns_, true, ok);
+  // matrix
+  delete matrix_;
+  CoinBigIndex numberElements = static_cast< CoinBigIndex >(section[CLP_SECTION_ELEMENTS].length / sizeof(double));
+  double *elements = mappedArray< double >(file, section[CLP_SECTION_ELEMENTS], numberElements, false, ok);
+  int *indices = mappedArray< int >(file, section[CLP_SECTION_INDICES], numberElements, false, ok);
+  CoinBigIndex *starts = mappedArray< CoinBigIndex >(file, section[CLP_SECTION_STARTS], numberColumns_ + 1, false, ok);
+  int *lengths = mappedArray< int >(file, section[CLP_SECTION_LENGTHS], numberColumns_, false, ok);
+  if (!ok || !starts || starts[numberColumns_] != numberElements)
+    return 1;
+  matrix_ = new ClpPackedMatrix(new ClpMappedMatrix(file, numberRows_, numberColumns_,
+    numberElements, elements, indices, starts, lengths));
+  return 0;
+}
 /* Restore model from file, returns 0 if success,
    deletes current model */
 int ClpSimplex::restoreModel(const char *fileName)
 {
   FILE *fp = fopen(fileName, "rb");
+  ClpMappedFile *file = NULL;
   if (fp) {
+    // current files have header and are mapped
+    char magic[8];
+    if (fread(magic, 1, 8, fp) == 8 && !memcmp(magic, CLP_MODEL_MAGIC, 8)) {
+      fclose(fp);
+      fp = NULL;
+      file = ClpMappedFile::open(fileName);
+      if (!file)
+        return -1;
+      if (!goodModelFile(file)) {
+        file->release();
+        return 2;
+      }
+    } else {
+      rewind(fp);
+    }
+  }
+  if (fp || file) {
     // Get rid of current model
     // save event handler in case already set
     ClpEventHandler *handler = eventHandler_->clone();
@@ -7046,9 +7277,13 @@ int ClpSimplex::restoreModel(const char *fileName)
     size_t numberRead;
 
     // get scalars
-    numberRead = fread(&scalars, sizeof(Clp_scalars), 1, fp);
-    if (numberRead != 1)
-      return 1;
+    if (file) {
+      scalars = reinterpret_cast< const Clp_header * >(file->data())->scalars;
+    } else {
+      numberRead = fread(&scalars, sizeof(Clp_scalars), 1, fp);
+      if (numberRead != 1)
+        return 1;
+    }
     // Fill in scalars
     optimizationDirection_ = scalars.optimizationDirection;
     CoinMemcpyN(scalars.dblParam, ClpLastDblParam, dblParam_);
@@ -7074,6 +7309,41 @@ int ClpSimplex::restoreModel(const char *fileName)
     scalingFlag_ = scalars.scalingFlag;
     algorithm_ = scalars.algorithm;
     specialOptions_ = scalars.specialOptions;
+    // Pivot choices
+    assert(scalars.dualPivotChoice > 0 && (scalars.dualPivotChoice & 63) < 3);
+    delete dualRowPivot_;
+    switch ((scalars.dualPivotChoice & 63)) {
+    default:
+      printf("Need another dualPivot case %d\n", scalars.dualPivotChoice & 63);
+    case 1:
+      // Dantzig
+      dualRowPivot_ = new ClpDualRowDantzig();
+      break;
+    case 2:
+      // Steepest - use mode
+      dualRowPivot_ = new ClpDualRowSteepest(scalars.dualPivotChoice >> 6);
+      break;
+    }
+    assert(scalars.primalPivotChoice > 0 && (scalars.primalPivotChoice & 63) < 3);
+    delete primalColumnPivot_;
+    switch ((scalars.primalPivotChoice & 63)) {
+    default:
+      printf("Need another primalPivot case %d\n",
+        scalars.primalPivotChoice & 63);
+    case 1:
+      // Dantzig
+      primalColumnPivot_ = new ClpPrimalColumnDantzig();
+      break;
+    case 2:
+      // Steepest - use mode
+      primalColumnPivot_
+        = new ClpPrimalColumnSteepest(scalars.primalPivotChoice >> 6);
+      break;
+    }
+    if (file) {
+      // model takes reference
+      return restoreMappedArrays(file);
+    }
     // strings
     CoinBigIndex length;
 #ifndef CLP_NO_STD
@@ -7192,37 +7462,6 @@ int ClpSimplex::restoreModel(const char *fileName)
         length = ifInteger;
       }
     }
-    // Pivot choices
-    assert(scalars.dualPivotChoice > 0 && (scalars.dualPivotChoice & 63) < 3);
-    delete dualRowPivot_;
-    switch ((scalars.dualPivotChoice & 63)) {
-    default:
-      printf("Need another dualPivot case %d\n", scalars.dualPivotChoice & 63);
-    case 1:
-      // Dantzig
-      dualRowPivot_ = new ClpDualRowDantzig();
-      break;
-    case 2:
-      // Steepest - use mode
-      dualRowPivot_ = new ClpDualRowSteepest(scalars.dualPivotChoice >> 6);
-      break;
-    }
-    assert(scalars.primalPivotChoice > 0 && (scalars.primalPivotChoice & 63) < 3);
-    delete primalColumnPivot_;
-    switch ((scalars.primalPivotChoice & 63)) {
-    default:
-      printf("Need another primalPivot case %d\n",
-        scalars.primalPivotChoice & 63);
-    case 1:
-      // Dantzig
-      primalColumnPivot_ = new ClpPrimalColumnDantzig();
-      break;
-    case 2:
-      // Steepest - use mode
-      primalColumnPivot_
-        = new ClpPrimalColumnSteepest(scalars.primalPivotChoice >> 6);
-      break;
-    }
     assert(scalars.matrixStorageChoice == 1);
     delete matrix_;
     // get arrays
@@ -7635,6 +7874,15 @@ int ClpSimplex::readMps(const char *filename,
   createStatus();
   return status;
 }
+// Read an mps file in one pass building packed matrix directly
+int ClpSimplex::readMpsStream(const char *filename,
+  bool keepNames,
+  bool ignoreErrors)
+{
+  int status = ClpModel::readMpsStream(filename, keepNames, ignoreErrors);
+  createStatus();
+  return status;
+}
 // Read GMPL files from the given filenames
 int ClpSimplex::readGMPL(const char *filename, const char *dataName,
   bool keepNames)
@@ -9305,6 +9553,17 @@ void ClpSimplex::finish(int startFinishOptions)
         << objectiveValue()
         << CoinMessageEol;
     }
+    const int *densityCount = factorization_->densityCounts();
+    int numberSolves = 0;
+    for (int i = 0; i < 8; i++)
+      numberSolves += densityCount[i];
+    if (numberSolves) {
+      handler_->message(CLP_FACTORIZATION_DENSITY, messages_);
+      for (int i = 0; i < 8; i++)
+        *handler_ << densityCount[i];
+      *handler_ << CoinMessageEol;
+    }
+    factorization_->clearDensityCounts();
   }
   factorization_->relaxAccuracyCheck(1.0);
   // get rid of any network stuff - could do more
@@ -9999,63 +10258,95 @@ void ClpSimplex::getBInvRow(int row, double *z)
 
 //Get a column of the tableau
 void ClpSimplex::getBInvACol(int col, double *vec)
+{
+  getBInvACols(1, &col, vec);
+}
+
+// Most columns updated together in getBInvACols
+#define CLP_TABLEAU_BLOCK 16
+//Get columns of the tableau
+void ClpSimplex::getBInvACols(int numberCols, const int *cols, double *vec)
 {
   if (!rowArray_[0]) {
     printf("ClpSimplexPrimal or ClpSimplexDual should have been called with correct startFinishOption\n");
     abort();
   }
   CoinIndexedVector *rowArray0 = rowArray(0);
-  CoinIndexedVector *rowArray1 = rowArray(1);
   rowArray0->clear();
-  rowArray1->clear();
-  // get column of matrix
-#ifndef NDEBUG
-  int n = numberColumns_ + numberRows_;
-  if (col < 0 || col >= n) {
-    indexError(col, "getBInvACol");
+  // columns are updated a block at a time
+  int maximumBlock = CoinMin(numberCols, CLP_TABLEAU_BLOCK);
+  CoinIndexedVector **block = new CoinIndexedVector *[maximumBlock];
+  for (int k = 0; k < maximumBlock; k++) {
+    if (k) {
+      block[k] = new CoinIndexedVector();
+      block[k]->reserve(rowArray(1)->capacity());
+    } else {
+      block[k] = rowArray(1);
+      block[k]->clear();
+    }
   }
+  for (int iStart = 0; iStart < numberCols; iStart += maximumBlock) {
+    int numberBlock = CoinMin(maximumBlock, numberCols - iStart);
+    for (int k = 0; k < numberBlock; k++) {
+      int col = cols[iStart + k];
+      CoinIndexedVector *rowArray1 = block[k];
+      // get column of matrix
+#ifndef NDEBUG
+      int n = numberColumns_ + numberRows_;
+      if (col < 0 || col >= n) {
+        indexError(col, "getBInvACol");
+      }
 #endif
-  if (!rowScale_) {
-    if (col < numberColumns_) {
-      unpack(rowArray1, col);
-    } else {
-      rowArray1->insert(col - numberColumns_, 1.0);
+      if (!rowScale_) {
+        if (col < numberColumns_) {
+          unpack(rowArray1, col);
+        } else {
+          rowArray1->insert(col - numberColumns_, 1.0);
+        }
+      } else {
+        if (col < numberColumns_) {
+          unpack(rowArray1, col);
+          double multiplier = 1.0 * inverseColumnScale_[col];
+          int number = rowArray1->getNumElements();
+          int *index = rowArray1->getIndices();
+          double *array = rowArray1->denseVector();
+          for (int i = 0; i < number; i++) {
+            int iRow = index[i];
+            // make sure not packed
+            assert(array[iRow]);
+            array[iRow] *= multiplier;
+          }
+        } else {
+          rowArray1->insert(col - numberColumns_, rowScale_[col - numberColumns_]);
+        }
+      }
     }
-  } else {
-    if (col < numberColumns_) {
-      unpack(rowArray1, col);
-      double multiplier = 1.0 * inverseColumnScale_[col];
-      int number = rowArray1->getNumElements();
-      int *index = rowArray1->getIndices();
+    factorization_->updateColumns(rowArray0, numberBlock, block);
+    for (int k = 0; k < numberBlock; k++) {
+      CoinIndexedVector *rowArray1 = block[k];
+      double *vecK = vec + static_cast< size_t >(iStart + k) * numberRows_;
+      // But swap if pivot variable was slack as clp stores slack as -1.0
       double *array = rowArray1->denseVector();
-      for (int i = 0; i < number; i++) {
-        int iRow = index[i];
-        // make sure not packed
-        assert(array[iRow]);
-        array[iRow] *= multiplier;
+      if (!rowScale_) {
+        for (int i = 0; i < numberRows_; i++) {
+          double multiplier = (pivotVariable_[i] < numberColumns_) ? 1.0 : -1.0;
+          vecK[i] = multiplier * array[i];
+        }
+      } else {
+        for (int i = 0; i < numberRows_; i++) {
+          int pivot = pivotVariable_[i];
+          if (pivot < numberColumns_)
+            vecK[i] = array[i] * columnScale_[pivot];
+          else
+            vecK[i] = -array[i] / rowScale_[pivot - numberColumns_];
+        }
       }
-    } else {
-      rowArray1->insert(col - numberColumns_, rowScale_[col - numberColumns_]);
-    }
-  }
-  factorization_->updateColumn(rowArray0, rowArray1, false);
-  // But swap if pivot variable was slack as clp stores slack as -1.0
-  double *array = rowArray1->denseVector();
-  if (!rowScale_) {
-    for (int i = 0; i < numberRows_; i++) {
-      double multiplier = (pivotVariable_[i] < numberColumns_) ? 1.0 : -1.0;
-      vec[i] = multiplier * array[i];
-    }
-  } else {
-    for (int i = 0; i < numberRows_; i++) {
-      int pivot = pivotVariable_[i];
-      if (pivot < numberColumns_)
-        vec[i] = array[i] * columnScale_[pivot];
-      else
-        vec[i] = -array[i] / rowScale_[pivot - numberColumns_];
+      rowArray1->clear();
     }
   }
-  rowArray1->clear();
+  for (int k = 1; k < maximumBlock; k++)
+    delete block[k];
+  delete[] block;
 }
 
 //Get a column of the basis inverse
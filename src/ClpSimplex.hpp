@@ -53,7 +53,9 @@ class AbcSimplex;
 #endif
 #ifndef ABC_INHERIT
 #if ABOCA_LITE
-#ifndef FAKE_CILK
+/* CLP_THREAD_POOL - parallel parts use portable worker pool
+   (see clpParallelRun in ClpHelperFunctions) rather than cilk */
+#if !defined(FAKE_CILK) && !defined(CLP_THREAD_POOL)
 #include <cilk/cilk.h>
 #else
 #undef cilk_for
@@ -266,6 +268,10 @@ public:
   int readMps(const char *filename,
     bool keepNames = false,
     bool ignoreErrors = false);
+  /// Read an mps file in one pass building packed matrix directly
+  int readMpsStream(const char *filename,
+    bool keepNames = false,
+    bool ignoreErrors = false);
   /// Read GMPL files from the given filenames
   int readGMPL(const char *filename, const char *dataName,
     bool keepNames = false);
@@ -514,8 +520,18 @@ public:
     bool writeValues = false,
     int formatType = 0) const;
   /** Read a basis from the given filename,
-         returns -1 on file error, 0 if no values, 1 if values */
+         returns -1 on file error, 0 if no values, 1 if values.
+         Binary snapshots from writeBinaryBasis are recognized */
   int readBasis(const char *filename);
+  /** Write a binary snapshot of basis (packed status, model hash and
+         if writeValues primal and dual values).  Much smaller and faster
+         than writeBasis for restarts of large models.
+         Returns non-zero on I/O error */
+  int writeBinaryBasis(const char *filename,
+    bool writeValues = true) const;
+  /** Read a binary basis snapshot.  Returns -1 on file error,
+         -2 if for a different model, 0 if no values, 1 if values */
+  int readBinaryBasis(const char *filename);
   /// Returns a basis (to be deleted by user)
   CoinWarmStartBasis *getBasis() const;
   /// Passes in factorization
@@ -576,6 +592,22 @@ public:
     bool stopOnFirstInfeasible = true,
     bool alwaysFinish = false,
     int startFinishOptions = 0);
+  /** Parallel version of strongBranching.  Candidates are split over
+         numberThreads (0 means clpParallelThreads()) workers and each
+         worker uses its own copy of the model - so its own factorization.
+         The model itself is not changed.  Each copy keeps this model's
+         iteration limit.  Outputs and return code are as for
+         strongBranching (except solutions for candidates after a stop
+         may be overwritten).
+     */
+  int parallelStrongBranching(int numberThreads,
+    int numberVariables, const int *variables,
+    double *newLower, double *newUpper,
+    double **outputSolution,
+    int *outputStatus, int *outputIterations,
+    bool stopOnFirstInfeasible = true,
+    bool alwaysFinish = false,
+    int startFinishOptions = 0);
   /// Fathom - 1 if solution
   int fathom(void *stuff);
   /** Do up to N deep - returns
@@ -795,7 +827,10 @@ public:
      */
   int saveModel(const char *fileName);
   /** Restore model from file, returns 0 if success,
-         deletes current model */
+         deletes current model.  Files from saveModel are mapped so
+         bounds and matrix are not read in - pages are copied by system
+         if changed and arrays copied if model changes size (see
+         ClpModel::unmapModel).  Older files are read in as before */
   int restoreModel(const char *fileName);
 
   /** Just check solution (for external use) - sets sum of
@@ -1102,6 +1137,8 @@ protected:
     bool valuesPass = false);
   /// Does most of deletion (0 = all, 1 = most, 2 most + factorization)
   void gutsOfDelete(int type);
+  /// Arrays for restoreModel from mapped file
+  int restoreMappedArrays(ClpMappedFile *file);
   /// Does most of copying
   void gutsOfCopy(const ClpSimplex &rhs);
   /** puts in format I like (rowLower,rowUpper) also see StandardMatrix
@@ -1419,6 +1456,7 @@ public:
 	 4194304 bit - tolerances have been changed by code
 	 8388608 bit - tolerances are dynamic (at first)
 	 16777216 bit - if factorization kept can still declare optimal at once
+	 33554432 bit - refactorize when measured time per iteration is least
      */
   inline int moreSpecialOptions() const
   {
@@ -1454,6 +1492,7 @@ public:
 	 4194304 bit - tolerances have been changed by code
 	 8388608 bit - tolerances are dynamic (at first)
 	 16777216 bit - if factorization kept can still declare optimal at once
+	 33554432 bit - refactorize when measured time per iteration is least
      */
   inline void setMoreSpecialOptions(int value)
   {
@@ -1635,6 +1674,10 @@ public:
   ///Get a column of the tableau
   void getBInvACol(int col, double *vec);
 
+  /** Get columns of the tableau - column k of cols goes in
+         vec+k*numberRows.  Columns are updated a block at a time */
+  void getBInvACols(int numberCols, const int *cols, double *vec);
+
   ///Get a column of the basis inverse
   void getBInvCol(int col, double *vec);
 
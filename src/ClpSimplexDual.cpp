@@ -2449,10 +2449,8 @@ int ClpSimplexDual::updateDualsInDual(CoinIndexedVector *rowArray,
           info[i].numberToDo = CoinMin(chunk, number - n);
           n += chunk;
         }
-        for (i = 0; i < numberThreads; i++) {
-          cilk_spawn updateDualBit(info[i]);
-        }
-        cilk_sync;
+        // chunks flip bounds independently - merged in order below
+        clpParallelFor(updateDualBit, info, numberThreads);
         for (i = 0; i < numberThreads; i++) {
           int n = info[i].numberInfeasibilities;
           double *workV = info[i].work;
@@ -3485,10 +3483,7 @@ dualColumn00(clpTempInfo &info)
 static void
 dualColumn000(int numberThreads, clpTempInfo *info)
 {
-  for (int i = 0; i < numberThreads; i++) {
-    cilk_spawn dualColumn00(info[i]);
-  }
-  cilk_sync;
+  clpParallelFor(dualColumn00, info, numberThreads);
 }
 void moveAndZero(clpTempInfo *info, int type, void *extra)
 {
@@ -6756,6 +6751,8 @@ int ClpSimplexDual::perturb()
    ways and +1 if infeasible one way (check values to see which one(s))
    Returns -2 if bad factorization
 */
+// Most candidate columns updated together in strongBranching
+#define CLP_STRONG_BLOCK 16
 int ClpSimplexDual::strongBranching(int numberVariables, const int *variables,
   double *newLower, double *newUpper,
   double **outputSolution,
@@ -6812,6 +6809,43 @@ int ClpSimplexDual::strongBranching(int numberVariables, const int *variables,
   double changeCost;
   changeBounds(3, NULL, changeCost);
   int saveNumberFake = numberFake_;
+  /* A nonbasic candidate may be able to go to its new bound without any
+     iterations.  Updated columns for those are got a block at a time
+     as candidates are reached. */
+  bool tryMove = false;
+  for (i = 0; i < numberVariables; i++) {
+    int iColumn = variables[i];
+    Status status = getStatus(iColumn);
+    if ((status == atLowerBound || status == atUpperBound) && getFakeBound(iColumn) == noFake) {
+      tryMove = true;
+      break;
+    }
+  }
+  if (tryMove) {
+    // same tolerances as fastDual
+    dualTolerance_ = dblParam_[ClpDualTolerance];
+    primalTolerance_ = dblParam_[ClpPrimalTolerance];
+    gutsOfSolution(NULL, NULL);
+    // only any good if basis dual feasible
+    if (numberDualInfeasibilities_)
+      tryMove = false;
+  }
+  int maximumBlock = 0;
+  CoinIndexedVector **block = NULL;
+  int *whichBlock = NULL;
+  CoinIndexedVector *work = NULL;
+  if (tryMove) {
+    maximumBlock = CoinMin(numberVariables, CLP_STRONG_BLOCK);
+    block = new CoinIndexedVector *[maximumBlock];
+    for (int k = 0; k < maximumBlock; k++) {
+      block[k] = new CoinIndexedVector();
+      block[k]->reserve(rowArray_[1]->capacity());
+    }
+    work = new CoinIndexedVector();
+    work->reserve(rowArray_[0]->capacity());
+    whichBlock = new int[numberVariables];
+  }
+  int nextBlock = 0;
   // save basis and solution
   double *saveSolution = new double[numberRows_ + numberColumns_];
   CoinMemcpyN(solution_,
@@ -6837,6 +6871,25 @@ int ClpSimplexDual::strongBranching(int numberVariables, const int *variables,
     int iColumn = variables[i];
     double objectiveChange;
     double saveBound;
+    if (tryMove && i == nextBlock) {
+      // update next block of nonbasic candidates
+      int numberBlock = 0;
+      for (nextBlock = i; nextBlock < numberVariables; nextBlock++) {
+        int jColumn = variables[nextBlock];
+        Status status = getStatus(jColumn);
+        whichBlock[nextBlock] = -1;
+        if ((status == atLowerBound || status == atUpperBound) && getFakeBound(jColumn) == noFake) {
+          if (numberBlock == maximumBlock)
+            break;
+          block[numberBlock]->clear();
+          unpack(block[numberBlock], jColumn);
+          whichBlock[nextBlock] = numberBlock++;
+        }
+      }
+      if (numberBlock)
+        factorization_->updateColumns(work, numberBlock, block);
+    }
+    CoinIndexedVector *column = (tryMove && whichBlock[i] >= 0) ? block[whichBlock[i]] : NULL;
 
     // try down
 
@@ -6848,8 +6901,11 @@ int ClpSimplexDual::strongBranching(int numberVariables, const int *variables,
       upper_[iColumn] = newUpper[i] * rhsScale_;
     else
       upper_[iColumn] = (newUpper[i] * inverseColumnScale_[iColumn]) * rhsScale_; // scale
-    // Start of fast iterations
-    int status = fastDual(alwaysFinish);
+    int status;
+    if (column && strongBranchingMove(iColumn, column, saveSolution))
+      status = 0;
+    else
+      status = fastDual(alwaysFinish); // Start of fast iterations
     CoinAssert(problemStatus_ || objectiveValue_ < 1.0e50);
 #ifdef CLP_DEBUG
     printf("first status %d obj %g\n", problemStatus_, objectiveValue_);
@@ -6920,8 +6976,10 @@ int ClpSimplexDual::strongBranching(int numberVariables, const int *variables,
       lower_[iColumn] = newLower[i] * rhsScale_;
     else
       lower_[iColumn] = (newLower[i] * inverseColumnScale_[iColumn]) * rhsScale_; // scale
-    // Start of fast iterations
-    status = fastDual(alwaysFinish);
+    if (column && strongBranchingMove(iColumn, column, saveSolution))
+      status = 0;
+    else
+      status = fastDual(alwaysFinish); // Start of fast iterations
     CoinAssert(problemStatus_ || objectiveValue_ < 1.0e50);
 #ifdef CLP_DEBUG
     printf("second status %d obj %g\n", problemStatus_, objectiveValue_);
@@ -7017,6 +7075,11 @@ int ClpSimplexDual::strongBranching(int numberVariables, const int *variables,
   delete[] saveObjective;
   delete[] saveStatus;
   delete[] savePivot;
+  for (int k = 0; k < maximumBlock; k++)
+    delete block[k];
+  delete[] block;
+  delete work;
+  delete[] whichBlock;
   if ((startFinishOptions & 1) == 0) {
     deleteRim(1);
     whatsChanged_ &= ~0xffff;
@@ -7031,6 +7094,163 @@ int ClpSimplexDual::strongBranching(int numberVariables, const int *variables,
   objectiveValue_ = saveObjectiveValue;
   return returnCode;
 }
+/* For strong branching.  iSequence is nonbasic with new bound in
+   lower_/upper_.  If it can go to that bound with all variables staying
+   feasible then, as basis was dual feasible, it is still optimal.
+*/
+bool ClpSimplexDual::strongBranchingMove(int iSequence, const CoinIndexedVector *column,
+  const double *saveSolution)
+{
+  double newValue = (getStatus(iSequence) == atUpperBound) ? upper_[iSequence] : lower_[iSequence];
+  double movement = newValue - solution_[iSequence];
+  if (movement) {
+    const double *work = column->denseVector();
+    const int *which = column->getIndices();
+    int number = column->getNumElements();
+    for (int i = 0; i < number; i++) {
+      int iRow = which[i];
+      int iPivot = pivotVariable_[iRow];
+      solution_[iPivot] -= movement * work[iRow];
+    }
+    solution_[iSequence] = newValue;
+  }
+  double saveObjectiveValue = objectiveValue_;
+  checkPrimalSolution(rowActivityWork_, columnActivityWork_);
+  if (numberPrimalInfeasibilities_) {
+    // have to iterate
+    CoinMemcpyN(saveSolution, numberRows_ + numberColumns_, solution_);
+    objectiveValue_ = saveObjectiveValue;
+    return false;
+  }
+  problemStatus_ = 0;
+  numberIterations_ = 0;
+  return true;
+}
+/* For parallel strong branching - one per worker.
+   Each worker has its own copy of model (so own factorization) */
+typedef struct {
+  ClpSimplex *model;
+  const int *variables;
+  double *newLower;
+  double *newUpper;
+  double **outputSolution;
+  int *outputStatus;
+  int *outputIterations;
+  int numberVariables;
+  int startFinishOptions;
+  int returnCode;
+  bool stopOnFirstInfeasible;
+  bool alwaysFinish;
+} clpStrongInfo;
+static void
+strongBranchingBit(void *data, int which)
+{
+  clpStrongInfo *info = reinterpret_cast< clpStrongInfo * >(data) + which;
+  if (!info->numberVariables)
+    return;
+  info->returnCode = static_cast< ClpSimplexDual * >(info->model)->strongBranching(info->numberVariables, info->variables,
+    info->newLower, info->newUpper, info->outputSolution,
+    info->outputStatus, info->outputIterations,
+    info->stopOnFirstInfeasible, info->alwaysFinish,
+    info->startFinishOptions);
+}
+/* Parallel version of strongBranching.
+   Candidates are split into numberThreads contiguous slices and each
+   slice is done on a copy of model.  Results are put back in candidate
+   order and stop at same place as serial version would.
+*/
+int ClpSimplexDual::parallelStrongBranching(int numberThreads,
+  int numberVariables, const int *variables,
+  double *newLower, double *newUpper,
+  double **outputSolution,
+  int *outputStatus, int *outputIterations,
+  bool stopOnFirstInfeasible,
+  bool alwaysFinish,
+  int startFinishOptions)
+{
+  if (numberThreads <= 0)
+    numberThreads = clpParallelThreads();
+  numberThreads = CoinMin(numberThreads, numberVariables);
+  if (numberThreads < 2)
+    return strongBranching(numberVariables, variables,
+      newLower, newUpper, outputSolution,
+      outputStatus, outputIterations,
+      stopOnFirstInfeasible, alwaysFinish, startFinishOptions);
+  // workers write to copies so unused entries are left alone
+  double *tempLower = CoinCopyOfArray(newLower, numberVariables);
+  double *tempUpper = CoinCopyOfArray(newUpper, numberVariables);
+  int *tempStatus = new int[2 * numberVariables];
+  int *tempIterations = new int[2 * numberVariables];
+  clpStrongInfo *info = new clpStrongInfo[numberThreads];
+  CoinMessageHandler *handler = new CoinMessageHandler[numberThreads];
+  for (int i = 0; i < numberThreads; i++) {
+    int first = (i * numberVariables) / numberThreads;
+    int last = ((i + 1) * numberVariables) / numberThreads;
+    // copy has its own factorization and work arrays
+    info[i].model = new ClpSimplex(*this);
+    // messages would get mixed up
+    handler[i].setLogLevel(0);
+    info[i].model->passInMessageHandler(handler + i);
+    info[i].variables = variables + first;
+    info[i].newLower = tempLower + first;
+    info[i].newUpper = tempUpper + first;
+    info[i].outputSolution = outputSolution ? outputSolution + 2 * first : NULL;
+    info[i].outputStatus = tempStatus + 2 * first;
+    info[i].outputIterations = tempIterations + 2 * first;
+    info[i].numberVariables = last - first;
+    // copy is thrown away so no need to keep rim
+    info[i].startFinishOptions = startFinishOptions & ~1;
+    info[i].returnCode = 0;
+    info[i].stopOnFirstInfeasible = stopOnFirstInfeasible;
+    info[i].alwaysFinish = alwaysFinish;
+  }
+  clpParallelRun(strongBranchingBit, info, numberThreads);
+  int returnCode = 0;
+  for (int i = 0; i < numberThreads; i++) {
+    if (info[i].returnCode == -2)
+      returnCode = -2;
+  }
+  if (!returnCode) {
+    /* Every candidate up to first one where serial code would
+       have stopped has been done by some worker */
+    for (int i = 0; i < numberVariables; i++) {
+      newLower[i] = tempLower[i];
+      newUpper[i] = tempUpper[i];
+      outputStatus[2 * i] = tempStatus[2 * i];
+      outputStatus[2 * i + 1] = tempStatus[2 * i + 1];
+      outputIterations[2 * i] = tempIterations[2 * i];
+      outputIterations[2 * i + 1] = tempIterations[2 * i + 1];
+      if (newUpper[i] < 1.0e100) {
+        if (newLower[i] >= 1.0e100) {
+          // up feasible, down infeasible
+          returnCode = 1;
+          if (stopOnFirstInfeasible)
+            break;
+        }
+      } else {
+        if (newLower[i] < 1.0e100) {
+          // down feasible, up infeasible
+          returnCode = 1;
+          if (stopOnFirstInfeasible)
+            break;
+        } else {
+          // neither side feasible
+          returnCode = -1;
+          break;
+        }
+      }
+    }
+  }
+  for (int i = 0; i < numberThreads; i++)
+    delete info[i].model;
+  delete[] handler;
+  delete[] info;
+  delete[] tempLower;
+  delete[] tempUpper;
+  delete[] tempStatus;
+  delete[] tempIterations;
+  return returnCode;
+}
 // treat no pivot as finished (unless interesting)
 int ClpSimplexDual::fastDual(bool alwaysFinish)
 {
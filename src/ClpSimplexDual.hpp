@@ -130,6 +130,22 @@ public:
     bool stopOnFirstInfeasible = true,
     bool alwaysFinish = false,
     int startFinishOptions = 0);
+  /** Parallel version of strongBranching.  Candidates are split over
+         numberThreads (0 means clpParallelThreads()) workers and each
+         worker uses its own copy of the model - so its own factorization.
+         The model itself is not changed.  Each copy keeps this model's
+         iteration limit.  Outputs and return code are as for
+         strongBranching (except solutions for candidates after a stop
+         may be overwritten).
+     */
+  int parallelStrongBranching(int numberThreads,
+    int numberVariables, const int *variables,
+    double *newLower, double *newUpper,
+    double **outputSolution,
+    int *outputStatus, int *outputIterations,
+    bool stopOnFirstInfeasible = true,
+    bool alwaysFinish = false,
+    int startFinishOptions = 0);
   /// This does first part of StrongBranching
   ClpFactorization *setupForStrongBranching(char *arrays, int numberRows,
     int numberColumns, bool solveLp = false);
@@ -276,6 +292,14 @@ public:
          normal.  Returns 0 if finished properly, 1 otherwise.
      */
   int fastDual(bool alwaysFinish = false);
+  /** For strong branching.  iSequence is nonbasic with new bound already
+         in lower_/upper_ and column is its updated column.  If moving it to
+         the bound leaves everything feasible then basis is still optimal,
+         solution_ and objectiveValue_ are updated and true is returned.
+         Otherwise solution_ is restored from saveSolution.
+     */
+  bool strongBranchingMove(int iSequence, const CoinIndexedVector *column,
+    const double *saveSolution);
   /** Checks number of variables at fake bounds.  This is used by fastDual
          so can exit gracefully before end */
   int numberAtFakeBound();
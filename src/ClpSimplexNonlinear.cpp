@@ -2701,7 +2701,7 @@ int ClpSimplexNonlinear::primalDualCuts(char *rowsIn, int startUp, int algorithm
         // and pad out with random rows
         double ratio = ((double)(smallNumberRows - numberSort)) / ((double)numberRows_);
         for (int iRow = 0; iRow < numberRows_; iRow++) {
-          if (weight[iRow] == 1.123e50 && CoinDrand48() < ratio)
+          if (weight[iRow] == 1.123e50 && randomNumberGenerator_.randomDouble() < ratio)
             sort[numberSort++] = iRow;
         }
         // sort
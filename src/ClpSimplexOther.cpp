@@ -14,6 +14,7 @@
 #include "ClpEventHandler.hpp"
 #include "ClpHelperFunctions.hpp"
 #include "ClpFactorization.hpp"
+#include "ClpCholeskyBase.hpp"
 #include "ClpDualRowDantzig.hpp"
 #include "ClpNonLinearCost.hpp"
 #include "ClpDynamicMatrix.hpp"
@@ -38,6 +39,8 @@
 #define COIN_ANY_SHIFT_PER_INT 5
 #define COIN_ANY_MASK_PER_INT 0x1f
 #endif
+// Most columns updated together in primal ranging
+#define CLP_RANGING_BLOCK 16
 /* Dual ranging.
    This computes increase/decrease in cost for each given variable and corresponding
    sequence numbers which would change basis.  Sequence numbers are 0..numberColumns
@@ -389,73 +392,97 @@ void ClpSimplexOther::primalRanging(int numberCheck, const int *which,
   lowerIn_ = -COIN_DBL_MAX;
   upperIn_ = COIN_DBL_MAX;
   valueIn_ = 0.0;
-  for (int i = 0; i < numberCheck; i++) {
-    int iSequence = which[i];
-    double valueIncrease = COIN_DBL_MAX;
-    double valueDecrease = COIN_DBL_MAX;
-    int sequenceIncrease = -1;
-    int sequenceDecrease = -1;
-
-    switch (getStatus(iSequence)) {
-
-    case basic:
-    case isFree:
-    case superBasic:
-      // Easy
-      valueDecrease = CoinMax(0.0, upper_[iSequence] - solution_[iSequence]);
-      valueIncrease = CoinMax(0.0, solution_[iSequence] - lower_[iSequence]);
-      sequenceDecrease = iSequence;
-      sequenceIncrease = iSequence;
-      break;
-    case isFixed:
-    case atUpperBound:
-    case atLowerBound: {
-      // Non trivial
-      // Other bound is ignored
+  // Non trivial columns are updated a block at a time
+  int maximumBlock = CoinMin(numberCheck, CLP_RANGING_BLOCK);
+  CoinIndexedVector **block = new CoinIndexedVector *[maximumBlock];
+  for (int i = 0; i < maximumBlock; i++) {
+    block[i] = new CoinIndexedVector();
+    block[i]->reserve(rowArray_[1]->capacity());
+  }
+  for (int iStart = 0; iStart < numberCheck; iStart += maximumBlock) {
+    int iEnd = CoinMin(numberCheck, iStart + maximumBlock);
+    int numberBlock = 0;
+    for (int i = iStart; i < iEnd; i++) {
+      int iSequence = which[i];
+      Status status = getStatus(iSequence);
+      if (status == isFixed || status == atUpperBound || status == atLowerBound) {
 #ifndef COIN_FAC_NEW
-      unpackPacked(rowArray_[1], iSequence);
+        unpackPacked(block[numberBlock++], iSequence);
 #else
-      unpack(rowArray_[1], iSequence);
+        unpack(block[numberBlock++], iSequence);
 #endif
-      factorization_->updateColumn(rowArray_[2], rowArray_[1]);
-      // Get extra rows
-      matrix_->extendUpdated(this, rowArray_[1], 0);
-      // do ratio test
-      checkPrimalRatios(rowArray_[1], 1);
-      if (pivotRow_ >= 0) {
-        valueIncrease = theta_;
-        sequenceIncrease = pivotVariable_[pivotRow_];
-      }
-      checkPrimalRatios(rowArray_[1], -1);
-      if (pivotRow_ >= 0) {
-        valueDecrease = theta_;
-        sequenceDecrease = pivotVariable_[pivotRow_];
       }
-      rowArray_[1]->clear();
-    } break;
     }
-    double scaleFactor;
-    if (rowScale_) {
-      if (iSequence < numberColumns_)
-        scaleFactor = columnScale_[iSequence] / rhsScale_;
+    if (numberBlock)
+      factorization_->updateColumns(rowArray_[2], numberBlock, block);
+    numberBlock = 0;
+    for (int i = iStart; i < iEnd; i++) {
+      int iSequence = which[i];
+      double valueIncrease = COIN_DBL_MAX;
+      double valueDecrease = COIN_DBL_MAX;
+      int sequenceIncrease = -1;
+      int sequenceDecrease = -1;
+
+      switch (getStatus(iSequence)) {
+
+      case basic:
+      case isFree:
+      case superBasic:
+        // Easy
+        valueDecrease = CoinMax(0.0, upper_[iSequence] - solution_[iSequence]);
+        valueIncrease = CoinMax(0.0, solution_[iSequence] - lower_[iSequence]);
+        sequenceDecrease = iSequence;
+        sequenceIncrease = iSequence;
+        break;
+      case isFixed:
+      case atUpperBound:
+      case atLowerBound: {
+        // Non trivial
+        // Other bound is ignored
+        // Already updated
+        CoinIndexedVector *column = block[numberBlock++];
+        // Get extra rows
+        matrix_->extendUpdated(this, column, 0);
+        // do ratio test
+        checkPrimalRatios(column, 1);
+        if (pivotRow_ >= 0) {
+          valueIncrease = theta_;
+          sequenceIncrease = pivotVariable_[pivotRow_];
+        }
+        checkPrimalRatios(column, -1);
+        if (pivotRow_ >= 0) {
+          valueDecrease = theta_;
+          sequenceDecrease = pivotVariable_[pivotRow_];
+        }
+        column->clear();
+      } break;
+      }
+      double scaleFactor;
+      if (rowScale_) {
+        if (iSequence < numberColumns_)
+          scaleFactor = columnScale_[iSequence] / rhsScale_;
+        else
+          scaleFactor = 1.0 / (rowScale_[iSequence - numberColumns_] * rhsScale_);
+      } else {
+        scaleFactor = 1.0 / rhsScale_;
+      }
+      if (valueIncrease < 1.0e30)
+        valueIncrease *= scaleFactor;
       else
-        scaleFactor = 1.0 / (rowScale_[iSequence - numberColumns_] * rhsScale_);
-    } else {
-      scaleFactor = 1.0 / rhsScale_;
+        valueIncrease = COIN_DBL_MAX;
+      if (valueDecrease < 1.0e30)
+        valueDecrease *= scaleFactor;
+      else
+        valueDecrease = COIN_DBL_MAX;
+      valueIncreased[i] = valueIncrease;
+      sequenceIncreased[i] = sequenceIncrease;
+      valueDecreased[i] = valueDecrease;
+      sequenceDecreased[i] = sequenceDecrease;
     }
-    if (valueIncrease < 1.0e30)
-      valueIncrease *= scaleFactor;
-    else
-      valueIncrease = COIN_DBL_MAX;
-    if (valueDecrease < 1.0e30)
-      valueDecrease *= scaleFactor;
-    else
-      valueDecrease = COIN_DBL_MAX;
-    valueIncreased[i] = valueIncrease;
-    sequenceIncreased[i] = sequenceIncrease;
-    valueDecreased[i] = valueDecrease;
-    sequenceDecreased[i] = sequenceDecrease;
   }
+  for (int i = 0; i < maximumBlock; i++)
+    delete block[i];
+  delete[] block;
 }
 // Returns new value of whichOther when whichIn enters basis
 double
@@ -612,6 +639,492 @@ void ClpSimplexOther::checkPrimalRatios(CoinIndexedVector *rowArray,
     }
   }
 }
+// Vectors longer than this have ratio tests split between threads
+#define PUSH_CHUNK 4096
+// Used by crossoverPush for ratio tests
+typedef struct {
+  ClpSimplex *model;
+  const double *work;
+  const int *which;
+  const int *pivotVariable;
+  const double *solution;
+  const double *lower;
+  const double *upper;
+  const double *dj;
+  double way;
+  double tolerance;
+  double theta;
+  int addSequence;
+  int packed;
+  int first;
+  int last;
+  int position;
+} clpPushRatioInfo;
+/* Primal ratio test on basic variables for increasing (way 1.0) or
+   decreasing (way -1.0) a nonbasic variable */
+static void primalPushBit(clpPushRatioInfo &info)
+{
+  double acceptablePivot = 1.0e-7;
+  double theta = COIN_DBL_MAX;
+  int position = -1;
+  for (int i = info.first; i < info.last; i++) {
+    int iRow = info.which[i];
+    double alpha = (info.packed ? info.work[i] : info.work[iRow]) * info.way;
+    if (fabs(alpha) > acceptablePivot) {
+      int iPivot = info.pivotVariable[iRow];
+      double value = info.solution[iPivot];
+      double ratio;
+      if (alpha > 0.0) {
+        // basic variable going towards lower bound
+        ratio = (value - info.lower[iPivot] + info.tolerance) / alpha;
+      } else {
+        // basic variable going towards upper bound
+        ratio = (value - info.upper[iPivot] - info.tolerance) / alpha;
+      }
+      ratio = CoinMax(0.0, ratio);
+      if (ratio < theta) {
+        theta = ratio;
+        position = i;
+      }
+    }
+  }
+  info.theta = theta;
+  info.position = position;
+}
+/* Dual ratio test on nonbasic variables when reduced costs change by
+   way*theta*alpha (one section of row of tableau) */
+static void dualPushBit(clpPushRatioInfo &info)
+{
+  double acceptablePivot = 1.0e-7;
+  ClpSimplex *model = info.model;
+  double theta = COIN_DBL_MAX;
+  int position = -1;
+  for (int i = info.first; i < info.last; i++) {
+    int iSequence = info.which[i];
+    double alpha = info.packed ? info.work[i] : info.work[iSequence];
+    if (fabs(alpha) < acceptablePivot)
+      continue;
+    int iSequence2 = iSequence + info.addSequence;
+    double move = info.way * alpha;
+    double ratio;
+    ClpSimplex::Status status = model->getStatus(iSequence2);
+    if (status == ClpSimplex::atLowerBound && move < 0.0) {
+      ratio = info.dj[iSequence2] / -move;
+    } else if (status == ClpSimplex::atUpperBound && move > 0.0) {
+      ratio = -info.dj[iSequence2] / move;
+    } else {
+      // basic, fixed, free and superbasic can not come in
+      continue;
+    }
+    ratio = CoinMax(0.0, ratio);
+    if (ratio < theta) {
+      theta = ratio;
+      position = i;
+    }
+  }
+  info.theta = theta;
+  info.position = position;
+}
+/* Ratio test over which[0..number-1].  Long vectors are split between
+   threads and results merged in order so same as serial */
+static void pushRatioTest(void (*bit)(clpPushRatioInfo &), clpPushRatioInfo &base,
+  int number)
+{
+  int numberTasks = CoinMin(clpParallelThreads(), number / PUSH_CHUNK);
+  if (numberTasks <= 1) {
+    base.first = 0;
+    base.last = number;
+    bit(base);
+    return;
+  }
+  clpPushRatioInfo *info = new clpPushRatioInfo[numberTasks];
+  for (int i = 0; i < numberTasks; i++) {
+    info[i] = base;
+    info[i].first = static_cast< int >((static_cast< double >(number) * i) / numberTasks);
+    info[i].last = static_cast< int >((static_cast< double >(number) * (i + 1)) / numberTasks);
+  }
+  clpParallelFor(bit, info, numberTasks);
+  base.theta = COIN_DBL_MAX;
+  base.position = -1;
+  for (int i = 0; i < numberTasks; i++) {
+    if (info[i].position >= 0 && info[i].theta < base.theta) {
+      base.theta = info[i].theta;
+      base.position = info[i].position;
+    }
+  }
+  delete[] info;
+}
+/* Crossover push after barrier - primal push of superbasics to bounds
+   and dual push of basic columns barrier says are nonbasic.
+   A batch does pivots against one factorization.  A pivot is only done
+   if its column (primal) or row (dual) of tableau is unchanged by the
+   earlier pivots in batch, otherwise it waits for next batch.  Each
+   batch ends with one refactorization.  If a phase needs more than
+   maximumBatches batches everything is put back as it was */
+int ClpSimplexOther::crossoverPush(int maximumBatches)
+{
+  // elapsed time - cpu time would include other threads
+  double time1 = CoinGetTimeOfDay();
+  int numberTotal = numberRows_ + numberColumns_;
+  // reduced costs from barrier
+  double *barrierDj = CoinCopyOfArray(reducedCost_, numberColumns_);
+  // save so can go back
+  unsigned char *saveStatusArray = CoinCopyOfArray(status_, numberTotal);
+  double *saveSolution = new double[numberTotal + numberRows_];
+  CoinMemcpyN(columnActivity_, numberColumns_, saveSolution);
+  CoinMemcpyN(rowActivity_, numberRows_, saveSolution + numberColumns_);
+  CoinMemcpyN(dual_, numberRows_, saveSolution + numberTotal);
+  int saveStatus = problemStatus_;
+  algorithm_ = -1;
+  ClpDataSave data = saveData();
+  perturbation_ = 100;
+  if (startup(1)) {
+    delete[] barrierDj;
+    delete[] saveStatusArray;
+    delete[] saveSolution;
+    int saveLevel = handler_->logLevel();
+    handler_->setLogLevel(0);
+    finish();
+    handler_->setLogLevel(saveLevel);
+    restoreData(data);
+    problemStatus_ = saveStatus;
+    return -1;
+  }
+  bool error = false;
+  int *list = new int[numberTotal];
+  int *backPivot = new int[numberTotal];
+  char *mark = new char[numberTotal];
+  CoinZeroN(mark, numberTotal);
+  clpPushRatioInfo info;
+  memset(&info, 0, sizeof(info));
+  info.model = this;
+  info.pivotVariable = pivotVariable_;
+  info.solution = solution_;
+  info.lower = lower_;
+  info.upper = upper_;
+  info.dj = dj_;
+  info.tolerance = primalTolerance_;
+#ifndef COIN_FAC_NEW
+  int packed = 1;
+#else
+  int packed = 0;
+#endif
+  // Primal push
+  int numberList = 0;
+  for (int iSequence = 0; iSequence < numberTotal; iSequence++) {
+    Status status = getStatus(iSequence);
+    if (status == superBasic || status == isFree)
+      list[numberList++] = iSequence;
+  }
+  int numberPushed = 0;
+  int numberPivots = 0;
+  int numberBatches = 0;
+  while (numberList) {
+    if (numberBatches == maximumBatches) {
+      // too many - go back to normal crossover
+      error = true;
+      break;
+    }
+    int numberDeferred = 0;
+    int numberPivotsThis = 0;
+    for (int iList = 0; iList < numberList; iList++) {
+      int iSequence = list[iList];
+      Status status = getStatus(iSequence);
+      if (status != superBasic && status != isFree)
+        continue;
+      double value = solution_[iSequence];
+      double lower = lower_[iSequence];
+      double upper = upper_[iSequence];
+      double dj = dj_[iSequence];
+      // go in direction which does not make objective worse
+      double way;
+      if (dj > dualTolerance_) {
+        if (lower < -1.0e30)
+          continue;
+        way = -1.0;
+      } else if (dj < -dualTolerance_) {
+        if (upper > 1.0e30)
+          continue;
+        way = 1.0;
+      } else if (lower < -1.0e30 && upper > 1.0e30) {
+        continue;
+      } else {
+        way = (value - lower <= upper - value) ? -1.0 : 1.0;
+      }
+      double distance = CoinMax(0.0, way > 0.0 ? upper - value : value - lower);
+#ifndef COIN_FAC_NEW
+      unpackPacked(rowArray_[1], iSequence);
+#else
+      unpack(rowArray_[1], iSequence);
+#endif
+      factorization_->updateColumn(rowArray_[2], rowArray_[1]);
+      // Get extra rows
+      matrix_->extendUpdated(this, rowArray_[1], 0);
+      double *work = rowArray_[1]->denseVector();
+      int number = rowArray_[1]->getNumElements();
+      int *which = rowArray_[1]->getIndices();
+      // column must be unchanged by pivots in this batch
+      bool independent = true;
+      for (int i = 0; i < number; i++) {
+        int iRow = which[i];
+        if (mark[iRow] && (packed ? work[i] : work[iRow])) {
+          independent = false;
+          break;
+        }
+      }
+      if (!independent) {
+        list[numberDeferred++] = iSequence;
+        rowArray_[1]->clear();
+        continue;
+      }
+      info.work = work;
+      info.which = which;
+      info.way = way;
+      info.packed = packed;
+      pushRatioTest(primalPushBit, info, number);
+      double theta = distance;
+      int pivotRow = -1;
+      if (info.position >= 0 && info.theta < distance) {
+        theta = info.theta;
+        pivotRow = which[info.position];
+      }
+      if (theta) {
+        // move basic variables
+        double change = way * theta;
+        for (int i = 0; i < number; i++) {
+          int iRow = which[i];
+          double alpha = packed ? work[i] : work[iRow];
+          int iPivot = pivotVariable_[iRow];
+          solution_[iPivot] -= change * alpha;
+        }
+      }
+      if (pivotRow < 0) {
+        // reached bound
+        solution_[iSequence] = way > 0.0 ? upper : lower;
+        if (upper == lower)
+          setStatus(iSequence, isFixed);
+        else
+          setStatus(iSequence, way > 0.0 ? atUpperBound : atLowerBound);
+      } else {
+        solution_[iSequence] = value + way * theta;
+        int iPivot = pivotVariable_[pivotRow];
+        double alpha = (packed ? work[info.position] : work[pivotRow]) * way;
+        if (alpha > 0.0) {
+          solution_[iPivot] = lower_[iPivot];
+          setStatus(iPivot, atLowerBound);
+        } else {
+          solution_[iPivot] = upper_[iPivot];
+          setStatus(iPivot, atUpperBound);
+        }
+        if (lower_[iPivot] == upper_[iPivot])
+          setStatus(iPivot, isFixed);
+        setStatus(iSequence, basic);
+        pivotVariable_[pivotRow] = iSequence;
+        mark[pivotRow] = 1;
+        numberPivotsThis++;
+      }
+      numberPushed++;
+      rowArray_[1]->clear();
+    }
+    numberBatches++;
+    numberPivots += numberPivotsThis;
+    numberList = numberDeferred;
+    if (numberPivotsThis) {
+      CoinZeroN(mark, numberRows_);
+      // one refactorization for batch
+      if (internalFactorize(10) < 0) {
+        error = true;
+        break;
+      }
+      computePrimals(rowActivityWork_, columnActivityWork_);
+      computeDuals(NULL);
+    }
+  }
+  double time2 = CoinGetTimeOfDay();
+  handler_->message(CLP_CROSSOVER_PUSH, messages_)
+    << "Primal" << numberPushed << numberPivots << numberBatches
+    << time2 - time1 << CoinMessageEol;
+  // Dual push
+  numberList = 0;
+  for (int iColumn = 0; iColumn < numberColumns_ && !error; iColumn++) {
+    if (getStatus(iColumn) == basic) {
+      double dj = optimizationDirection_ * barrierDj[iColumn];
+      if ((dj > 10.0 * dualTolerance_ && solution_[iColumn] <= lower_[iColumn] + primalTolerance_)
+        || (dj < -10.0 * dualTolerance_ && solution_[iColumn] >= upper_[iColumn] - primalTolerance_))
+        list[numberList++] = iColumn;
+    }
+  }
+  numberPushed = 0;
+  numberPivots = 0;
+  numberBatches = 0;
+  rowArray_[1]->clear();
+#ifdef LONG_REGION_2
+  rowArray_[2]->clear();
+#else
+  columnArray_[1]->clear();
+#endif
+  while (numberList) {
+    if (numberBatches == maximumBatches) {
+      error = true;
+      break;
+    }
+    for (int i = 0; i < numberTotal; i++)
+      backPivot[i] = -1;
+    for (int iRow = 0; iRow < numberRows_; iRow++)
+      backPivot[pivotVariable_[iRow]] = iRow;
+    int numberDeferred = 0;
+    int numberPivotsThis = 0;
+    for (int iList = 0; iList < numberList; iList++) {
+      int iColumn = list[iList];
+      if (getStatus(iColumn) != basic)
+        continue;
+      double dj = optimizationDirection_ * barrierDj[iColumn];
+      // way reduced cost of leaving variable goes
+      double way;
+      if (dj > 10.0 * dualTolerance_ && solution_[iColumn] <= lower_[iColumn] + primalTolerance_)
+        way = -1.0;
+      else if (dj < -10.0 * dualTolerance_ && solution_[iColumn] >= upper_[iColumn] - primalTolerance_)
+        way = 1.0;
+      else
+        continue;
+      int iRow = backPivot[iColumn];
+      rowArray_[0]->clear();
+      columnArray_[0]->clear();
+#ifndef COIN_FAC_NEW
+      double plusOne = 1.0;
+      rowArray_[0]->createPacked(1, &iRow, &plusOne);
+#else
+      rowArray_[0]->createOneUnpackedElement(iRow, 1.0);
+#endif
+      factorization_->updateColumnTranspose(rowArray_[1], rowArray_[0]);
+      // put row of tableau in rowArray[0] and columnArray[0]
+      matrix_->transposeTimes(this, -1.0,
+        rowArray_[0],
+#ifdef LONG_REGION_2
+        rowArray_[2],
+#else
+        columnArray_[1],
+#endif
+        columnArray_[0]);
+      CoinIndexedVector *section[2] = { rowArray_[0], columnArray_[0] };
+      int addSequence[2] = { numberColumns_, 0 };
+      int packedSection[2] = { packed, 1 };
+      // row must be unchanged by pivots in this batch
+      bool independent = true;
+      for (int iSection = 0; iSection < 2 && independent; iSection++) {
+        const double *work = section[iSection]->denseVector();
+        const int *which = section[iSection]->getIndices();
+        int number = section[iSection]->getNumElements();
+        for (int i = 0; i < number; i++) {
+          int iSequence = which[i];
+          if (mark[iSequence + addSequence[iSection]]
+            && (packedSection[iSection] ? work[i] : work[iSequence])) {
+            independent = false;
+            break;
+          }
+        }
+      }
+      if (!independent) {
+        list[numberDeferred++] = iColumn;
+        continue;
+      }
+      // ratio test - slacks then columns
+      double theta = COIN_DBL_MAX;
+      int sequenceIn = -1;
+      for (int iSection = 0; iSection < 2; iSection++) {
+        info.work = section[iSection]->denseVector();
+        info.which = section[iSection]->getIndices();
+        info.addSequence = addSequence[iSection];
+        info.packed = packedSection[iSection];
+        info.way = way;
+        pushRatioTest(dualPushBit, info, section[iSection]->getNumElements());
+        if (info.position >= 0 && info.theta < theta) {
+          theta = info.theta;
+          sequenceIn = info.which[info.position] + addSequence[iSection];
+        }
+      }
+      if (sequenceIn < 0)
+        continue;
+      // update reduced costs
+      double delta = way * theta;
+      for (int iSection = 0; iSection < 2; iSection++) {
+        const double *work = section[iSection]->denseVector();
+        const int *which = section[iSection]->getIndices();
+        int number = section[iSection]->getNumElements();
+        for (int i = 0; i < number; i++) {
+          int iSequence = which[i];
+          double alpha = packedSection[iSection] ? work[i] : work[iSequence];
+          dj_[iSequence + addSequence[iSection]] += delta * alpha;
+        }
+      }
+      dj_[sequenceIn] = 0.0;
+      // degenerate pivot
+      if (way < 0.0) {
+        solution_[iColumn] = lower_[iColumn];
+        setStatus(iColumn, atLowerBound);
+      } else {
+        solution_[iColumn] = upper_[iColumn];
+        setStatus(iColumn, atUpperBound);
+      }
+      if (lower_[iColumn] == upper_[iColumn])
+        setStatus(iColumn, isFixed);
+      setStatus(sequenceIn, basic);
+      pivotVariable_[iRow] = sequenceIn;
+      backPivot[sequenceIn] = iRow;
+      backPivot[iColumn] = -1;
+      mark[sequenceIn] = 1;
+      numberPivotsThis++;
+      numberPushed++;
+    }
+    rowArray_[0]->clear();
+    columnArray_[0]->clear();
+    numberBatches++;
+    numberPivots += numberPivotsThis;
+    numberList = numberDeferred;
+    if (numberPivotsThis) {
+      CoinZeroN(mark, numberTotal);
+      // one refactorization for batch
+      if (internalFactorize(10) < 0) {
+        error = true;
+        break;
+      }
+      computePrimals(rowActivityWork_, columnActivityWork_);
+      computeDuals(NULL);
+    }
+  }
+  double time3 = CoinGetTimeOfDay();
+  handler_->message(CLP_CROSSOVER_PUSH, messages_)
+    << "Dual" << numberPushed << numberPivots << numberBatches
+    << time3 - time2 << CoinMessageEol;
+  int numberSuperBasic = 0;
+  for (int iSequence = 0; iSequence < numberTotal; iSequence++) {
+    Status status = getStatus(iSequence);
+    if (status == superBasic || status == isFree)
+      numberSuperBasic++;
+  }
+  delete[] list;
+  delete[] backPivot;
+  delete[] mark;
+  // no finished message
+  int saveLevel = handler_->logLevel();
+  handler_->setLogLevel(0);
+  finish();
+  handler_->setLogLevel(saveLevel);
+  restoreData(data);
+  problemStatus_ = saveStatus;
+  if (error) {
+    // put back as it was
+    CoinMemcpyN(saveStatusArray, numberTotal, status_);
+    CoinMemcpyN(saveSolution, numberColumns_, columnActivity_);
+    CoinMemcpyN(saveSolution + numberColumns_, numberRows_, rowActivity_);
+    CoinMemcpyN(saveSolution + numberTotal, numberRows_, dual_);
+    CoinMemcpyN(barrierDj, numberColumns_, reducedCost_);
+  }
+  delete[] barrierDj;
+  delete[] saveStatusArray;
+  delete[] saveSolution;
+  return error ? -1 : numberSuperBasic;
+}
 /* Write the basis in MPS format to the specified file.
    If writeValues true writes values of structurals
    (and adds VALUES to end of NAME card)
@@ -745,15 +1258,39 @@ int ClpSimplexOther::writeBasis(const char *filename,
   free(saveLocale);
   return 0;
 }
+// Binary basis snapshot - header, packed status then values
+#define CLP_BASIS_MAGIC "ClpBasis"
+#define CLP_BASIS_VERSION 2
+#define CLP_BASIS_ENDIAN 0x01020304
+typedef struct {
+  char magic[8];
+  int version;
+  int endian;
+  int numberRows;
+  int numberColumns;
+  int values; // 1 if primal and dual values follow status
+  int sizeBigIndex;
+  CoinUInt64 hash;
+} Clp_basisHeader;
+// Hash of model structure (sizes and element positions) so basis matches model
+static CoinUInt64 basisHash(const ClpMatrixBase *matrix, int numberRows, int numberColumns)
+{
+  // same FNV-1a hash as used to reuse symbolic factorization
+  return ClpCholeskyBase::computeStructureHash(matrix, numberRows, numberColumns);
+}
 // Read a basis from the given filename
 int ClpSimplexOther::readBasis(const char *fileName)
 {
   int status = 0;
   if (strcmp(fileName, "-") != 0 && strcmp(fileName, "stdin") != 0) {
-    FILE *fp = fopen(fileName, "r");
+    FILE *fp = fopen(fileName, "rb");
     if (fp) {
-      // can open - lets go for it
+      // can open - lets go for it (binary snapshot if magic matches)
+      char magic[8];
+      bool binary = fread(magic, 1, 8, fp) == 8 && !memcmp(magic, CLP_BASIS_MAGIC, 8);
       fclose(fp);
+      if (binary)
+        return readBinaryBasis(fileName);
     } else {
       handler_->message(CLP_UNABLE_OPEN, messages_)
         << fileName << CoinMessageEol;
@@ -797,6 +1334,141 @@ int ClpSimplexOther::readBasis(const char *fileName)
   }
   return status;
 }
+/* Write a binary snapshot of basis (3 bits per variable) and
+   optionally primal and dual values.  Returns non-zero on I/O error */
+int ClpSimplexOther::writeBinaryBasis(const char *filename,
+  bool writeValues) const
+{
+  if (!status_)
+    return -1;
+  FILE *fp = fopen(filename, "wb");
+  if (!fp)
+    return -1;
+  Clp_basisHeader header;
+  memset(&header, 0, sizeof(Clp_basisHeader));
+  memcpy(header.magic, CLP_BASIS_MAGIC, 8);
+  header.version = CLP_BASIS_VERSION;
+  header.endian = CLP_BASIS_ENDIAN;
+  header.numberRows = numberRows_;
+  header.numberColumns = numberColumns_;
+  header.values = writeValues ? 1 : 0;
+  header.sizeBigIndex = static_cast< int >(sizeof(CoinBigIndex));
+  header.hash = basisHash(matrix_, numberRows_, numberColumns_);
+  bool ok = fwrite(&header, sizeof(Clp_basisHeader), 1, fp) == 1;
+  // pack status (columns then rows as in status_) 8 to 3 bytes
+  int numberTotal = numberColumns_ + numberRows_;
+  size_t numberBytes = (3 * static_cast< size_t >(numberTotal) + 7) / 8;
+  unsigned char *packed = new unsigned char[numberBytes];
+  memset(packed, 0, numberBytes);
+  for (int i = 0; i < numberTotal; i++) {
+    size_t bit = 3 * static_cast< size_t >(i);
+    unsigned int value = (status_[i] & 7) << (bit & 7);
+    packed[bit >> 3] |= static_cast< unsigned char >(value);
+    if ((bit & 7) > 5)
+      packed[(bit >> 3) + 1] |= static_cast< unsigned char >(value >> 8);
+  }
+  ok = ok && fwrite(packed, 1, numberBytes, fp) == numberBytes;
+  delete[] packed;
+  if (writeValues) {
+    ok = ok && fwrite(columnActivity_, sizeof(double), numberColumns_, fp) == static_cast< size_t >(numberColumns_);
+    ok = ok && fwrite(rowActivity_, sizeof(double), numberRows_, fp) == static_cast< size_t >(numberRows_);
+    ok = ok && fwrite(reducedCost_, sizeof(double), numberColumns_, fp) == static_cast< size_t >(numberColumns_);
+    ok = ok && fwrite(dual_, sizeof(double), numberRows_, fp) == static_cast< size_t >(numberRows_);
+  }
+  if (fclose(fp))
+    ok = false;
+  return ok ? 0 : 1;
+}
+/* Read a binary basis snapshot.  Returns -1 on file error,
+   -2 if for a different model, 0 if no values, 1 if values */
+int ClpSimplexOther::readBinaryBasis(const char *fileName)
+{
+  FILE *fp = fopen(fileName, "rb");
+  if (!fp) {
+    handler_->message(CLP_UNABLE_OPEN, messages_)
+      << fileName << CoinMessageEol;
+    return -1;
+  }
+  Clp_basisHeader header;
+  if (fread(&header, sizeof(Clp_basisHeader), 1, fp) != 1
+    || memcmp(header.magic, CLP_BASIS_MAGIC, 8)
+    || header.version != CLP_BASIS_VERSION
+    || header.endian != CLP_BASIS_ENDIAN) {
+    fclose(fp);
+    handler_->message(CLP_IMPORT_ERRORS, messages_)
+      << 1 << fileName << CoinMessageEol;
+    return -1;
+  }
+  if (header.numberRows != numberRows_ || header.numberColumns != numberColumns_
+    || header.hash != basisHash(matrix_, numberRows_, numberColumns_)) {
+    fclose(fp);
+    char line[200];
+    sprintf(line, "Basis in %.150s is for a different model", fileName);
+    handler_->message(CLP_GENERAL_WARNING, messages_)
+      << line << CoinMessageEol;
+    return -2;
+  }
+  int numberTotal = numberColumns_ + numberRows_;
+  size_t numberBytes = (3 * static_cast< size_t >(numberTotal) + 7) / 8;
+  // extra byte so unpacking can look one ahead
+  unsigned char *packed = new unsigned char[numberBytes + 1];
+  packed[numberBytes] = 0;
+  bool ok = fread(packed, 1, numberBytes, fp) == numberBytes;
+  unsigned char *status = NULL;
+  if (ok) {
+    status = new unsigned char[numberTotal];
+    for (int i = 0; i < numberTotal; i++) {
+      size_t bit = 3 * static_cast< size_t >(i);
+      unsigned int value = packed[bit >> 3] | (packed[(bit >> 3) + 1] << 8);
+      value = (value >> (bit & 7)) & 7;
+      if (value > isFixed)
+        ok = false;
+      status[i] = static_cast< unsigned char >(value);
+    }
+  }
+  delete[] packed;
+  double *values = NULL;
+  if (ok && header.values) {
+    values = new double[2 * numberTotal];
+    ok = fread(values, sizeof(double), 2 * numberTotal, fp) == static_cast< size_t >(2 * numberTotal);
+  }
+  fclose(fp);
+  if (!ok) {
+    delete[] status;
+    delete[] values;
+    handler_->message(CLP_IMPORT_ERRORS, messages_)
+      << 1 << fileName << CoinMessageEol;
+    return -1;
+  }
+  // only change model now file known to be good
+  if (!status_)
+    createStatus();
+  CoinMemcpyN(status, numberTotal, status_);
+  delete[] status;
+  if (values) {
+    CoinMemcpyN(values, numberColumns_, columnActivity_);
+    CoinMemcpyN(values + numberColumns_, numberRows_, rowActivity_);
+    CoinMemcpyN(values + numberTotal, numberColumns_, reducedCost_);
+    CoinMemcpyN(values + numberTotal + numberColumns_, numberRows_, dual_);
+    delete[] values;
+    return 1;
+  } else {
+    // set values as readBasis
+    for (int iRow = 0; iRow < numberRows_; iRow++) {
+      if (getRowStatus(iRow) == atLowerBound)
+        rowActivity_[iRow] = rowLower_[iRow];
+      else if (getRowStatus(iRow) == atUpperBound)
+        rowActivity_[iRow] = rowUpper_[iRow];
+    }
+    for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+      if (getColumnStatus(iColumn) == atLowerBound)
+        columnActivity_[iColumn] = columnLower_[iColumn];
+      else if (getColumnStatus(iColumn) == atUpperBound)
+        columnActivity_[iColumn] = columnUpper_[iColumn];
+    }
+    return 0;
+  }
+}
 /* Creates dual of a problem if looks plausible
    (defaults will always create model)
    fractionRowRanges is fraction of rows allowed to have ranges
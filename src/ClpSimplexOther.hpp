@@ -66,6 +66,21 @@ public:
   void primalRanging(int numberCheck, const int *which,
     double *valueIncrease, int *sequenceIncrease,
     double *valueDecrease, int *sequenceDecrease);
+  /** Crossover push after barrier.
+         Status and solution must be from barrier (with a crash basis
+         and superbasic variables as set up in ClpSolve).
+         Primal push moves superbasic variables to bounds.
+         Dual push takes basic columns which barrier says should be
+         nonbasic (at bound with nonzero reduced cost) out of basis.
+         Ratio tests are done in parallel for long vectors and basis
+         changes are made in batches of independent pivots with one
+         refactorization per batch.  Timings are reported.
+         If either push needs more than maximumBatches batches, status
+         and solution are put back as they were.
+         Returns number of superbasic variables left or -1 on error
+         (or too many batches)
+     */
+  int crossoverPush(int maximumBatches = 20);
   /** Parametrics
          This is an initial slow version.
          The code uses current bounds + theta * change (if change array not NULL)
@@ -213,8 +228,15 @@ public:
   int writeBasis(const char *filename,
     bool writeValues = false,
     int formatType = 0) const;
-  /// Read a basis from the given filename
+  /// Read a basis from the given filename (binary snapshot or MPS)
   int readBasis(const char *filename);
+  /** Write a binary snapshot of basis (3 bits per variable) and
+      if writeValues primal and dual values.  Returns non-zero on I/O error */
+  int writeBinaryBasis(const char *filename,
+    bool writeValues = true) const;
+  /** Read a binary basis snapshot.  Returns -1 on file error,
+      -2 if for a different model, 0 if no values, 1 if values */
+  int readBinaryBasis(const char *filename);
   /** Creates dual of a problem if looks plausible
          (defaults will always create model)
          fractionRowRanges is fraction of rows allowed to have ranges
@@ -35,6 +35,7 @@
 #include "ClpInterior.hpp"
 #include "ClpCholeskyDense.hpp"
 #include "ClpCholeskyBase.hpp"
+#include "ClpCholeskySupernodal.hpp"
 #include "ClpPlusMinusOneMatrix.hpp"
 #include "ClpNetworkMatrix.hpp"
 #endif
@@ -44,6 +45,9 @@
 #include "ClpPackedMatrix.hpp"
 #include "ClpMessage.hpp"
 #include "CoinTime.hpp"
+#ifdef CLP_THREAD_POOL
+#include <pthread.h>
+#endif
 #if CLP_HAS_ABC
 #include "CoinAbcCommon.hpp"
 #endif
@@ -839,6 +843,187 @@ ClpSimplex::dealWithAbc(int solveType, int startUp,
   return abcModel2;
 }
 #endif
+/* For concurrent solve - winner is only read and set through these
+   so that first one to finish is seen by all threads */
+static inline int
+clpConcurrentWinner(int *winner)
+{
+#ifdef __GNUC__
+  return __atomic_load_n(winner, __ATOMIC_ACQUIRE);
+#elif defined(_MSC_VER)
+  return InterlockedCompareExchange(reinterpret_cast< volatile long * >(winner), -1, -1);
+#else
+  return *winner;
+#endif
+}
+// Sets winner to which if no winner yet
+static inline void
+clpConcurrentSetWinner(int *winner, int which)
+{
+#ifdef __GNUC__
+  int none = -1;
+  __atomic_compare_exchange_n(winner, &none, which, false,
+    __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#elif defined(_MSC_VER)
+  InterlockedCompareExchange(reinterpret_cast< volatile long * >(winner), which, -1);
+#else
+  if (*winner < 0)
+    *winner = which;
+#endif
+}
+/* Each copy of model has one of these and the first one to finish
+   properly sets winner - others then stop at end of next iteration.
+   Copies do not use the interrupt handler but stop if it has stopped
+   parent model */
+class ClpConcurrentEventHandler : public ClpEventHandler {
+public:
+  ClpConcurrentEventHandler(int *winner, int which,
+    const ClpSimplex *parent)
+    : ClpEventHandler()
+    , winner_(winner)
+    , which_(which)
+    , parent_(parent)
+  {
+  }
+  virtual int event(Event whichEvent)
+  {
+    if (whichEvent == endOfIteration) {
+      int winner = clpConcurrentWinner(winner_);
+      if (!parent_->maximumIterations())
+        return 0; // interrupted
+      return (winner >= 0 && winner != which_) ? 0 : -1;
+    }
+    return ClpEventHandler::event(whichEvent);
+  }
+  virtual ClpEventHandler *clone() const
+  {
+    return new ClpConcurrentEventHandler(*this);
+  }
+
+private:
+  int *winner_;
+  int which_;
+  const ClpSimplex *parent_;
+};
+typedef struct {
+  ClpSimplex *model;
+  ClpSolve *options;
+  int *winner;
+  int which;
+  double time;
+} clpConcurrentInfo;
+static void
+concurrentSolveTask(void *data, int which)
+{
+  clpConcurrentInfo *info = reinterpret_cast< clpConcurrentInfo * >(data) + which;
+  // elapsed time - cpu time would include other threads
+  double time1 = CoinGetTimeOfDay();
+  info->model->initialSolve(*info->options);
+  info->time = CoinGetTimeOfDay() - time1;
+  int status = info->model->problemStatus();
+  if (status >= 0 && status <= 2) {
+    // optimal or proven infeasible/unbounded - see if first
+    clpConcurrentSetWinner(info->winner, which);
+  }
+}
+#ifdef CLP_THREAD_POOL
+static void *
+concurrentSolveThread(void *data)
+{
+  clpConcurrentInfo *info = reinterpret_cast< clpConcurrentInfo * >(data);
+  concurrentSolveTask(info - info->which, info->which);
+  return NULL;
+}
+#endif
+/* Solves model2 with dual, primal and barrier at same time.
+   With CLP_THREAD_POOL each one has its own thread (so it does not
+   depend on size of worker pool or on pool being free).  Otherwise
+   clpParallelRun is used which may do one after other - then dual
+   is likely to be only one to do any work.
+   Returns which one was used (0 dual, 1 primal, 2 barrier) */
+static int
+concurrentSolve(ClpSimplex *model2, const ClpSolve &options,
+  double &timeWinner)
+{
+#ifndef SLIM_CLP
+#define NUMBER_CONCURRENT 3
+#else
+#define NUMBER_CONCURRENT 2
+#endif
+  ClpSolve::SolveType method[] = { ClpSolve::useDual, ClpSolve::usePrimal,
+    ClpSolve::useBarrier };
+  int winner = -1;
+  ClpSimplex *model[NUMBER_CONCURRENT];
+  ClpSolve solveOptions[NUMBER_CONCURRENT];
+  CoinMessageHandler handler[NUMBER_CONCURRENT];
+  clpConcurrentInfo info[NUMBER_CONCURRENT];
+  for (int i = 0; i < NUMBER_CONCURRENT; i++) {
+    model[i] = new ClpSimplex(*model2);
+    // messages would get mixed up
+    handler[i].setLogLevel(0);
+    model[i]->passInMessageHandler(handler + i);
+    ClpConcurrentEventHandler eventHandler(&winner, i, model2);
+    model[i]->passInEventHandler(&eventHandler);
+    solveOptions[i] = options;
+    solveOptions[i].setSolveType(method[i]);
+    solveOptions[i].setPresolveType(ClpSolve::presolveOff);
+    // no interrupt handling - it uses static currentModel (see event handler)
+    solveOptions[i].setSpecialOption(2, 1);
+    info[i].model = model[i];
+    info[i].options = solveOptions + i;
+    info[i].winner = &winner;
+    info[i].which = i;
+    info[i].time = 0.0;
+  }
+#ifdef CLP_THREAD_POOL
+  // caller does dual - others on their own threads
+  pthread_t threadId[NUMBER_CONCURRENT];
+  bool started[NUMBER_CONCURRENT];
+  for (int i = 1; i < NUMBER_CONCURRENT; i++)
+    started[i] = !pthread_create(threadId + i, NULL, concurrentSolveThread, info + i);
+  concurrentSolveTask(info, 0);
+  for (int i = 1; i < NUMBER_CONCURRENT; i++) {
+    if (started[i])
+      pthread_join(threadId[i], NULL);
+    else
+      concurrentSolveTask(info, i); // could not get thread
+  }
+#else
+  clpParallelRun(concurrentSolveTask, info, NUMBER_CONCURRENT);
+#endif
+  int which = winner;
+  if (which < 0)
+    which = 0; // none finished properly - use dual
+  ClpSimplex *best = model[which];
+  int numberRows = model2->numberRows();
+  int numberColumns = model2->numberColumns();
+  CoinMemcpyN(best->primalColumnSolution(), numberColumns,
+    model2->primalColumnSolution());
+  CoinMemcpyN(best->dualColumnSolution(), numberColumns,
+    model2->dualColumnSolution());
+  CoinMemcpyN(best->primalRowSolution(), numberRows,
+    model2->primalRowSolution());
+  CoinMemcpyN(best->dualRowSolution(), numberRows,
+    model2->dualRowSolution());
+  model2->copyinStatus(best->statusArray());
+  model2->setObjectiveValue(best->objectiveValue());
+  model2->setProblemStatus(best->problemStatus());
+  model2->setSecondaryStatus(best->secondaryStatus());
+  model2->setNumberIterations(model2->numberIterations() + best->numberIterations());
+  timeWinner = info[which].time;
+  for (int i = 0; i < NUMBER_CONCURRENT; i++)
+    delete model[i];
+  return which;
+}
+#ifndef SLIM_CLP
+/* Number of column blocks for Idiot passes - from number of threads of
+   model (100+n as in cbc means n).  0 is normal serial pass */
+static int idiotBlocks(const ClpSimplex *model)
+{
+  int numberThreads = model->numberThreads() % 100;
+  return (numberThreads > 1) ? numberThreads : 0;
+}
+#endif
 /** General solve algorithm which can do presolve
     special options (bits)
     1 - do not perturb
@@ -1335,7 +1520,7 @@ int ClpSimplex::initialSolve(ClpSolve &options)
   }
   if (method != ClpSolve::useDual && method != ClpSolve::useBarrier
     && method != ClpSolve::tryBenders && method != ClpSolve::tryDantzigWolfe
-    && method != ClpSolve::useBarrierNoCross) {
+    && method != ClpSolve::useBarrierNoCross && method != ClpSolve::concurrent) {
     switch (options.getSpecialOption(1)) {
     case 0:
       doIdiot = -1;
@@ -1407,7 +1592,8 @@ int ClpSimplex::initialSolve(ClpSolve &options)
     default:
       abort();
     }
-  } else if (method != ClpSolve::tryBenders && method != ClpSolve::tryDantzigWolfe) {
+  } else if (method != ClpSolve::tryBenders && method != ClpSolve::tryDantzigWolfe
+    && method != ClpSolve::concurrent) {
     // Dual
     switch (options.getSpecialOption(0)) {
     case 0:
@@ -1795,6 +1981,8 @@ int ClpSimplex::initialSolve(ClpSolve &options)
       Idiot info(*model2);
       info.setMinIntervalStatusUpdate(model2->getMinIntervalProgressUpdate());
       info.setStrategy(idiotOptions | info.getStrategy());
+      // blocked passes if threads (blocks independent of pool size)
+      info.setNumberBlocks(idiotBlocks(this));
       // Get average number of elements per column
       double ratio = static_cast< double >(numberElements) / static_cast< double >(numberColumns);
       // look at rhs
@@ -1982,6 +2170,8 @@ int ClpSimplex::initialSolve(ClpSolve &options)
       Idiot info(*model2);
       info.setMinIntervalStatusUpdate(model2->getMinIntervalProgressUpdate());
       info.setStrategy(idiotOptions | info.getStrategy());
+      // blocked passes if threads (blocks independent of pool size)
+      info.setNumberBlocks(idiotBlocks(this));
       // Get average number of elements per column
       double ratio = static_cast< double >(numberElements) / static_cast< double >(numberColumns);
       // look at rhs
@@ -3179,6 +3369,27 @@ int ClpSimplex::initialSolve(ClpSolve &options)
       barrierOptions &= ~8;
       scale = true;
     }
+    bool doCrossoverPush = false;
+    if (barrierOptions & 32768) {
+      // crossover push (see ClpSimplexOther::crossoverPush)
+      barrierOptions &= ~32768;
+      doCrossoverPush = true;
+    }
+    int orderingType = 0;
+    if (barrierOptions & 16384) {
+      // nested dissection ordering for native
+      barrierOptions &= ~16384;
+      orderingType = 1;
+    }
+    if (barrierOptions & 65536) {
+      // AMD or nested dissection by predicted fill
+      barrierOptions &= ~65536;
+      orderingType = 2;
+    }
+    if (barrierOptions & 8192) {
+      // supernodal
+      barrierOptions = 8;
+    }
     // If quadratic force KKT
     if (quadraticObj) {
       doKKT = true;
@@ -3189,6 +3400,7 @@ int ClpSimplex::initialSolve(ClpSolve &options)
       if (!doKKT) {
         ClpCholeskyBase *cholesky = new ClpCholeskyBase(options.getExtraInfo(1));
         cholesky->setIntegerParameter(0, speed);
+        cholesky->setOrderingType(orderingType);
         barrier.setCholesky(cholesky);
       } else {
         ClpCholeskyBase *cholesky = new ClpCholeskyBase();
@@ -3268,6 +3480,18 @@ int ClpSimplex::initialSolve(ClpSolve &options)
       assert(!doKKT);
     } break;
 #endif
+    case 8:
+      if (!doKKT) {
+        ClpCholeskySupernodal *cholesky = new ClpCholeskySupernodal();
+        cholesky->setOrderingType(orderingType);
+        barrier.setCholesky(cholesky);
+      } else {
+        // KKT not coded so use native
+        ClpCholeskyBase *cholesky = new ClpCholeskyBase();
+        cholesky->setKKT(true);
+        barrier.setCholesky(cholesky);
+      }
+      break;
     }
     int numberRows = model2->numberRows();
     int numberColumns = model2->numberColumns();
@@ -3567,6 +3791,15 @@ int ClpSimplex::initialSolve(ClpSolve &options)
           }
           delete[] sort;
           delete[] dsort;
+          // push superbasics to bounds and fix up basis
+          if (doCrossoverPush && static_cast< ClpSimplexOther * >(model2)->crossoverPush() >= 0) {
+#ifdef BORROW
+            CoinMemcpyN(model2->primalRowSolution(),
+              numberRows, rowPrimal);
+            CoinMemcpyN(model2->primalColumnSolution(),
+              numberColumns, columnPrimal);
+#endif
+          }
           // model2->allSlackBasis();
           if (gap < 1.0e-3 * static_cast< double >(numberRows + numberColumns)) {
             if (saveUpper) {
@@ -3740,6 +3973,21 @@ int ClpSimplex::initialSolve(ClpSolve &options)
 #else
     abort();
 #endif
+  } else if (method == ClpSolve::concurrent) {
+    double timeWinner;
+    int which = concurrentSolve(model2, options, timeWinner);
+    const char *name[] = { "dual", "primal", "barrier" };
+    char line[100];
+    sprintf(line, "Concurrent solve - %s finished first (%.2f seconds)",
+      name[which], timeWinner);
+    handler_->message(CLP_GENERAL, messages_) << line
+                                              << CoinMessageEol;
+    time2 = CoinCpuTime();
+    timeCore = time2 - timeX;
+    handler_->message(CLP_INTERVAL_TIMING, messages_)
+      << "Concurrent" << timeCore << time2 - time1
+      << CoinMessageEol;
+    timeX = time2;
   } else if (method == ClpSolve::notImplemented) {
     printf("done decomposition\n");
   } else {
@@ -4113,6 +4361,9 @@ void ClpSolve::generateCpp(FILE *fp)
     "ClpSolve::useBarrier",
     "ClpSolve::useBarrierNoCross",
     "ClpSolve::automatic",
+    "ClpSolve::tryDantzigWolfe",
+    "ClpSolve::tryBenders",
+    "ClpSolve::concurrent",
     "ClpSolve::notImplemented"
   };
   std::string presolveType[] = {
@@ -30,6 +30,7 @@ public:
     automatic,
     tryDantzigWolfe,
     tryBenders,
+    concurrent, // dual, primal and barrier in parallel - first one wins
     notImplemented
   };
   enum PresolveType {
@@ -96,6 +97,11 @@ public:
        	   8 - bit set to do scaling
        	   16 - set to be aggressive with gamma/delta?
                       32 - Use KKT
+                      8192 - native supernodal cholesky (multi-threaded)
+                      16384 - nested dissection ordering for native cholesky
+                      65536 - native cholesky ordering (AMD or nested
+                              dissection) chosen by predicted fill
+                      32768 - crossover push before simplex in crossover
          5 - for presolve
                       1 - switch off dual stuff
          6 - extra switches
@@ -45,8 +45,12 @@ extern glp_prob *cbc_glp_prob;
 #if ABOCA_LITE
 // 1 is not owner of abcState_
 #define ABCSTATE_LITE 1
+#ifndef CLP_THREAD_POOL
 #include <cilk/cilk.h>
 #include <cilk/cilk_api.h>
+#else
+#include "ClpHelperFunctions.hpp"
+#endif
 #endif
 #if PRICE_USE_OPENMP
 #include "omp.h"
@@ -59,6 +63,7 @@ extern glp_prob *cbc_glp_prob;
 #include "ClpSimplexOther.hpp"
 #include "ClpSolve.hpp"
 #include "ClpMessage.hpp"
+#include "ClpHelperFunctions.hpp"
 #include "ClpPackedMatrix.hpp"
 #include "ClpPlusMinusOneMatrix.hpp"
 #include "ClpNetworkMatrix.hpp"
@@ -203,8 +208,10 @@ int ClpMain1(int argc, const char *argv[], AbcSimplex *models)
   memset(debugDouble, 0, sizeof(debugDouble));
 #endif
 #if ABOCA_LITE
+#ifndef CLP_THREAD_POOL
   //__cilkrts_end_cilk();
   __cilkrts_set_param("nworkers", "1");
+#endif
   //abcState_=1;
 #endif
 #if 0
@@ -419,6 +426,7 @@ int ClpMain1(int argc, const char *argv[], AbcSimplex *models)
   parameters[whichParam(CLP_PARAM_STR_BARRIERSCALE, parameters)].setCurrentOption(2);
   int scaleBarrier = 2;
   int doKKT = 0;
+  int orderingType = 0;
   int crossover = 2; // do crossover unless quadratic
 
   int iModel = 0;
@@ -636,6 +644,22 @@ int ClpMain1(int argc, const char *argv[], AbcSimplex *models)
             dualize = value;
           else if (parameters[iParam].type() == CLP_PARAM_INT_VERBOSE)
             verbose = value;
+#if ABOCA_LITE && defined(CLP_THREAD_POOL)
+          else if (parameters[iParam].type() == CBC_PARAM_INT_THREADS) {
+            // number of chunks for parallel pricing
+            int numberThreads = CoinMax(0, CoinMin(value, ABOCA_LITE));
+            if (numberThreads == 1)
+              numberThreads = 0;
+            setAbcState(numberThreads);
+            clpSetParallelThreads(numberThreads);
+          }
+#elif defined(CLP_THREAD_POOL)
+          else if (parameters[iParam].type() == CBC_PARAM_INT_THREADS) {
+            // size of worker pool for parallel parts
+            // (model also keeps value - used for number of Idiot blocks)
+            clpSetParallelThreads(value);
+          }
+#endif
           parameters[iParam].setIntParameter(thisModel, value);
         } else if (valid == 1) {
           std::cout << " is illegal for integer parameter " << parameters[iParam].name() << " value remains " << parameters[iParam].intValue() << std::endl;
@@ -775,12 +799,16 @@ int ClpMain1(int argc, const char *argv[], AbcSimplex *models)
             models[iModel].setAbcState(action);
 #elif ABOCA_LITE
             setAbcState(action);
+#ifndef CLP_THREAD_POOL
             {
               char temp[3];
               sprintf(temp, "%d", action);
               __cilkrts_set_param("nworkers", temp);
               printf("setting cilk workers to %d\n", action);
             }
+#else
+            clpSetParallelThreads(action);
+#endif
 #elif PRICE_USE_OPENMP
 	    omp_set_num_threads(action);
 #endif
@@ -805,7 +833,8 @@ int ClpMain1(int argc, const char *argv[], AbcSimplex *models)
             thisModel->factorization()->setForrestTomlin(action == 0);
             break;
           case CLP_PARAM_STR_FACTORIZATION:
-            models[iModel].factorization()->forceOtherFactorization(action);
+            // 4 (parallel) is 5 as 4 means normal to Osi
+            models[iModel].factorization()->forceOtherFactorization(action == 4 ? 5 : action);
 #ifdef ABC_INHERIT
             thisModel->factorization()->forceOtherFactorization(action);
 #endif
@@ -834,6 +863,9 @@ int ClpMain1(int argc, const char *argv[], AbcSimplex *models)
           case CLP_PARAM_STR_KKT:
             doKKT = action;
             break;
+          case CLP_PARAM_STR_ORDERING:
+            orderingType = action;
+            break;
           case CLP_PARAM_STR_CROSSOVER:
             crossover = action;
             break;
@@ -953,6 +985,8 @@ int ClpMain1(int argc, const char *argv[], AbcSimplex *models)
                   printf("Dual of model has %d rows and %d columns\n",
                     thisModel->numberRows(), thisModel->numberColumns());
                   thisModel->setOptimizationDirection(1.0);
+                  // threads (and so Idiot blocks) as for primal
+                  thisModel->setNumberThreads(model2->numberThreads());
 #ifndef ABC_INHERIT
                   model2 = thisModel;
 #else
@@ -1078,6 +1112,8 @@ int ClpMain1(int argc, const char *argv[], AbcSimplex *models)
                 solveOptions.setSpecialOption(1, 11); // switch off values
             } else if (method == ClpSolve::useBarrier || method == ClpSolve::useBarrierNoCross) {
               int barrierOptions = choleskyType;
+              if (choleskyType == 8)
+                barrierOptions = 8192; // supernodal (8 is scaling bit)
               if (scaleBarrier) {
                 if ((scaleBarrier & 1) != 0)
                   barrierOptions |= 8;
@@ -1085,10 +1121,16 @@ int ClpMain1(int argc, const char *argv[], AbcSimplex *models)
               }
               if (doKKT)
                 barrierOptions |= 16;
+              if (orderingType == 1)
+                barrierOptions |= 16384; // nested dissection
+              else if (orderingType == 2)
+                barrierOptions |= 65536; // choose by predicted fill
               if (gamma)
                 barrierOptions |= 32 * gamma;
               if (crossover == 3)
                 barrierOptions |= 256; // try presolve in crossover
+              else if (crossover == 4)
+                barrierOptions |= 32768; // push before simplex
               solveOptions.setSpecialOption(4, barrierOptions);
             }
             int status;
@@ -1508,11 +1550,12 @@ int ClpMain1(int argc, const char *argv[], AbcSimplex *models)
 #ifdef CLP_USEFUL_PRINTOUT
             mpsFile = fileName;
 #endif
-            if (!gmpl)
-              status = models[iModel].readMps(fileName.c_str(),
+            if (!gmpl) {
+              // one pass reader (uses CoinMpsIO if not plain LP)
+              status = models[iModel].readMpsStream(fileName.c_str(),
                 keepImportNames != 0,
                 allowImportErrors != 0);
-            else if (gmpl > 0)
+            } else if (gmpl > 0)
               status = models[iModel].readGMPL(fileName.c_str(),
                 (gmpl == 2) ? gmplData.c_str() : NULL,
                 keepImportNames != 0);
@@ -1767,7 +1810,7 @@ int ClpMain1(int argc, const char *argv[], AbcSimplex *models)
               int values = thisModel->readBasis(fileName.c_str());
               if (values == 0)
                 basisHasValues = -1;
-              else
+              else if (values > 0)
                 basisHasValues = 1;
             }
           } else {
@@ -1824,7 +1867,10 @@ int ClpMain1(int argc, const char *argv[], AbcSimplex *models)
             }
             if (canOpen) {
               ClpSimplex *model2 = models + iModel;
-              model2->writeBasis(fileName.c_str(), outputFormat > 1, outputFormat - 2);
+              if (outputFormat < 5)
+                model2->writeBasis(fileName.c_str(), outputFormat > 1, outputFormat - 2);
+              else
+                model2->writeBinaryBasis(fileName.c_str(), outputFormat > 5);
               time2 = CoinCpuTime();
               totalTime += time2 - time1;
               time1 = time2;
@@ -69,6 +69,159 @@ static void solveSmall(int nsolve, double **aIn, double **a, double *b)
     b[i] = value;
   }
 }
+#ifndef OSI_IDIOT
+#include "ClpHelperFunctions.hpp"
+// Columns per block before passes are split
+#define IDIOT_BLOCK 2000
+// Used by parallel passes
+typedef struct {
+  const double *cost;
+  const double *lower;
+  const double *upper;
+  const double *elemnt;
+  const int *row;
+  const CoinBigIndex *columnStart;
+  const int *length;
+  const double *colsol;
+  const double *sharedPi;
+  const double *sharedRowsol;
+  char *statusWork;
+  double *pi;
+  double *rowsol;
+  double *change;
+  double weight;
+  double djTol;
+  double djFlag;
+  double maxDj;
+  int nrows;
+  int first;
+  int last;
+  int direction;
+  int offset;
+  int strategy;
+  int nChange;
+  int nflagged;
+  int kgood;
+  int kbad;
+} clpIdiotPassInfo;
+/* One pass over columns first..last-1 using own copy of pi and rowsol.
+   Changes to columns are put in change (not applied to colsol) */
+static void idiotPassBit(clpIdiotPassInfo &info)
+{
+  const double *COIN_RESTRICT cost = info.cost;
+  const double *COIN_RESTRICT lower = info.lower;
+  const double *COIN_RESTRICT upper = info.upper;
+  const double *COIN_RESTRICT elemnt = info.elemnt;
+  const int *COIN_RESTRICT row = info.row;
+  const CoinBigIndex *COIN_RESTRICT columnStart = info.columnStart;
+  const int *COIN_RESTRICT length = info.length;
+  const double *COIN_RESTRICT colsol = info.colsol;
+  char *COIN_RESTRICT statusWork = info.statusWork;
+  double *COIN_RESTRICT pi = info.pi;
+  double *COIN_RESTRICT rowsol = info.rowsol;
+  double *COIN_RESTRICT change = info.change;
+  double weight = info.weight;
+  double djTol = info.djTol;
+  double djFlag = info.djFlag;
+  double maxDj = 0.0;
+  int nChange = 0;
+  int nflagged = 0;
+  int kgood = 0;
+  int kbad = 0;
+  CoinMemcpyN(info.sharedPi, info.nrows, pi);
+  CoinMemcpyN(info.sharedRowsol, info.nrows, rowsol);
+  int n = info.last - info.first;
+  for (int k = 0; k < n; k++) {
+    int kk = (info.offset + k) % n;
+    int icol = info.direction > 0 ? info.first + kk : info.last - 1 - kk;
+    change[icol] = 0.0;
+    if (statusWork[icol])
+      continue;
+    CoinBigIndex j;
+    double value = colsol[icol];
+    double djval = cost[icol];
+    double djval2, value2;
+    if (elemnt) {
+      for (j = columnStart[icol]; j < columnStart[icol] + length[icol]; j++)
+        djval -= elemnt[j] * pi[row[j]];
+    } else {
+      for (j = columnStart[icol]; j < columnStart[icol] + length[icol]; j++)
+        djval -= pi[row[j]];
+    }
+    if (djval > 1.0e-5) {
+      value2 = (lower[icol] - value);
+    } else {
+      value2 = (upper[icol] - value);
+    }
+    djval2 = djval * value2;
+    djval = fabs(djval);
+    if (djval <= djTol)
+      continue;
+    if (djval2 < -1.0e-4) {
+      nChange++;
+      if (djval > maxDj)
+        maxDj = djval;
+      double a = 0.0;
+      double b = 0.0;
+      if (elemnt) {
+        for (j = columnStart[icol]; j < columnStart[icol] + length[icol]; j++) {
+          a += elemnt[j] * elemnt[j];
+          b += rowsol[row[j]] * elemnt[j];
+        }
+      } else {
+        for (j = columnStart[icol]; j < columnStart[icol] + length[icol]; j++) {
+          a += 1.0;
+          b += rowsol[row[j]];
+        }
+      }
+      a *= weight;
+      b = b * weight + 0.5 * cost[icol];
+      /* solve */
+      double theta = -b / a;
+      if ((info.strategy & 4) != 0) {
+        double valuep, thetap;
+        value2 = a * theta * theta + 2.0 * b * theta;
+        thetap = 2.0 * theta;
+        valuep = a * thetap * thetap + 2.0 * b * thetap;
+        if (valuep < value2 + djTol) {
+          theta = thetap;
+          kgood++;
+        } else {
+          kbad++;
+        }
+      }
+      if (theta > 0.0) {
+        value2 = CoinMin(theta, upper[icol] - value);
+      } else {
+        value2 = CoinMax(theta, lower[icol] - value);
+      }
+      change[icol] = value2;
+      if (elemnt) {
+        for (j = columnStart[icol]; j < columnStart[icol] + length[icol]; j++) {
+          int irow = row[j];
+          rowsol[irow] += elemnt[j] * value2;
+          pi[irow] = -2.0 * weight * rowsol[irow];
+        }
+      } else {
+        for (j = columnStart[icol]; j < columnStart[icol] + length[icol]; j++) {
+          int irow = row[j];
+          rowsol[irow] += value2;
+          pi[irow] = -2.0 * weight * rowsol[irow];
+        }
+      }
+    } else if (djval > djFlag) {
+      /* dj but at bound */
+      statusWork[icol] = 1;
+      nflagged++;
+    }
+  }
+  info.maxDj = maxDj;
+  info.nChange = nChange;
+  info.nflagged = nflagged;
+  info.kgood = kgood;
+  info.kbad = kbad;
+}
+#endif
 IdiotResult
 Idiot::objval(int nrows, int ncols, double *rowsol, double *colsol,
   double *pi, double * /*djs*/, const double *cost,
@@ -366,6 +519,64 @@ Idiot::IdiSolve(
       statusSave[i] = 1;
     }
   }
+#endif
+#if !defined(FOUR_GOES) && !defined(OSI_IDIOT)
+  /* parallel passes (only if asked for) - columns split into fixed
+     blocks so result does not depend on number of threads */
+  int numberBlocks = CoinMin(numberBlocks_, ncols / IDIOT_BLOCK);
+  clpIdiotPassInfo *passInfo = NULL;
+  double *COIN_RESTRICT passWork = NULL;
+  double *COIN_RESTRICT passScale = NULL;
+  if (numberBlocks > 1) {
+    passInfo = new clpIdiotPassInfo[numberBlocks];
+    passWork = new double[ncols + 2 * numberBlocks * nrows];
+    passScale = new double[ncols];
+    /* Changes to a column are scaled down by number of blocks
+       touching its rows so change in any row is no more than
+       average of changes blocks wanted */
+    int *count = new int[2 * nrows];
+    int *lastBlock = count + nrows;
+    for (i = 0; i < nrows; i++) {
+      count[i] = 0;
+      lastBlock[i] = -1;
+    }
+    for (int iBlock = 0; iBlock < numberBlocks; iBlock++) {
+      clpIdiotPassInfo &info = passInfo[iBlock];
+      info.first = static_cast< int >((static_cast< double >(ncols) * iBlock) / numberBlocks);
+      info.last = static_cast< int >((static_cast< double >(ncols) * (iBlock + 1)) / numberBlocks);
+      for (i = info.first; i < info.last; i++) {
+        for (j = columnStart[i]; j < columnStart[i] + length[i]; j++) {
+          int irow = row[j];
+          if (lastBlock[irow] != iBlock) {
+            lastBlock[irow] = iBlock;
+            count[irow]++;
+          }
+        }
+      }
+      info.cost = cost;
+      info.lower = lower;
+      info.upper = upper;
+      info.elemnt = elemnt;
+      info.row = row;
+      info.columnStart = columnStart;
+      info.length = length;
+      info.colsol = colsol;
+      info.sharedPi = pi;
+      info.sharedRowsol = rowsol;
+      info.statusWork = statusWork;
+      info.change = passWork;
+      info.pi = passWork + ncols + 2 * iBlock * nrows;
+      info.rowsol = info.pi + nrows;
+      info.nrows = nrows;
+    }
+    for (i = 0; i < ncols; i++) {
+      int maxCount = 1;
+      for (j = columnStart[i]; j < columnStart[i] + length[i]; j++)
+        maxCount = CoinMax(maxCount, count[row[j]]);
+      passScale[i] = 1.0 / static_cast< double >(maxCount);
+    }
+    delete[] count;
+  }
 #endif
   // for two pass method
   int start[2];
@@ -954,6 +1165,43 @@ Idiot::IdiSolve(
       nflaggedX[i] = 0;
     }
     cilk_sync;
+#endif
+#if !defined(FOUR_GOES) && !defined(OSI_IDIOT)
+    if (numberBlocks > 1) {
+      // blocks in parallel then merge in order
+      for (int iBlock = 0; iBlock < numberBlocks; iBlock++) {
+        clpIdiotPassInfo &info = passInfo[iBlock];
+        info.weight = weight;
+        info.djTol = djTol;
+        info.djFlag = djFlag;
+        info.direction = direction;
+        info.offset = start[0] % (info.last - info.first);
+        info.strategy = strategy;
+      }
+      clpParallelFor(idiotPassBit, passInfo, numberBlocks);
+      for (int iBlock = 0; iBlock < numberBlocks; iBlock++) {
+        clpIdiotPassInfo &info = passInfo[iBlock];
+        nChange += info.nChange;
+        nflagged += info.nflagged;
+        kgood += info.kgood;
+        kbad += info.kbad;
+        if (info.maxDj > maxDj)
+          maxDj = info.maxDj;
+        for (int icol = info.first; icol < info.last; icol++) {
+          double value2 = passWork[icol];
+          if (value2) {
+            value2 *= passScale[icol];
+            colsol[icol] += value2;
+            objvalue += cost[icol] * value2;
+            for (j = columnStart[icol]; j < columnStart[icol] + length[icol]; j++) {
+              int irow = row[j];
+              rowsol[irow] += (elemnt ? elemnt[j] : 1.0) * value2;
+              pi[irow] = -2.0 * weight * rowsol[irow];
+            }
+          }
+        }
+      }
+    } else {
 #endif
     //printf("PASS\n");
 #ifdef FOUR_GOES
@@ -1121,6 +1369,9 @@ Idiot::IdiSolve(
       }
 #endif
     }
+#if !defined(FOUR_GOES) && !defined(OSI_IDIOT)
+    }
+#endif
 #ifdef FOUR_GOES
     for (int i = 0; i < FOUR_GOES; i++) {
       nChange += nChangeX[i];
@@ -1251,6 +1502,11 @@ RETURN:
 #ifdef FOUR_GOES
   delete[] pi2;
   delete[] rowsol2;
+#endif
+#if !defined(FOUR_GOES) && !defined(OSI_IDIOT)
+  delete[] passInfo;
+  delete[] passWork;
+  delete[] passScale;
 #endif
   for (i = 0; i < HISTORY + 1; i++) {
     delete[] history[i];
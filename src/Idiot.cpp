@@ -2269,6 +2269,7 @@ Idiot::Idiot()
   maxIts2_ = 100;
   reasonableInfeas_ = static_cast< double >(nrows) * 0.05;
   lightWeight_ = 0;
+  numberBlocks_ = 0;
 }
 // Constructor from model
 Idiot::Idiot(OsiSolverInterface &model)
@@ -2311,6 +2312,7 @@ Idiot::Idiot(OsiSolverInterface &model)
   maxIts2_ = 100;
   reasonableInfeas_ = static_cast< double >(nrows) * 0.05;
   lightWeight_ = 0;
+  numberBlocks_ = 0;
 }
 // Copy constructor.
 Idiot::Idiot(const Idiot &rhs)
@@ -2347,6 +2349,7 @@ Idiot::Idiot(const Idiot &rhs)
   maxIts2_ = rhs.maxIts2_;
   strategy_ = rhs.strategy_;
   lightWeight_ = rhs.lightWeight_;
+  numberBlocks_ = rhs.numberBlocks_;
 }
 // Assignment operator. This copies the data
 Idiot &
@@ -2386,6 +2389,7 @@ Idiot::operator=(const Idiot &rhs)
     maxIts2_ = rhs.maxIts2_;
     strategy_ = rhs.strategy_;
     lightWeight_ = rhs.lightWeight_;
+    numberBlocks_ = rhs.numberBlocks_;
   }
   return *this;
 }
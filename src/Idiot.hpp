@@ -229,6 +229,18 @@ public:
   {
     dropEnoughWeighted_ = value;
   }
+  /** Number of column blocks for coordinate passes - 0 or 1 (default)
+      is normal serial pass.  If more, blocks are updated independently
+      (in parallel if threads) and merged each pass.  Result depends
+      on number of blocks but not on number of threads */
+  inline int getNumberBlocks() const
+  {
+    return numberBlocks_;
+  }
+  inline void setNumberBlocks(int value)
+  {
+    numberBlocks_ = value;
+  }
   /// Set model
   inline void setModel(OsiSolverInterface *model)
   {
@@ -332,6 +344,7 @@ private:
 		 524288 - don't treat structural slacks as slacks */
 
   int lightWeight_; // 0 - normal, 1 lightweight
+  int numberBlocks_; // blocks for passes (0 or 1 - serial)
 };
 #endif
 
@@ -19,6 +19,7 @@
 //-------------------------------------------------------------------
 MyEventHandler::MyEventHandler()
   : ClpEventHandler()
+  , numberAdaptive_(0)
 {
 }
 
@@ -27,12 +28,14 @@ MyEventHandler::MyEventHandler()
 //-------------------------------------------------------------------
 MyEventHandler::MyEventHandler(const MyEventHandler &rhs)
   : ClpEventHandler(rhs)
+  , numberAdaptive_(rhs.numberAdaptive_)
 {
 }
 
 // Constructor with pointer to model
 MyEventHandler::MyEventHandler(ClpSimplex *model)
   : ClpEventHandler(model)
+  , numberAdaptive_(0)
 {
 }
 
@@ -51,6 +54,7 @@ MyEventHandler::operator=(const MyEventHandler &rhs)
 {
   if (this != &rhs) {
     ClpEventHandler::operator=(rhs);
+    numberAdaptive_ = rhs.numberAdaptive_;
   }
   return *this;
 }
@@ -64,6 +68,8 @@ ClpEventHandler *MyEventHandler::clone() const
 
 int MyEventHandler::event(Event whichEvent)
 {
+  if (whichEvent == adaptiveRefactorization)
+    numberAdaptive_++;
   if (whichEvent == endOfValuesPass)
     return 0; // say optimal
   else
@@ -39,8 +39,16 @@ public:
   virtual ClpEventHandler *clone() const;
   //@}
 
+  /// Number of adaptiveRefactorization events seen
+  inline int numberAdaptive() const
+  {
+    return numberAdaptive_;
+  }
+
 protected:
   // data goes here
+  /// Number of adaptiveRefactorization events seen
+  int numberAdaptive_;
 };
 
 #endif
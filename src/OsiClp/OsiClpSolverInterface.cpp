@@ -7103,6 +7103,11 @@ void OsiClpSolverInterface::getBInvRow(int row, double *z) const
 void OsiClpSolverInterface::getBInvACol(int col, double *vec) const
 {
   //assert (modelPtr_->solveType()==2||(specialOptions_&1)!=0);
+  if ((specialOptions_ & 512) == 0) {
+    // same as ClpSimplex
+    modelPtr_->getBInvACols(1, &col, vec);
+    return;
+  }
   CoinIndexedVector *rowArray0 = modelPtr_->rowArray(0);
   CoinIndexedVector *rowArray1 = modelPtr_->rowArray(1);
   rowArray0->clear();
@@ -7114,9 +7119,7 @@ void OsiClpSolverInterface::getBInvACol(int col, double *vec) const
     indexError(col, "getBInvACol");
   }
 #endif
-  int numberRows = modelPtr_->numberRows();
   int numberColumns = modelPtr_->numberColumns();
-  const int *pivotVariable = modelPtr_->pivotVariable();
   const double *rowScale = modelPtr_->rowScale();
   const double *columnScale = modelPtr_->columnScale();
   if (!rowScale) {
@@ -7142,28 +7145,13 @@ void OsiClpSolverInterface::getBInvACol(int col, double *vec) const
       rowArray1->insert(col - numberColumns, rowScale[col - numberColumns]);
     }
   }
+  // user is sophisticated so let her/him do work
   modelPtr_->factorization()->updateColumn(rowArray0, rowArray1, false);
-  // If user is sophisticated then let her/him do work
-  if ((specialOptions_ & 512) == 0) {
-    // otherwise copy and clear
-    // But swap if pivot variable was slack as clp stores slack as -1.0
-    double *array = rowArray1->denseVector();
-    if (!rowScale) {
-      for (int i = 0; i < numberRows; i++) {
-        double multiplier = (pivotVariable[i] < numberColumns) ? 1.0 : -1.0;
-        vec[i] = multiplier * array[i];
-      }
-    } else {
-      for (int i = 0; i < numberRows; i++) {
-        int pivot = pivotVariable[i];
-        if (pivot < numberColumns)
-          vec[i] = array[i] * columnScale[pivot];
-        else
-          vec[i] = -array[i] / rowScale[pivot - numberColumns];
-      }
-    }
-    rowArray1->clear();
-  }
+}
+//Get columns of the tableau
+void OsiClpSolverInterface::getBInvACols(int numberCols, const int *cols, double *vec) const
+{
+  modelPtr_->getBInvACols(numberCols, cols, vec);
 }
 //Get a column of the tableau
 void OsiClpSolverInterface::getBInvACol(int col, CoinIndexedVector *rowArray1) const
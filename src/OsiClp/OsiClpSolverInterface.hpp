@@ -153,6 +153,11 @@ public:
   ///Get a column of the tableau
   virtual void getBInvACol(int col, CoinIndexedVector *vec) const;
 
+  /** Get numberCols columns of the tableau - column k in
+      vec+k*getNumRows().  Columns are updated a block at a time.
+  */
+  void getBInvACols(int numberCols, const int *cols, double *vec) const;
+
   /** Update (i.e. ftran) the vector passed in.
       Unscaling is applied after - can't be applied before
   */
@@ -12,6 +12,7 @@
 #include <cassert>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <cmath>
 #include <cfloat>
 #include <string>
@@ -36,6 +37,12 @@
 #include "ClpSimplexOther.hpp"
 #include "ClpSimplexNonlinear.hpp"
 #include "ClpInterior.hpp"
+#include "ClpPdcoMatrix.hpp"
+#include "ClpMpsReader.hpp"
+#include "ClpParallelFactorization.hpp"
+#include "ClpCholeskyBase.hpp"
+#include "ClpCholeskyDense.hpp"
+#include "ClpCholeskySupernodal.hpp"
 #include "ClpLinearObjective.hpp"
 #include "ClpDualRowSteepest.hpp"
 #include "ClpDualRowDantzig.hpp"
@@ -48,7 +55,9 @@
 #include "MyEventHandler.hpp"
 
 #include "ClpPresolve.hpp"
+#include "ClpHelperFunctions.hpp"
 #include "Idiot.hpp"
+#include <pthread.h>
 #if FACTORIZATION_STATISTICS
 extern double ftranTwiddleFactor1X;
 extern double ftranTwiddleFactor2X;
@@ -86,9 +95,9 @@ static std::string nameBarrier = "barrier-MUMPS";
 static int barrierAvailable = 0;
 static std::string nameBarrier = "barrier-slow";
 #endif
-#define NUMBER_ALGORITHMS 12
+#define NUMBER_ALGORITHMS 13
 // If you just want a subset then set some to 1
-static int switchOff[NUMBER_ALGORITHMS] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+static int switchOff[NUMBER_ALGORITHMS] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 // shortName - 0 no , 1 yes
 ClpSolve setupForSolve(int algorithm, std::string &nameAlgorithm,
   int shortName)
@@ -102,6 +111,7 @@ ClpSolve setupForSolve(int algorithm, std::string &nameAlgorithm,
         6,7 automatic with and without
         8,9 primal with idiot 1 and 5
         10,11 primal with 70, dual with volume
+        12 concurrent
      */
   switch (algorithm) {
   case 0:
@@ -208,6 +218,13 @@ ClpSolve setupForSolve(int algorithm, std::string &nameAlgorithm,
     solveOptions.setSolveType(ClpSolve::notImplemented);
 #endif
     break;
+  case 12:
+    if (shortName)
+      nameAlgorithm = "conc";
+    else
+      nameAlgorithm = "concurrent";
+    solveOptions.setSolveType(ClpSolve::concurrent);
+    break;
   default:
     abort();
   }
@@ -218,6 +235,57 @@ ClpSolve setupForSolve(int algorithm, std::string &nameAlgorithm,
   }
   return solveOptions;
 }
+// For solves on several threads - each model is independent
+struct ClpThreadTestInfo {
+  ClpSimplex *model;
+  // 0 dual, 1 primal, 2 initialSolve
+  int algorithm;
+};
+static void solveThreadTest(ClpThreadTestInfo &info)
+{
+  if (info.algorithm == 2) {
+    ClpSolve solveOptions;
+    // no interrupt handling (so threadsafe)
+    solveOptions.setSpecialOption(2, 1);
+    info.model->initialSolve(solveOptions);
+  } else if (info.algorithm) {
+    info.model->primal();
+  } else {
+    info.model->dual();
+  }
+}
+static void *solveThreadTestThread(void *info)
+{
+  solveThreadTest(*reinterpret_cast< ClpThreadTestInfo * >(info));
+  return NULL;
+}
+// Counts crossover push batches from CLP_CROSSOVER_PUSH messages
+class ClpPushCountHandler : public CoinMessageHandler {
+public:
+  ClpPushCountHandler()
+    : CoinMessageHandler()
+    , numberMessages_(0)
+    , numberBatches_(0)
+  {
+    setLogLevel(1);
+  }
+  virtual int print()
+  {
+    // "%s push - %d variables pushed, %d basis changes in %d batches"
+    if (currentSource() == "Clp" && currentMessage().externalNumber() == 67) {
+      numberMessages_++;
+      numberBatches_ += intValue(2);
+    }
+    // nothing printed
+    return 0;
+  }
+  virtual CoinMessageHandler *clone() const
+  {
+    return new ClpPushCountHandler(*this);
+  }
+  int numberMessages_;
+  int numberBatches_;
+};
 static void printSol(ClpSimplex &model)
 {
   int numberRows = model.numberRows();
@@ -1553,6 +1621,65 @@ void ClpSimplexUnitTest(const std::string &dirSample)
       std::cerr << "Error reading exmip1 from sample data. Skipping test." << std::endl;
     }
   }
+  // Test refactorization decided from measured times
+  {
+    // dense enough for factorization to take measurable time
+    int numberRows = 300;
+    int numberColumns = 600;
+    int maximumElements = numberRows * numberColumns;
+    int *rowIndices = new int[maximumElements];
+    int *colIndices = new int[maximumElements];
+    double *elements = new double[maximumElements];
+    double *objective = new double[numberColumns];
+    double *colLower = new double[numberColumns];
+    double *colUpper = new double[numberColumns];
+    double *rowLower = new double[numberRows];
+    double *rowUpper = new double[numberRows];
+    int numberElements = 0;
+    int i, j;
+    CoinSeedRandom(1234567);
+    for (j = 0; j < numberColumns; j++) {
+      for (i = 0; i < numberRows; i++) {
+        if (CoinDrand48() < 0.2) {
+          rowIndices[numberElements] = i;
+          colIndices[numberElements] = j;
+          elements[numberElements++] = 1.0 + 9.0 * CoinDrand48();
+        }
+      }
+      objective[j] = -1.0 - CoinDrand48();
+      colLower[j] = 0.0;
+      colUpper[j] = 10.0;
+    }
+    for (i = 0; i < numberRows; i++) {
+      rowLower[i] = -COIN_DBL_MAX;
+      rowUpper[i] = 100.0 + 100.0 * CoinDrand48();
+    }
+    CoinPackedMatrix matrix(true, rowIndices, colIndices, elements, numberElements);
+    ClpSimplex model;
+    model.loadProblem(matrix, colLower, colUpper, objective, rowLower, rowUpper);
+    model.setLogLevel(0);
+    ClpSimplex timed(model);
+    model.primal();
+    assert(!model.status());
+    MyEventHandler handler;
+    timed.passInEventHandler(&handler);
+    timed.setMoreSpecialOptions(timed.moreSpecialOptions() | 33554432);
+    timed.primal();
+    assert(!timed.status());
+    CoinRelFltEq eq(1.0e-8);
+    assert(eq(timed.objectiveValue(), model.objectiveValue()));
+    // handler was cloned into model
+    const MyEventHandler *timedHandler = dynamic_cast< const MyEventHandler * >(timed.eventHandler());
+    assert(timedHandler && timedHandler->numberAdaptive() > 0);
+    delete[] rowIndices;
+    delete[] colIndices;
+    delete[] elements;
+    delete[] objective;
+    delete[] colLower;
+    delete[] colUpper;
+    delete[] rowLower;
+    delete[] rowUpper;
+  }
   // Test Message handler
   {
     CoinMpsIO m;
@@ -1709,6 +1836,57 @@ void ClpSimplexUnitTest(const std::string &dirSample)
                               NULL, NULL, rhs, rhs, NULL);
 #endif
   }
+  // Test primal ranging done in blocks against one at a time
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "brandy";
+    if (m.readMps(fn.c_str(), "mps") == 0) {
+      ClpSimplex model;
+      model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      model.setLogLevel(0);
+      model.primal();
+      int numberTotal = model.numberRows() + model.numberColumns();
+      int *which = new int[numberTotal];
+      double *valueIncrease = new double[numberTotal];
+      int *sequenceIncrease = new int[numberTotal];
+      double *valueDecrease = new double[numberTotal];
+      int *sequenceDecrease = new int[numberTotal];
+      int i;
+      for (i = 0; i < numberTotal; i++)
+        which[i] = i;
+      // normal factorization then parallel (columns updated together)
+      for (int iPass = 0; iPass < 2; iPass++) {
+        if (iPass)
+          model.factorization()->forceOtherFactorization(5);
+        model.primalRanging(numberTotal, which, valueIncrease, sequenceIncrease,
+          valueDecrease, sequenceDecrease);
+        for (i = 0; i < numberTotal; i++) {
+          // one column is same as old code
+          double valueUp;
+          int sequenceUp;
+          double valueDown;
+          int sequenceDown;
+          model.primalRanging(1, which + i, &valueUp, &sequenceUp,
+            &valueDown, &sequenceDown);
+          if (!iPass) {
+            assert(sequenceUp == sequenceIncrease[i]);
+            assert(sequenceDown == sequenceDecrease[i]);
+          }
+          assert(fabs(valueUp - valueIncrease[i]) < 1.0e-7 * (1.0 + fabs(valueUp)));
+          assert(fabs(valueDown - valueDecrease[i]) < 1.0e-7 * (1.0 + fabs(valueDown)));
+        }
+      }
+      delete[] which;
+      delete[] valueIncrease;
+      delete[] sequenceIncrease;
+      delete[] valueDecrease;
+      delete[] sequenceDecrease;
+    } else {
+      std::cerr << "Error reading brandy from sample data. Skipping test." << std::endl;
+    }
+  }
   // Test binv etc
   {
     /*
@@ -1865,6 +2043,46 @@ void ClpSimplexUnitTest(const std::string &dirSample)
     model.setWhatsChanged(model.whatsChanged() & (~512));
     model.dual(0, 2); // hopefully will not use factorization
   }
+  // Test getBInvACols against getBInvACol
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "brandy";
+    if (m.readMps(fn.c_str(), "mps") == 0) {
+      ClpSimplex model;
+      model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      model.setLogLevel(0);
+      int numberRows = model.numberRows();
+      int numberTotal = numberRows + model.numberColumns();
+      int *cols = new int[numberTotal];
+      double *binvA = new double[numberTotal * numberRows];
+      double *column = new double[numberRows];
+      int i, j;
+      // every other column backwards so block is not in order
+      int numberCols = 0;
+      for (i = numberTotal - 1; i >= 0; i -= 2)
+        cols[numberCols++] = i;
+      // normal factorization then parallel (columns updated together)
+      for (int iPass = 0; iPass < 2; iPass++) {
+        if (iPass)
+          model.factorization()->forceOtherFactorization(5);
+        model.dual(0, 1); // keep factorization
+        model.getBInvACols(numberCols, cols, binvA);
+        for (i = 0; i < numberCols; i++) {
+          model.getBInvACol(cols[i], column);
+          const double *block = binvA + i * numberRows;
+          for (j = 0; j < numberRows; j++)
+            assert(fabs(block[j] - column[j]) < 1.0e-10 * (1.0 + fabs(column[j])));
+        }
+      }
+      delete[] cols;
+      delete[] binvA;
+      delete[] column;
+    } else {
+      std::cerr << "Error reading brandy from sample data. Skipping test." << std::endl;
+    }
+  }
   // test steepest edge
   {
     CoinMpsIO m;
@@ -1980,6 +2198,138 @@ void ClpSimplexUnitTest(const std::string &dirSample)
       std::cerr << "Error reading afiro from sample data. Skipping test." << std::endl;
     }
   }
+  // Test parallel strong branching gives same answers as serial
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "afiro";
+    if (m.readMps(fn.c_str(), "mps") == 0) {
+      ClpSimplex model;
+      model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      model.setLogLevel(0);
+      model.dual();
+      assert(!model.status());
+      int numberColumns = model.numberColumns();
+      const double *solution = model.primalColumnSolution();
+      int *which = new int[numberColumns];
+      double *downSerial = new double[numberColumns];
+      double *upSerial = new double[numberColumns];
+      double *downParallel = new double[numberColumns];
+      double *upParallel = new double[numberColumns];
+      int *statusSerial = new int[2 * numberColumns];
+      int *statusParallel = new int[2 * numberColumns];
+      int *iterationsSerial = new int[2 * numberColumns];
+      int *iterationsParallel = new int[2 * numberColumns];
+      int numberFractional = 0;
+      int iColumn;
+      for (iColumn = 0; iColumn < numberColumns; iColumn++) {
+        double value = solution[iColumn];
+        if (fabs(value - floor(value + 0.5)) > 1.0e-6) {
+          which[numberFractional] = iColumn;
+          // new upper for down branch and new lower for up branch
+          downSerial[numberFractional] = floor(value);
+          upSerial[numberFractional++] = ceil(value);
+        }
+      }
+      assert(numberFractional > 1);
+      CoinMemcpyN(downSerial, numberFractional, downParallel);
+      CoinMemcpyN(upSerial, numberFractional, upParallel);
+      ClpSimplex serialModel(model);
+      int returnSerial = serialModel.strongBranching(numberFractional, which,
+        upSerial, downSerial, NULL, statusSerial, iterationsSerial,
+        false, false, 0);
+      ClpSimplex parallelModel(model);
+      int returnParallel = parallelModel.parallelStrongBranching(4,
+        numberFractional, which,
+        upParallel, downParallel, NULL, statusParallel, iterationsParallel,
+        false, false, 0);
+      assert(returnSerial == returnParallel);
+      // model itself not changed
+      assert(parallelModel.objectiveValue() == model.objectiveValue());
+      assert(!memcmp(parallelModel.primalColumnSolution(), solution,
+        numberColumns * sizeof(double)));
+      CoinRelFltEq eq(1.0e-7);
+      for (int i = 0; i < numberFractional; i++) {
+        assert(statusSerial[2 * i] == statusParallel[2 * i]);
+        assert(statusSerial[2 * i + 1] == statusParallel[2 * i + 1]);
+        // objective changes (or 1.0e100 if infeasible)
+        assert(eq(downSerial[i], downParallel[i]));
+        assert(eq(upSerial[i], upParallel[i]));
+      }
+      delete[] which;
+      delete[] downSerial;
+      delete[] upSerial;
+      delete[] downParallel;
+      delete[] upParallel;
+      delete[] statusSerial;
+      delete[] statusParallel;
+      delete[] iterationsSerial;
+      delete[] iterationsParallel;
+    } else {
+      std::cerr << "Error reading afiro from sample data. Skipping test." << std::endl;
+    }
+  }
+  // Test strong branching on nonbasic columns against resolving
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "afiro";
+    if (m.readMps(fn.c_str(), "mps") == 0) {
+      ClpSimplex model;
+      model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      model.setLogLevel(0);
+      model.dual();
+      assert(!model.status());
+      int numberColumns = model.numberColumns();
+      const double *solution = model.primalColumnSolution();
+      const double *columnUpper = model.columnUpper();
+      int *which = new int[numberColumns];
+      double *newLower = new double[numberColumns];
+      double *newUpper = new double[numberColumns];
+      int *status = new int[2 * numberColumns];
+      int *iterations = new int[2 * numberColumns];
+      int numberNonbasic = 0;
+      int iColumn;
+      for (iColumn = 0; iColumn < numberColumns; iColumn++) {
+        if (model.getColumnStatus(iColumn) == ClpSimplex::atLowerBound && columnUpper[iColumn] > 1.0e10) {
+          /* up branch moves off bound a little (often with no
+             iterations) and down branch changes nothing */
+          which[numberNonbasic] = iColumn;
+          newLower[numberNonbasic] = solution[iColumn] + 0.01;
+          newUpper[numberNonbasic++] = 1.0e10;
+        }
+      }
+      assert(numberNonbasic > 1);
+      ClpSimplex branchModel(model);
+      branchModel.strongBranching(numberNonbasic, which,
+        newLower, newUpper, NULL, status, iterations,
+        false, false, 0);
+      for (int i = 0; i < numberNonbasic; i++) {
+        iColumn = which[i];
+        // down branch
+        assert(fabs(newUpper[i]) < 1.0e-7);
+        ClpSimplex resolve(model);
+        resolve.setColumnLower(iColumn, solution[iColumn] + 0.01);
+        resolve.dual();
+        if (newLower[i] < 1.0e50) {
+          assert(!resolve.status());
+          double change = resolve.objectiveValue() - model.objectiveValue();
+          assert(fabs(newLower[i] - change) < 1.0e-7 * (1.0 + fabs(change)));
+        } else {
+          assert(resolve.status() == 1);
+        }
+      }
+      delete[] which;
+      delete[] newLower;
+      delete[] newUpper;
+      delete[] status;
+      delete[] iterations;
+    } else {
+      std::cerr << "Error reading afiro from sample data. Skipping test." << std::endl;
+    }
+  }
   // test unbounded
   {
     CoinMpsIO m;
@@ -2330,6 +2680,61 @@ void ClpSimplexUnitTest(const std::string &dirSample)
       std::cerr << "Error reading brandy from sample data. Skipping test." << std::endl;
     }
   }
+  // Test independent models solved at same time on several threads
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "brandy";
+    if (m.readMps(fn.c_str(), "mps") == 0) {
+      const int numberModels = 8;
+      ClpSimplex base;
+      base.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      base.setLogLevel(0);
+      ClpSimplex *serial[numberModels];
+      ClpSimplex *threaded[numberModels];
+      ClpThreadTestInfo info[numberModels];
+      int i;
+      for (i = 0; i < numberModels; i++) {
+        serial[i] = new ClpSimplex(base);
+        // make models a bit different
+        double *objective = serial[i]->objective();
+        objective[i] *= 1.0 + 0.1 * i;
+        threaded[i] = new ClpSimplex(*serial[i]);
+        info[i].model = serial[i];
+        info[i].algorithm = i % 3;
+      }
+      for (i = 0; i < numberModels; i++)
+        solveThreadTest(info[i]);
+      for (i = 0; i < numberModels; i++)
+        info[i].model = threaded[i];
+      // one thread per model - even without pool
+      pthread_t threadId[numberModels];
+      for (i = 0; i < numberModels; i++) {
+        int errorCode = pthread_create(threadId + i, NULL, solveThreadTestThread, info + i);
+        assert(!errorCode);
+      }
+      for (i = 0; i < numberModels; i++)
+        pthread_join(threadId[i], NULL);
+      int numberColumns = base.numberColumns();
+      int numberRows = base.numberRows();
+      for (i = 0; i < numberModels; i++) {
+        /* same code and same start so must be identical - initialSolve
+           makes no decisions on time or global state */
+        assert(threaded[i]->status() == serial[i]->status());
+        assert(threaded[i]->numberIterations() == serial[i]->numberIterations());
+        assert(threaded[i]->objectiveValue() == serial[i]->objectiveValue());
+        assert(!memcmp(threaded[i]->primalColumnSolution(),
+          serial[i]->primalColumnSolution(), numberColumns * sizeof(double)));
+        assert(!memcmp(threaded[i]->dualRowSolution(),
+          serial[i]->dualRowSolution(), numberRows * sizeof(double)));
+        delete serial[i];
+        delete threaded[i];
+      }
+    } else {
+      std::cerr << "Error reading brandy from sample data. Skipping test." << std::endl;
+    }
+  }
 #if 1
   // Test barrier
   {
@@ -2346,6 +2751,1045 @@ void ClpSimplexUnitTest(const std::string &dirSample)
     }
   }
 #endif
+  // Test supernodal cholesky against native and over threads
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "afiro";
+    if (m.readMps(fn.c_str(), "mps") == 0) {
+      ClpInterior native;
+      native.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      native.setLogLevel(0);
+      ClpInterior serial(native);
+      ClpInterior threaded(native);
+      native.setCholesky(new ClpCholeskyBase());
+      native.primalDual();
+      ClpCholeskySupernodal *cholesky = new ClpCholeskySupernodal(1);
+      serial.setCholesky(cholesky);
+      serial.primalDual();
+      assert(cholesky->numberSupernodes() > 0);
+      threaded.setCholesky(new ClpCholeskySupernodal(4));
+      threaded.primalDual();
+      // barrier so not exact
+      CoinRelFltEq eq(1.0e-5);
+      assert(eq(serial.objectiveValue(), native.objectiveValue()));
+      assert(eq(serial.objectiveValue(), -4.6475314286e+02));
+      // partitioning does not depend on threads so must be identical
+      assert(threaded.numberIterations() == serial.numberIterations());
+      assert(threaded.objectiveValue() == serial.objectiveValue());
+      assert(!memcmp(threaded.primalColumnSolution(), serial.primalColumnSolution(),
+        serial.numberColumns() * sizeof(double)));
+    } else {
+      std::cerr << "Error reading afiro from sample data. Skipping test." << std::endl;
+    }
+  }
+  // Test dense cholesky with several right hand sides
+  {
+    // 7 blocks is done serially and 38 blocks in panels over threads
+    int sizes[2] = { 100, 600 };
+    int threads[2] = { 1, 4 };
+    int saveThreads = clpSetParallelThreads(1);
+    CoinSeedRandom(7654321);
+    for (int iSize = 0; iSize < 2; iSize++) {
+      int n = sizes[iSize];
+      // symmetric and diagonally dominant so no rows dropped
+      double *full = new double[n * n];
+      for (int i = 0; i < n; i++) {
+        full[i * n + i] = static_cast< double >(n);
+        for (int j = i + 1; j < n; j++) {
+          double value = CoinDrand48() - 0.5;
+          full[i * n + j] = value;
+          full[j * n + i] = value;
+        }
+      }
+      const int numberRhs = 3;
+      double *rhs = new double[numberRhs * n];
+      for (int i = 0; i < numberRhs * n; i++)
+        rhs[i] = CoinDrand48() - 0.5;
+      for (int iThread = 0; iThread < 2; iThread++) {
+        clpSetParallelThreads(threads[iThread]);
+        ClpCholeskyDense dense;
+        dense.reserveSpace(NULL, n);
+        dense.setDoubleParameter(10, 1.0e-20);
+        dense.setIntegerParameter(34, 0);
+        longDouble *blob = dense.aMatrix();
+        longDouble *diagonal = dense.diagonal();
+        for (int i = 0; i < n; i++) {
+          diagonal[i] = full[i * n + i];
+          for (int j = i + 1; j < n; j++)
+            *blob++ = full[i * n + j];
+        }
+        int *dropped = new int[n];
+        memset(dropped, 0, n * sizeof(int));
+        dense.factorizePart2(dropped);
+        for (int i = 0; i < n; i++)
+          assert(!dropped[i]);
+        delete[] dropped;
+        CoinWorkDouble *multiple = new CoinWorkDouble[numberRhs * n];
+        CoinWorkDouble *single = new CoinWorkDouble[n];
+        for (int i = 0; i < numberRhs * n; i++)
+          multiple[i] = rhs[i];
+        dense.solveMultiple(multiple, numberRhs);
+        for (int k = 0; k < numberRhs; k++) {
+          for (int i = 0; i < n; i++)
+            single[i] = rhs[k * n + i];
+          dense.solve(single);
+          // same operations in same order
+          for (int i = 0; i < n; i++)
+            assert(single[i] == multiple[k * n + i]);
+          // and it is a solution
+          for (int i = 0; i < n; i++) {
+            double value = -rhs[k * n + i];
+            for (int j = 0; j < n; j++)
+              value += full[i * n + j] * single[j];
+            assert(fabs(value) < 1.0e-8);
+          }
+        }
+        delete[] multiple;
+        delete[] single;
+      }
+      delete[] full;
+      delete[] rhs;
+    }
+    clpSetParallelThreads(saveThreads);
+  }
+  // Test nested dissection ordering
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "brandy";
+    if (m.readMps(fn.c_str(), "mps") == 0) {
+      ClpInterior model;
+      model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      model.setLogLevel(0);
+      ClpCholeskyBase *cholesky = new ClpCholeskyBase();
+      cholesky->setOrderingType(1);
+      model.setCholesky(cholesky);
+      model.primalDual();
+      // barrier so not exact
+      CoinRelFltEq eq(1.0e-5);
+      assert(eq(model.objectiveValue(), 1.5185098965e+03));
+      // independent parts do not overlap
+      int numberSubtrees = cholesky->numberSubtrees();
+      const int *subtrees = cholesky->subtrees();
+      int numberRows = model.numberRows();
+      char *used = new char[numberRows];
+      memset(used, 0, numberRows);
+      assert(numberSubtrees > 0);
+      for (int i = 0; i < numberSubtrees; i++) {
+        assert(subtrees[2 * i] >= 0 && subtrees[2 * i] < subtrees[2 * i + 1]);
+        assert(subtrees[2 * i + 1] <= numberRows);
+        for (int j = subtrees[2 * i]; j < subtrees[2 * i + 1]; j++) {
+          assert(!used[j]);
+          used[j] = 1;
+        }
+      }
+      delete[] used;
+      // choose by predicted fill through ClpSolve
+      ClpSimplex simplex;
+      simplex.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      simplex.setLogLevel(0);
+      ClpSolve solveOptions;
+      solveOptions.setSolveType(ClpSolve::useBarrier);
+      solveOptions.setSpecialOption(4, 65536);
+      simplex.initialSolve(solveOptions);
+      assert(!simplex.status());
+      assert(eq(simplex.objectiveValue(), 1.5185098965e+03));
+    } else {
+      std::cerr << "Error reading brandy from sample data. Skipping test." << std::endl;
+    }
+  }
+  // Test barrier warm start
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "afiro";
+    if (m.readMps(fn.c_str(), "mps") == 0) {
+      ClpInterior model;
+      model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      model.setLogLevel(0);
+      ClpCholeskyBase *cholesky = new ClpCholeskyBase();
+      model.setCholesky(cholesky);
+      model.primalDual();
+      CoinRelFltEq eq(1.0e-5);
+      assert(eq(model.objectiveValue(), -4.6475314286e+02));
+      assert(!cholesky->numberReused());
+      // change right hand side a little and warm start from last solution
+      int numberRows = model.numberRows();
+      double *rowLower = model.rowLower();
+      double *rowUpper = model.rowUpper();
+      for (int iRow = 0; iRow < numberRows; iRow++) {
+        double multiplier = 1.0 + 0.001 * (iRow % 3);
+        if (rowLower[iRow] > -COIN_DBL_MAX)
+          rowLower[iRow] *= multiplier;
+        if (rowUpper[iRow] < COIN_DBL_MAX)
+          rowUpper[iRow] *= multiplier;
+      }
+      ClpInterior cold;
+      cold.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(), rowLower, rowUpper);
+      cold.setLogLevel(0);
+      cold.setCholesky(new ClpCholeskyBase());
+      cold.primalDual();
+      model.setWarmStart();
+      assert(model.warmStart());
+      model.primalDual();
+      // only used once
+      assert(!model.warmStart());
+      // same matrix so ordering and symbolic factorization kept
+      assert(cholesky->numberReused() == 1);
+      assert(!model.status() && !cold.status());
+      assert(eq(model.objectiveValue(), cold.objectiveValue()));
+      // and starting near solution saves work
+      assert(model.numberIterations() < cold.numberIterations());
+    } else {
+      std::cerr << "Error reading afiro from sample data. Skipping test." << std::endl;
+    }
+  }
+  // Test reuse, export and import of symbolic cholesky
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "afiro";
+    if (m.readMps(fn.c_str(), "mps") == 0) {
+      ClpInterior model;
+      model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      model.setLogLevel(0);
+      ClpInterior same(model);
+      ClpInterior cold(model);
+      ClpCholeskyBase *cholesky = new ClpCholeskyBase();
+      model.setCholesky(cholesky);
+      model.primalDual();
+      // hash set after symbolic and only depends on structure
+      unsigned int hash = cholesky->structureHash();
+      assert(hash);
+      assert(hash == ClpCholeskyBase::computeStructureHash(&model));
+      assert(hash == ClpCholeskyBase::computeStructureHash(&same));
+      // same pattern so ordering and symbolic kept
+      assert(!cholesky->reuseSymbolic(&model));
+      ClpCholeskyBase *symbolic = model.exportSymbolic();
+      assert(symbolic);
+      assert(symbolic->structureHash() == hash);
+      // other model with same structure but different values
+      int numberColumns = same.numberColumns();
+      double *objective = same.objective();
+      double *objective2 = cold.objective();
+      for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+        objective[iColumn] *= 1.0 + 0.01 * (iColumn % 3);
+        objective2[iColumn] = objective[iColumn];
+      }
+      assert(!same.importSymbolic(symbolic));
+      same.primalDual();
+      cold.setCholesky(new ClpCholeskyBase());
+      cold.primalDual();
+      CoinRelFltEq eq(1.0e-5);
+      assert(same.status() == cold.status());
+      assert(eq(same.objectiveValue(), cold.objectiveValue()));
+      // different structure must be refused
+      ClpInterior smaller(model);
+      int lastRow = smaller.numberRows() - 1;
+      smaller.deleteRows(1, &lastRow);
+      assert(ClpCholeskyBase::computeStructureHash(&smaller) != hash);
+      assert(smaller.importSymbolic(symbolic) == 1);
+      delete symbolic;
+    } else {
+      std::cerr << "Error reading afiro from sample data. Skipping test." << std::endl;
+    }
+  }
+  // Test barrier and crossover with and without crossover push
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "brandy";
+    if (m.readMps(fn.c_str(), "mps") == 0) {
+      ClpSimplex model;
+      model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      model.setLogLevel(0);
+      ClpPushCountHandler handler;
+      ClpSimplex push(model);
+      ClpSolve solveOptions;
+      solveOptions.setSolveType(ClpSolve::useBarrier);
+      // so push is on model itself (and its handler)
+      solveOptions.setPresolveType(ClpSolve::presolveOff);
+      model.initialSolve(solveOptions);
+      push.passInMessageHandler(&handler);
+      solveOptions.setSpecialOption(4, 32768);
+      push.initialSolve(solveOptions);
+      assert(!model.status());
+      assert(!push.status());
+      // primal and dual push reported and some batches done
+      assert(handler.numberMessages_ == 2);
+      assert(handler.numberBatches_ > 0);
+      CoinRelFltEq eq(1.0e-8);
+      assert(eq(model.objectiveValue(), 1.5185098965e+03));
+      assert(eq(push.objectiveValue(), model.objectiveValue()));
+      // optimal basis as with normal crossover
+      assert(!push.numberPrimalInfeasibilities());
+      assert(!push.numberDualInfeasibilities());
+    } else {
+      std::cerr << "Error reading brandy from sample data. Skipping test." << std::endl;
+    }
+  }
+  // Test pdco (LSQR) with diagonal and block Jacobi preconditioners
+  {
+    // small equality problem with x=1 feasible
+    int numberRows = 20;
+    int numberColumns = 60;
+    int rowIndices[120];
+    int colIndices[120];
+    double elements[120];
+    double *rhs = new double[numberRows];
+    double *cost = new double[numberColumns];
+    double *colLower = new double[numberColumns];
+    double *colUpper = new double[numberColumns];
+    CoinZeroN(rhs, numberRows);
+    int n = 0;
+    int iColumn;
+    for (iColumn = 0; iColumn < numberColumns; iColumn++) {
+      int iRow0 = iColumn % numberRows;
+      int iRow1 = (7 * iColumn + 3) % numberRows;
+      double value = -0.5 - 0.25 * (iColumn % 3);
+      rowIndices[n] = iRow0;
+      colIndices[n] = iColumn;
+      elements[n++] = 1.0;
+      rowIndices[n] = iRow1;
+      colIndices[n] = iColumn;
+      elements[n++] = value;
+      rhs[iRow0] += 1.0;
+      rhs[iRow1] += value;
+      cost[iColumn] = 1.0 + (iColumn % 5);
+      colLower[iColumn] = 0.0;
+      colUpper[iColumn] = 10.0;
+    }
+    CoinPackedMatrix matrix(true, rowIndices, colIndices, elements, n);
+    // Exact block (one block) must give inverse of A*D*D*A' + delta*delta*I
+    {
+      ClpInterior model;
+      model.loadProblem(matrix, colLower, colUpper, cost, rhs, rhs);
+      double delta = 1.0e-2;
+      double *d = new double[numberColumns];
+      for (iColumn = 0; iColumn < numberColumns; iColumn++)
+        d[iColumn] = 0.5 + 0.1 * (iColumn % 7);
+      double *diagonal = new double[numberRows];
+      double *pr = new double[numberRows];
+      ClpPdcoMatrix diagonalStuff(1.0e-4, delta, 1);
+      diagonalStuff.matPrecon(&model, delta, diagonal, d);
+      ClpPdcoMatrix stuff(1.0e-4, delta, numberRows);
+      assert(stuff.blockSize() == numberRows);
+      stuff.matPrecon(&model, delta, pr, d);
+      int iRow;
+      for (iRow = 0; iRow < numberRows; iRow++)
+        assert(fabs(pr[iRow] - diagonal[iRow]) < 1.0e-12 * fabs(diagonal[iRow]));
+      double *work = new double[numberRows];
+      double *result = new double[numberRows];
+      double *columnWork = new double[numberColumns];
+      for (iRow = 0; iRow < numberRows; iRow++)
+        work[iRow] = 1.0 + iRow;
+      stuff.matPreconApply(&model, 2, work, pr);
+      stuff.matPreconApply(&model, 1, work, pr);
+      CoinZeroN(columnWork, numberColumns);
+      stuff.matVecMult(&model, 2, columnWork, work);
+      for (iColumn = 0; iColumn < numberColumns; iColumn++)
+        columnWork[iColumn] *= d[iColumn] * d[iColumn];
+      for (iRow = 0; iRow < numberRows; iRow++)
+        result[iRow] = delta * delta * work[iRow];
+      stuff.matVecMult(&model, 1, result, columnWork);
+      for (iRow = 0; iRow < numberRows; iRow++)
+        assert(fabs(result[iRow] - (1.0 + iRow)) < 1.0e-6 * (1.0 + iRow));
+      delete[] d;
+      delete[] diagonal;
+      delete[] pr;
+      delete[] work;
+      delete[] result;
+      delete[] columnWork;
+    }
+    // pdco must converge with either preconditioner
+    for (int blockSize = 1; blockSize <= 4; blockSize += 3) {
+      ClpInterior model;
+      model.loadProblem(matrix, colLower, colUpper, cost, rhs, rhs);
+      ClpPdcoMatrix stuff(1.0e-4, 1.0e-4, blockSize);
+      Info info;
+      Outfo outfo;
+      Options options;
+      options.gamma = stuff.getD1();
+      options.delta = stuff.getD2();
+      options.MaxIter = 100;
+      options.FeaTol = 1.0e-6;
+      options.OptTol = 1.0e-6;
+      options.StepTol = 0.99;
+      options.x0min = 0.1;
+      options.z0min = 0.1;
+      options.mu0 = 1.0e-6;
+      options.LSmethod = 3; // LSQR
+      options.LSproblem = 1;
+      options.LSQRMaxIter = 999;
+      options.LSQRatol1 = 1.0e-3;
+      options.LSQRatol2 = 1.0e-8;
+      options.LSQRconlim = 1.0e12;
+      options.wait = 0;
+      info.atolmin = options.LSQRatol2;
+      info.LSdamp = 0.0;
+      // pdco takes ownership of these
+      model.rhs_ = new CoinWorkDouble[numberRows];
+      model.y_ = new CoinWorkDouble[numberRows];
+      model.x_ = new CoinWorkDouble[numberColumns];
+      model.dj_ = new CoinWorkDouble[numberColumns];
+      for (int iRow = 0; iRow < numberRows; iRow++) {
+        model.rhs_[iRow] = rhs[iRow];
+        model.y_[iRow] = 0.0;
+      }
+      for (iColumn = 0; iColumn < numberColumns; iColumn++) {
+        model.x_[iColumn] = 1.0;
+        model.dj_[iColumn] = 1.0;
+      }
+      model.xsize_ = 1.0;
+      model.zsize_ = 1.0;
+      int returnCode = model.pdco(&stuff, options, info, outfo);
+      assert(!returnCode);
+    }
+    delete[] rhs;
+    delete[] cost;
+    delete[] colLower;
+    delete[] colUpper;
+  }
+  // Test Idiot with blocked passes gives same answer on 1 and several threads
+  // and is about as good as normal Idiot
+  {
+    // transportation problem with 100 sources, 100 sinks and 6000 arcs
+    int numberSources = 100;
+    int numberArcs = 60;
+    int numberRows = 2 * numberSources;
+    int numberColumns = numberSources * numberArcs;
+    int *rowIndices = new int[2 * numberColumns];
+    int *colIndices = new int[2 * numberColumns];
+    double *elements = new double[2 * numberColumns];
+    double *cost = new double[numberColumns];
+    double *colLower = new double[numberColumns];
+    double *colUpper = new double[numberColumns];
+    double *rhs = new double[numberRows];
+    int n = 0;
+    int iColumn = 0;
+    for (int i = 0; i < numberSources; i++) {
+      for (int j = 0; j < numberArcs; j++) {
+        rowIndices[n] = i;
+        colIndices[n] = iColumn;
+        elements[n++] = 1.0;
+        rowIndices[n] = numberSources + (7 * i + j) % numberSources;
+        colIndices[n] = iColumn;
+        elements[n++] = 1.0;
+        cost[iColumn] = 1.0 + (13 * i + 7 * j) % 17;
+        colLower[iColumn] = 0.0;
+        colUpper[iColumn] = 10.0;
+        iColumn++;
+      }
+    }
+    for (int iRow = 0; iRow < numberRows; iRow++)
+      rhs[iRow] = numberArcs;
+    CoinPackedMatrix matrix(true, rowIndices, colIndices, elements, n);
+    ClpSimplex model;
+    model.loadProblem(matrix, colLower, colUpper, cost, rhs, rhs);
+    model.setLogLevel(0);
+    ClpSimplex serial(model);
+    ClpSimplex parallel(model);
+    ClpSimplex unblocked(model);
+    int saveThreads = clpSetParallelThreads(1);
+    {
+      Idiot info(unblocked);
+      info.setLogLevel(0);
+      info.crash(20, unblocked.messageHandler(), unblocked.messagesPointer(), false);
+    }
+    {
+      Idiot info(serial);
+      info.setNumberBlocks(3);
+      info.setLogLevel(0);
+      info.crash(20, serial.messageHandler(), serial.messagesPointer(), false);
+    }
+    clpSetParallelThreads(4);
+    {
+      Idiot info(parallel);
+      info.setNumberBlocks(3);
+      info.setLogLevel(0);
+      info.crash(20, parallel.messageHandler(), parallel.messagesPointer(), false);
+    }
+    clpSetParallelThreads(saveThreads);
+    const double *serialSolution = serial.primalColumnSolution();
+    const double *parallelSolution = parallel.primalColumnSolution();
+    for (iColumn = 0; iColumn < numberColumns; iColumn++)
+      assert(serialSolution[iColumn] == parallelSolution[iColumn]);
+    // blocked (Jacobi between blocks) against normal pass
+    const double *unblockedSolution = unblocked.primalColumnSolution();
+    double objectiveBlocked = 0.0;
+    double objectiveUnblocked = 0.0;
+    for (iColumn = 0; iColumn < numberColumns; iColumn++) {
+      objectiveBlocked += cost[iColumn] * parallelSolution[iColumn];
+      objectiveUnblocked += cost[iColumn] * unblockedSolution[iColumn];
+    }
+    assert(fabs(objectiveBlocked - objectiveUnblocked) < 0.1 * fabs(objectiveUnblocked));
+    // and simplex finishes from there
+    parallel.primal(1);
+    unblocked.primal(1);
+    model.dual();
+    CoinRelFltEq eq(1.0e-8);
+    assert(!parallel.status());
+    assert(!unblocked.status());
+    assert(eq(parallel.objectiveValue(), model.objectiveValue()));
+    assert(eq(unblocked.objectiveValue(), model.objectiveValue()));
+    delete[] rowIndices;
+    delete[] colIndices;
+    delete[] elements;
+    delete[] cost;
+    delete[] colLower;
+    delete[] colUpper;
+    delete[] rhs;
+  }
+  // Test one pass MPS reader gives same model as CoinMpsIO
+  {
+    const char *fileName = "clpMpsStream.mps";
+    FILE *fp = fopen(fileName, "w");
+    if (fp) {
+      fprintf(fp, "NAME          TESTLP\n");
+      fprintf(fp, "ROWS\n N  COST\n L  LIM1\n G  LIM2\n E  MYEQN\n E  R4\n");
+      fprintf(fp, "COLUMNS\n");
+      fprintf(fp, "    %-8s  %-8s  %12s   %-8s  %12s\n", "X1", "COST", "1.0", "LIM1", "1.0");
+      fprintf(fp, "    %-8s  %-8s  %12s\n", "X1", "LIM2", "1.0");
+      fprintf(fp, "    %-8s  %-8s                 %-8s\n", "MARKER", "'MARKER'", "'INTORG'");
+      fprintf(fp, "    %-8s  %-8s  %12s   %-8s  %12s\n", "X2", "COST", "2.0", "LIM1", "1.0");
+      fprintf(fp, "    %-8s  %-8s  %12s\n", "X2", "MYEQN", "-1.0");
+      fprintf(fp, "    %-8s  %-8s                 %-8s\n", "MARKER", "'MARKER'", "'INTEND'");
+      fprintf(fp, "    %-8s  %-8s  %12s   %-8s  %12s\n", "X3", "COST", "-1.0", "MYEQN", "1.0");
+      fprintf(fp, "    %-8s  %-8s  %12s\n", "X3", "R4", "1.0");
+      fprintf(fp, "    %-8s  %-8s  %12s   %-8s  %12s\n", "X4", "COST", "1.0", "R4", "2.0");
+      fprintf(fp, "RHS\n");
+      fprintf(fp, "    %-8s  %-8s  %12s\n", "RHS", "COST", "-3.5");
+      fprintf(fp, "    %-8s  %-8s  %12s   %-8s  %12s\n", "RHS", "LIM1", "4.0", "LIM2", "1.0");
+      fprintf(fp, "    %-8s  %-8s  %12s   %-8s  %12s\n", "RHS", "MYEQN", "7.0", "R4", "2.0");
+      fprintf(fp, "RANGES\n");
+      fprintf(fp, "    %-8s  %-8s  %12s   %-8s  %12s\n", "RNG", "LIM1", "2.5", "MYEQN", "-3.0");
+      fprintf(fp, "    %-8s  %-8s  %12s\n", "RNG", "R4", "1.0");
+      fprintf(fp, "BOUNDS\n");
+      fprintf(fp, " %-2s %-8s  %-8s  %12s\n", "UP", "BND", "X1", "4.0");
+      fprintf(fp, " %-2s %-8s  %-8s\n", "MI", "BND", "X2");
+      fprintf(fp, " %-2s %-8s  %-8s  %12s\n", "UP", "BND", "X2", "1.0");
+      fprintf(fp, " %-2s %-8s  %-8s  %12s\n", "LO", "BND", "X3", "-1.0");
+      fprintf(fp, " %-2s %-8s  %-8s  %12s\n", "FX", "BND", "X4", "0.5");
+      fprintf(fp, "ENDATA\n");
+      fclose(fp);
+      ClpSimplex stream;
+      ClpSimplex coin;
+      stream.setLogLevel(0);
+      coin.setLogLevel(0);
+      assert(!stream.readMpsStream(fileName, true));
+      assert(!coin.readMps(fileName, true));
+      int numberRows = coin.numberRows();
+      int numberColumns = coin.numberColumns();
+      assert(stream.numberRows() == numberRows);
+      assert(stream.numberColumns() == numberColumns);
+      int i;
+      for (i = 0; i < numberRows; i++) {
+        assert(stream.rowLower()[i] == coin.rowLower()[i]);
+        assert(stream.rowUpper()[i] == coin.rowUpper()[i]);
+        assert(stream.getRowName(i) == coin.getRowName(i));
+      }
+      for (i = 0; i < numberColumns; i++) {
+        assert(stream.columnLower()[i] == coin.columnLower()[i]);
+        assert(stream.columnUpper()[i] == coin.columnUpper()[i]);
+        assert(stream.objective()[i] == coin.objective()[i]);
+        assert(stream.isInteger(i) == coin.isInteger(i));
+        assert(stream.getColumnName(i) == coin.getColumnName(i));
+      }
+      assert(stream.matrix()->isEquivalent(*coin.matrix()));
+      assert(coin.objectiveOffset() != 0.0);
+      assert(stream.objectiveOffset() == coin.objectiveOffset());
+      // same row twice in a column is an error
+      fp = fopen(fileName, "w");
+      fprintf(fp, "NAME          DUPLICATE\n");
+      fprintf(fp, "ROWS\n N  COST\n L  LIM1\n");
+      fprintf(fp, "COLUMNS\n");
+      fprintf(fp, "    %-8s  %-8s  %12s   %-8s  %12s\n", "X1", "COST", "1.0", "LIM1", "1.0");
+      fprintf(fp, "    %-8s  %-8s  %12s\n", "X1", "LIM1", "2.0");
+      fprintf(fp, "RHS\n");
+      fprintf(fp, "    %-8s  %-8s  %12s\n", "RHS", "LIM1", "4.0");
+      fprintf(fp, "ENDATA\n");
+      fclose(fp);
+      for (int numberThreads = 1; numberThreads <= 2; numberThreads++) {
+        ClpMpsReader reader(stream.messageHandler(), stream.messagesPointer());
+        reader.setNumberThreads(numberThreads);
+        reader.setKeepNames(false);
+        assert(reader.read(fileName) == 1);
+      }
+      remove(fileName);
+    } else {
+      std::cerr << "Unable to write " << fileName << ". Skipping test." << std::endl;
+    }
+  }
+  // Test parallel and serial one pass MPS reads give same model
+  {
+    const char *fileName = "clpMpsParallel.mps";
+    FILE *fp = fopen(fileName, "w");
+    if (fp) {
+      int numberRows = 100;
+      int numberColumns = 3000;
+      int iRow, iColumn;
+      char name1[20], name2[20], value1[20], value2[20];
+      fprintf(fp, "NAME          PARALLEL\n");
+      fprintf(fp, "ROWS\n N  COST\n");
+      for (iRow = 0; iRow < numberRows; iRow++)
+        fprintf(fp, " %c  R%d\n", "ELG"[iRow % 3], iRow);
+      fprintf(fp, "COLUMNS\n");
+      for (iColumn = 0; iColumn < numberColumns; iColumn++) {
+        sprintf(name1, "C%d", iColumn);
+        sprintf(value1, "%d", 1 + iColumn % 7);
+        sprintf(name2, "R%d", iColumn % numberRows);
+        sprintf(value2, "%g", 1.0 + 0.5 * (iColumn % 3));
+        fprintf(fp, "    %-8s  %-8s  %12s   %-8s  %12s\n", name1, "COST", value1, name2, value2);
+        sprintf(name2, "R%d", (7 * iColumn + 1) % numberRows);
+        if ((7 * iColumn + 1) % numberRows == iColumn % numberRows)
+          sprintf(name2, "R%d", (iColumn + 1) % numberRows);
+        sprintf(value2, "%g", -1.0 - 0.25 * (iColumn % 5));
+        fprintf(fp, "    %-8s  %-8s  %12s\n", name1, name2, value2);
+      }
+      fprintf(fp, "RHS\n");
+      for (iRow = 0; iRow < numberRows; iRow++) {
+        sprintf(name2, "R%d", iRow);
+        sprintf(value2, "%d", 1 + iRow % 11);
+        fprintf(fp, "    %-8s  %-8s  %12s\n", "RHS", name2, value2);
+      }
+      fprintf(fp, "BOUNDS\n");
+      for (iColumn = 0; iColumn < numberColumns; iColumn += 5) {
+        sprintf(name1, "C%d", iColumn);
+        fprintf(fp, " %-2s %-8s  %-8s  %12s\n", "UP", "BND", name1, "10");
+      }
+      fprintf(fp, "ENDATA\n");
+      fclose(fp);
+      ClpSimplex serial;
+      ClpSimplex parallel;
+      ClpSimplex coin;
+      serial.setLogLevel(0);
+      parallel.setLogLevel(0);
+      coin.setLogLevel(0);
+      serial.setNumberThreads(1);
+      parallel.setNumberThreads(4);
+      int saveThreads = clpSetParallelThreads(4);
+      assert(!serial.readMpsStream(fileName));
+      assert(!parallel.readMpsStream(fileName));
+      clpSetParallelThreads(saveThreads);
+      assert(!coin.readMps(fileName));
+      ClpSimplex *models[2] = { &parallel, &coin };
+      for (int iModel = 0; iModel < 2; iModel++) {
+        ClpSimplex &other = *models[iModel];
+        assert(other.numberRows() == numberRows);
+        assert(other.numberColumns() == numberColumns);
+        for (iRow = 0; iRow < numberRows; iRow++) {
+          assert(other.rowLower()[iRow] == serial.rowLower()[iRow]);
+          assert(other.rowUpper()[iRow] == serial.rowUpper()[iRow]);
+        }
+        for (iColumn = 0; iColumn < numberColumns; iColumn++) {
+          assert(other.columnLower()[iColumn] == serial.columnLower()[iColumn]);
+          assert(other.columnUpper()[iColumn] == serial.columnUpper()[iColumn]);
+          assert(other.objective()[iColumn] == serial.objective()[iColumn]);
+        }
+        assert(other.matrix()->isEquivalent(*serial.matrix()));
+      }
+      // errors counted by reader itself - same as CoinMpsIO
+      fp = fopen(fileName, "w");
+      fprintf(fp, "NAME          BAD\n");
+      fprintf(fp, "ROWS\n N  COST\n L  LIM1\n");
+      fprintf(fp, "COLUMNS\n");
+      fprintf(fp, "    %-8s  %-8s  %12s   %-8s  %12s\n", "X1", "COST", "1.0", "LIM1", "1.0");
+      fprintf(fp, "    %-8s  %-8s  %12s\n", "X1", "NOROW", "2.0");
+      fprintf(fp, "RHS\n");
+      fprintf(fp, "    %-8s  %-8s  %12s\n", "RHS", "LIM1", "4.0");
+      fprintf(fp, "ENDATA\n");
+      fclose(fp);
+      int coinStatus = coin.readMps(fileName, false, true);
+      assert(coinStatus > 0);
+      assert(parallel.readMpsStream(fileName, false, true) == coinStatus);
+      assert(parallel.numberColumns() == coin.numberColumns());
+      // and without ignoring errors nothing is loaded
+      ClpSimplex bad;
+      bad.setLogLevel(0);
+      assert(bad.readMpsStream(fileName) == coinStatus);
+      assert(!bad.numberColumns());
+      remove(fileName);
+    } else {
+      std::cerr << "Unable to write " << fileName << ". Skipping test." << std::endl;
+    }
+  }
+  // Test saveModel and restoreModel through mapped file
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "afiro";
+    if (m.readMps(fn.c_str(), "mps") == 0) {
+      ClpSimplex model;
+      model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      model.setLogLevel(0);
+      model.dual();
+      const char *fileName = "clpMapped.save";
+      assert(!model.saveModel(fileName));
+      ClpSimplex restored;
+      restored.setLogLevel(0);
+      assert(!restored.restoreModel(fileName));
+      assert(restored.isMapped());
+      int numberRows = model.numberRows();
+      int numberColumns = model.numberColumns();
+      assert(restored.numberRows() == numberRows);
+      assert(restored.numberColumns() == numberColumns);
+      int i;
+      for (i = 0; i < numberRows; i++) {
+        assert(restored.rowLower()[i] == model.rowLower()[i]);
+        assert(restored.rowUpper()[i] == model.rowUpper()[i]);
+      }
+      for (i = 0; i < numberColumns; i++) {
+        assert(restored.columnLower()[i] == model.columnLower()[i]);
+        assert(restored.columnUpper()[i] == model.columnUpper()[i]);
+        assert(restored.objective()[i] == model.objective()[i]);
+        assert(restored.primalColumnSolution()[i] == model.primalColumnSolution()[i]);
+      }
+      assert(restored.matrix()->isEquivalent(*model.matrix()));
+      CoinRelFltEq eq(1.0e-8);
+      restored.primal();
+      assert(!restored.status());
+      assert(eq(restored.objectiveValue(), -4.6475314286e+02));
+      // changing bound in place must not change file
+      double saveUpper = restored.columnUpper()[0];
+      restored.setColumnUpper(0, saveUpper - 1.0);
+      assert(restored.isMapped());
+      {
+        ClpSimplex again;
+        assert(!again.restoreModel(fileName));
+        assert(again.columnUpper()[0] == saveUpper);
+        // saving over mapped file leaves mapped model alone
+        assert(!again.saveModel(fileName));
+        again.setColumnUpper(0, saveUpper);
+      }
+      assert(restored.columnUpper()[0] == saveUpper - 1.0);
+      restored.setColumnUpper(0, saveUpper);
+      // adding a row copies arrays out of file
+      int rowIndex[2] = { 0, 1 };
+      double rowElement[2] = { 1.0, 1.0 };
+      restored.addRow(2, rowIndex, rowElement, -COIN_DBL_MAX, COIN_DBL_MAX);
+      assert(!restored.isMapped());
+      assert(restored.numberRows() == numberRows + 1);
+      restored.dual();
+      assert(!restored.status());
+      assert(eq(restored.objectiveValue(), -4.6475314286e+02));
+      remove(fileName);
+    } else {
+      std::cerr << "Error reading afiro from sample data. Skipping test." << std::endl;
+    }
+  }
+  // Test binary basis write and read
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "afiro";
+    if (m.readMps(fn.c_str(), "mps") == 0) {
+      ClpSimplex model;
+      model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      model.setLogLevel(0);
+      ClpSimplex empty(model);
+      model.dual();
+      const char *fileName = "clpBasis.bin";
+      int numberRows = model.numberRows();
+      int numberColumns = model.numberColumns();
+      int i;
+      for (int writeValues = 0; writeValues < 2; writeValues++) {
+        assert(!model.writeBinaryBasis(fileName, writeValues != 0));
+        ClpSimplex restored(empty);
+        restored.setLogLevel(0);
+        const unsigned char *oldStatus = restored.statusArray();
+        assert(restored.readBinaryBasis(fileName) == writeValues);
+        // status array is filled in not replaced
+        assert(!oldStatus || restored.statusArray() == oldStatus);
+        for (i = 0; i < numberRows; i++)
+          assert(restored.getRowStatus(i) == model.getRowStatus(i));
+        for (i = 0; i < numberColumns; i++)
+          assert(restored.getColumnStatus(i) == model.getColumnStatus(i));
+        if (writeValues) {
+          for (i = 0; i < numberRows; i++) {
+            assert(restored.primalRowSolution()[i] == model.primalRowSolution()[i]);
+            assert(restored.dualRowSolution()[i] == model.dualRowSolution()[i]);
+          }
+          for (i = 0; i < numberColumns; i++) {
+            assert(restored.primalColumnSolution()[i] == model.primalColumnSolution()[i]);
+            assert(restored.dualColumnSolution()[i] == model.dualColumnSolution()[i]);
+          }
+        }
+        // readBasis recognizes binary file
+        ClpSimplex again(empty);
+        again.setLogLevel(0);
+        assert(again.readBasis(fileName) == writeValues);
+        again.primal();
+        assert(!again.numberIterations());
+        CoinRelFltEq eq(1.0e-8);
+        assert(eq(again.objectiveValue(), -4.6475314286e+02));
+      }
+      // different model refused
+      ClpSimplex other(empty);
+      int lastRow = numberRows - 1;
+      other.deleteRows(1, &lastRow);
+      assert(other.readBinaryBasis(fileName) == -2);
+      // same sizes and column counts but an element in another row
+      ClpSimplex moved(empty);
+      CoinPackedMatrix *matrix = moved.matrix();
+      int *row = matrix->getMutableIndices();
+      CoinBigIndex start = matrix->getVectorStarts()[0];
+      int length = matrix->getVectorLengths()[0];
+      for (int iRow = 0; iRow < numberRows; iRow++) {
+        bool inColumn = false;
+        for (CoinBigIndex j = start; j < start + length; j++) {
+          if (row[j] == iRow)
+            inColumn = true;
+        }
+        if (!inColumn) {
+          row[start] = iRow;
+          break;
+        }
+      }
+      assert(moved.readBinaryBasis(fileName) == -2);
+      remove(fileName);
+    } else {
+      std::cerr << "Error reading afiro from sample data. Skipping test." << std::endl;
+    }
+  }
+  // Test parallel factorization against CoinFactorization
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "brandy";
+    if (m.readMps(fn.c_str(), "mps") == 0) {
+      ClpSimplex model;
+      model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      model.setLogLevel(0);
+      model.scaling(0);
+      ClpSimplex empty(model);
+      model.dual();
+      CoinRelFltEq eq(1.0e-8);
+      assert(eq(model.objectiveValue(), 1.5185098965e+03));
+      // same optimal basis factorized both ways
+      ClpSimplex serial(model);
+      ClpSimplex parallel(model);
+      parallel.factorization()->forceOtherFactorization(5);
+      serial.dual(0, 1);
+      parallel.dual(0, 1);
+      assert(eq(parallel.objectiveValue(), 1.5185098965e+03));
+      int numberRows = model.numberRows();
+      int numberColumns = model.numberColumns();
+      int numberTotal = numberRows + numberColumns;
+      int i, j;
+      for (i = 0; i < numberTotal; i++)
+        assert(serial.getStatus(i) == parallel.getStatus(i));
+      ClpFactorization *factorization[2];
+      factorization[0] = serial.factorization();
+      factorization[1] = parallel.factorization();
+      assert(factorization[1]->isDenseOrSmall());
+      ClpSimplex *models[2] = { &serial, &parallel };
+      // factorizations may put basic variables on different rows
+      int *whichRow = new int[2 * numberTotal];
+      CoinIndexedVector work[2];
+      CoinIndexedVector column[2];
+      for (int k = 0; k < 2; k++) {
+        work[k].reserve(numberRows);
+        column[k].reserve(numberRows);
+      }
+      for (int pass = 0; pass < 2; pass++) {
+        for (int k = 0; k < 2; k++) {
+          const int *pivotVariable = models[k]->pivotVariable();
+          int *row = whichRow + k * numberTotal;
+          for (i = 0; i < numberTotal; i++)
+            row[i] = -1;
+          for (i = 0; i < numberRows; i++)
+            row[pivotVariable[i]] = i;
+        }
+        // FTRAN
+        for (j = 0; j < numberTotal; j++) {
+          for (int k = 0; k < 2; k++) {
+            models[k]->unpack(column + k, j);
+            factorization[k]->updateColumn(work + k, column + k);
+          }
+          const double *value0 = column[0].denseVector();
+          const double *value1 = column[1].denseVector();
+          const int *pivotVariable = serial.pivotVariable();
+          for (i = 0; i < numberRows; i++) {
+            int iRow = whichRow[numberTotal + pivotVariable[i]];
+            assert(iRow >= 0);
+            assert(fabs(value0[i] - value1[iRow]) < 1.0e-8 * (1.0 + fabs(value0[i])));
+          }
+          column[0].clear();
+          column[1].clear();
+        }
+        // BTRAN - rows of inverse for same basic variable
+        for (i = 0; i < numberRows; i++) {
+          int iSequence = serial.pivotVariable()[i];
+          column[0].insert(i, 1.0);
+          column[1].insert(whichRow[numberTotal + iSequence], 1.0);
+          for (int k = 0; k < 2; k++)
+            factorization[k]->updateColumnTranspose(work + k, column + k);
+          const double *value0 = column[0].denseVector();
+          const double *value1 = column[1].denseVector();
+          for (j = 0; j < numberRows; j++)
+            assert(fabs(value0[j] - value1[j]) < 1.0e-8 * (1.0 + fabs(value0[j])));
+          column[0].clear();
+          column[1].clear();
+        }
+        if (pass)
+          break;
+        // replaceColumn - bring in first nonbasic structural
+        int sequenceIn = -1;
+        for (j = 0; j < numberColumns; j++) {
+          if (serial.getStatus(j) != ClpSimplex::basic) {
+            sequenceIn = j;
+            break;
+          }
+        }
+        assert(sequenceIn >= 0);
+        for (int k = 0; k < 2; k++) {
+          models[k]->unpack(column + k, sequenceIn);
+          factorization[k]->updateColumnFT(work + k, column + k);
+        }
+        // leaving variable from serial result
+        const double *value0 = column[0].denseVector();
+        int pivotRow = -1;
+        double largest = 0.0;
+        for (i = 0; i < numberRows; i++) {
+          if (fabs(value0[i]) > largest) {
+            largest = fabs(value0[i]);
+            pivotRow = i;
+          }
+        }
+        assert(pivotRow >= 0);
+        int sequenceOut = serial.pivotVariable()[pivotRow];
+        int pivotRows[2];
+        pivotRows[0] = pivotRow;
+        pivotRows[1] = whichRow[numberTotal + sequenceOut];
+        for (int k = 0; k < 2; k++) {
+          double alpha = column[k].denseVector()[pivotRows[k]];
+          assert(fabs(alpha - value0[pivotRow]) < 1.0e-8 * (1.0 + largest));
+          int returnCode = factorization[k]->replaceColumn(models[k], work + k,
+            column + k, pivotRows[k], alpha);
+          assert(!returnCode);
+          models[k]->pivotVariable()[pivotRows[k]] = sequenceIn;
+          models[k]->setStatus(sequenceIn, ClpSimplex::basic);
+          models[k]->setStatus(sequenceOut, ClpSimplex::atLowerBound);
+          work[k].clear();
+          column[k].clear();
+        }
+      }
+      delete[] whichRow;
+      // nucleus too big for dense code - each factorization falls back
+      // to CoinFactorization and parallel is tried again next time
+      ClpParallelFactorization small;
+      small.setMaximumDense(0);
+      ClpFactorization fallback(small);
+      ClpSimplex model2(empty);
+      model2.setLogLevel(0);
+      model2.setFactorization(fallback);
+      model2.dual();
+      assert(!model2.status());
+      assert(eq(model2.objectiveValue(), 1.5185098965e+03));
+      model2.allSlackBasis(true);
+      model2.primal();
+      assert(!model2.status());
+      assert(eq(model2.objectiveValue(), 1.5185098965e+03));
+    } else {
+      std::cerr << "Error reading brandy from sample data. Skipping test." << std::endl;
+    }
+  }
+  // Test hyper-sparse solves against dense solves
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "brandy";
+    if (m.readMps(fn.c_str(), "mps") == 0) {
+      ClpSimplex model;
+      model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      model.setLogLevel(0);
+      model.scaling(0);
+      model.dual();
+      // same factorization code with and without hyper-sparse solves
+      ClpParallelFactorization denseParallel;
+      denseParallel.setHyperSparseRatio(0);
+      ClpParallelFactorization sparseParallel;
+      ClpFactorization denseFactorization(denseParallel);
+      ClpFactorization sparseFactorization(sparseParallel);
+      ClpSimplex dense(model);
+      ClpSimplex sparse(model);
+      dense.setFactorization(denseFactorization);
+      sparse.setFactorization(sparseFactorization);
+      dense.dual(0, 1);
+      sparse.dual(0, 1);
+      int numberRows = model.numberRows();
+      int numberTotal = numberRows + model.numberColumns();
+      int i, j;
+      for (i = 0; i < numberRows; i++)
+        assert(dense.pivotVariable()[i] == sparse.pivotVariable()[i]);
+      ClpFactorization *factorization0 = dense.factorization();
+      ClpFactorization *factorization1 = sparse.factorization();
+      CoinIndexedVector work;
+      CoinIndexedVector column0;
+      CoinIndexedVector column1;
+      work.reserve(numberRows);
+      column0.reserve(numberRows);
+      column1.reserve(numberRows);
+      // FTRAN of every column
+      for (j = 0; j < numberTotal; j++) {
+        dense.unpack(&column0, j);
+        sparse.unpack(&column1, j);
+        factorization0->updateColumn(&work, &column0);
+        factorization1->updateColumn(&work, &column1);
+        const double *value0 = column0.denseVector();
+        const double *value1 = column1.denseVector();
+        for (i = 0; i < numberRows; i++)
+          assert(fabs(value0[i] - value1[i]) < 1.0e-10 * (1.0 + fabs(value0[i])));
+        // every nonzero is in index list
+        int numberNonZero = 0;
+        for (i = 0; i < numberRows; i++) {
+          if (value1[i])
+            numberNonZero++;
+        }
+        assert(numberNonZero <= column1.getNumElements());
+        column0.clear();
+        column1.clear();
+      }
+      // BTRAN of every unit vector
+      for (i = 0; i < numberRows; i++) {
+        column0.insert(i, 1.0);
+        column1.insert(i, 1.0);
+        factorization0->updateColumnTranspose(&work, &column0);
+        factorization1->updateColumnTranspose(&work, &column1);
+        const double *value0 = column0.denseVector();
+        const double *value1 = column1.denseVector();
+        int numberNonZero = 0;
+        for (j = 0; j < numberRows; j++) {
+          assert(fabs(value0[j] - value1[j]) < 1.0e-10 * (1.0 + fabs(value0[j])));
+          if (value1[j])
+            numberNonZero++;
+        }
+        assert(numberNonZero <= column1.getNumElements());
+        column0.clear();
+        column1.clear();
+      }
+      const ClpParallelFactorization *parallel0 = dynamic_cast< const ClpParallelFactorization * >(factorization0->coinOtherFactorization());
+      const ClpParallelFactorization *parallel1 = dynamic_cast< const ClpParallelFactorization * >(factorization1->coinOtherFactorization());
+      assert(parallel0 && parallel1);
+      assert(!parallel0->numberHyperSparse(0) && !parallel0->numberHyperSparse(1));
+      assert(parallel1->numberHyperSparse(0) && parallel1->numberHyperSparse(1));
+    } else {
+      std::cerr << "Error reading brandy from sample data. Skipping test." << std::endl;
+    }
+  }
 #if COIN_BIG_INDEX == 0
   // test network
 #define QUADRATIC